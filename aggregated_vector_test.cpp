@@ -0,0 +1,162 @@
+#include "chunked_vector/aggregated_vector.h"
+#include "test_common.h"
+#include <gtest/gtest.h>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace dod;
+
+class AggregatedVectorTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override {}
+    void TearDown() override {}
+};
+
+template <typename Aggregate, typename T> T brute_force(const std::vector<T>& values, size_t first, size_t last)
+{
+    T result = Aggregate::identity();
+    for (size_t i = first; i < last; ++i)
+    {
+        result = Aggregate::combine(result, values[i]);
+    }
+    return result;
+}
+
+template <typename Aggregate> void check_all_ranges(const aggregated_vector<int64_t, Aggregate, 4>& vec, const std::vector<int64_t>& expected)
+{
+    ASSERT_EQ(vec.size(), expected.size());
+    for (size_t first = 0; first <= expected.size(); ++first)
+    {
+        for (size_t last = first; last <= expected.size(); ++last)
+        {
+            EXPECT_EQ(vec.query(first, last), brute_force<Aggregate>(expected, first, last)) << "range [" << first << ", " << last << ")";
+        }
+    }
+    EXPECT_EQ(vec.total(), brute_force<Aggregate>(expected, 0, expected.size()));
+}
+
+// ============================================================================
+// Queries
+// ============================================================================
+
+TEST_F(AggregatedVectorTest, SumOverEveryRange)
+{
+    aggregated_vector<int64_t, sum_aggregate<int64_t>, 4> vec;
+    std::vector<int64_t> expected;
+    EXPECT_EQ(vec.total(), 0);
+
+    for (int64_t i = 0; i < 23; ++i)
+    {
+        vec.push_back(i * i - 7);
+        expected.push_back(i * i - 7);
+        check_all_ranges(vec, expected);
+    }
+    EXPECT_EQ(vec.at(5), 18);
+    EXPECT_THROW((void)vec.at(23), std::out_of_range);
+}
+
+TEST_F(AggregatedVectorTest, MinAndMax)
+{
+    std::mt19937 rng(3);
+    aggregated_vector<int64_t, min_aggregate<int64_t>, 4> min_vec;
+    aggregated_vector<int64_t, max_aggregate<int64_t>, 4> max_vec;
+    std::vector<int64_t> expected;
+    for (int i = 0; i < 37; ++i)
+    {
+        const int64_t value = static_cast<int64_t>(rng() % 1000) - 500;
+        min_vec.push_back(value);
+        max_vec.push_back(value);
+        expected.push_back(value);
+    }
+    check_all_ranges(min_vec, expected);
+    check_all_ranges(max_vec, expected);
+}
+
+TEST_F(AggregatedVectorTest, FloatingPointIdentities)
+{
+    aggregated_vector<double, min_aggregate<double>, 8> min_vec{3.5, -1.25, 7.0};
+    aggregated_vector<double, max_aggregate<double>, 8> max_vec{3.5, -1.25, 7.0};
+    EXPECT_EQ(min_vec.total(), -1.25);
+    EXPECT_EQ(max_vec.total(), 7.0);
+    EXPECT_EQ(min_vec.query(1, 1), std::numeric_limits<double>::infinity());
+
+    aggregated_vector<double, sum_aggregate<double>, 8> sum_vec;
+    for (int i = 0; i < 1000; ++i)
+    {
+        sum_vec.push_back(0.5);
+    }
+    EXPECT_DOUBLE_EQ(sum_vec.query(10, 990), 490.0);
+}
+
+// ============================================================================
+// Updates
+// ============================================================================
+
+TEST_F(AggregatedVectorTest, SetUpdatesPageAggregates)
+{
+    aggregated_vector<int64_t, max_aggregate<int64_t>, 4> vec;
+    std::vector<int64_t> expected;
+    for (int64_t i = 0; i < 18; ++i)
+    {
+        vec.push_back(i);
+        expected.push_back(i);
+    }
+
+    // Full page, then tail page
+    vec.set(5, 100);
+    expected[5] = 100;
+    vec.set(17, -3);
+    expected[17] = -3;
+    vec.set(5, 2);
+    expected[5] = 2;
+    check_all_ranges(vec, expected);
+    EXPECT_EQ(vec[5], 2);
+}
+
+TEST_F(AggregatedVectorTest, PopBackRestoresTailPage)
+{
+    aggregated_vector<int64_t, sum_aggregate<int64_t>, 4> vec;
+    std::vector<int64_t> expected;
+    for (int64_t i = 1; i <= 20; ++i)
+    {
+        vec.push_back(i);
+        expected.push_back(i);
+    }
+
+    while (!expected.empty())
+    {
+        vec.pop_back();
+        expected.pop_back();
+        check_all_ranges(vec, expected);
+    }
+    EXPECT_TRUE(vec.empty());
+
+    vec.push_back(5);
+    EXPECT_EQ(vec.total(), 5);
+    vec.clear();
+    EXPECT_EQ(vec.total(), 0);
+    vec.push_back(6);
+    EXPECT_EQ(vec.total(), 6);
+}
+
+TEST_F(AggregatedVectorTest, NonCommutativeAggregateKeepsOrder)
+{
+    struct concat_aggregate
+    {
+        static std::string identity() { return std::string(); }
+        static std::string combine(const std::string& a, const std::string& b) { return a + b; }
+    };
+
+    aggregated_vector<std::string, concat_aggregate, 2> vec;
+    std::string all;
+    for (char c = 'a'; c <= 'z'; ++c)
+    {
+        vec.push_back(std::string(1, c));
+        all += c;
+    }
+    EXPECT_EQ(vec.total(), all);
+    EXPECT_EQ(vec.query(3, 21), all.substr(3, 18));
+    EXPECT_EQ(vec.query(0, 8), all.substr(0, 8));
+}
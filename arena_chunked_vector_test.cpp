@@ -0,0 +1,238 @@
+#include "chunked_vector/arena_chunked_vector.h"
+#include "test_common.h"
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+using namespace dod;
+
+class ArenaChunkedVectorTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        TestObject::constructor_calls = 0;
+        TestObject::destructor_calls = 0;
+        TestObject::copy_calls = 0;
+        TestObject::move_calls = 0;
+    }
+    void TearDown() override {}
+};
+
+// 64 KB pages, so every page is exactly one commit step
+using big_page_vector = arena_chunked_vector<uint64_t, 8192>;
+
+// ============================================================================
+// Basic Operations
+// ============================================================================
+
+TEST_F(ArenaChunkedVectorTest, EmptyVectorReservesNothing)
+{
+    arena_chunked_vector<int> vec;
+    EXPECT_TRUE(vec.empty());
+    EXPECT_EQ(vec.capacity(), 0u);
+    EXPECT_EQ(vec.committed_bytes(), 0u);
+    EXPECT_TRUE(vec.begin() == vec.end());
+    EXPECT_GE(vec.max_size(), size_t(1) << 24);
+}
+
+TEST_F(ArenaChunkedVectorTest, PushBackAccessAndIterate)
+{
+    arena_chunked_vector<int, 16> vec;
+    for (int i = 0; i < 1000; ++i)
+    {
+        vec.push_back(i);
+    }
+    ASSERT_EQ(vec.size(), 1000u);
+    EXPECT_EQ(vec.page_count(), 63u);
+    EXPECT_EQ(vec.front(), 0);
+    EXPECT_EQ(vec.back(), 999);
+    EXPECT_EQ(vec.at(500), 500);
+    EXPECT_THROW((void)vec.at(1000), std::out_of_range);
+
+    int expected = 0;
+    for (int value : vec)
+    {
+        EXPECT_EQ(value, expected++);
+    }
+    EXPECT_EQ(expected, 1000);
+
+    // Page-aligned size with a spare page after the last element
+    vec.resize(992);
+    expected = 0;
+    for (auto it = vec.cbegin(); it != vec.cend(); ++it)
+    {
+        EXPECT_EQ(*it, expected++);
+    }
+    EXPECT_EQ(expected, 992);
+}
+
+TEST_F(ArenaChunkedVectorTest, NonTrivialTypes)
+{
+    {
+        arena_chunked_vector<TestObject, 8> vec;
+        for (int i = 0; i < 50; ++i)
+        {
+            vec.emplace_back(i);
+        }
+        arena_chunked_vector<TestObject, 8> copy(vec);
+        arena_chunked_vector<TestObject, 8> moved(std::move(copy));
+        EXPECT_TRUE(copy.empty());
+        ASSERT_EQ(moved.size(), 50u);
+        EXPECT_EQ(moved[49].value, 49);
+
+        moved.resize(20);
+        moved.pop_back();
+        EXPECT_EQ(moved.back().value, 18);
+        moved.resize(30, TestObject(7));
+        EXPECT_EQ(moved[29].value, 7);
+
+        copy = std::move(moved);
+        EXPECT_EQ(copy.size(), 30u);
+        EXPECT_EQ(copy[10].value, 10);
+    }
+    EXPECT_EQ(TestObject::constructor_calls + TestObject::copy_calls + TestObject::move_calls, TestObject::destructor_calls);
+
+    arena_chunked_vector<std::string, 4> strings = {"a", "b", "c", "d", "e"};
+    arena_chunked_vector<std::string, 4> other;
+    other = strings;
+    EXPECT_EQ(other[4], "e");
+}
+
+// ============================================================================
+// Arena Pages
+// ============================================================================
+
+TEST_F(ArenaChunkedVectorTest, CommitsAsPagesAreNeeded)
+{
+    big_page_vector vec;
+    vec.push_back(1);
+    EXPECT_EQ(vec.committed_bytes(), 64u * 1024u);
+    vec.resize(3 * 8192 + 1);
+    EXPECT_EQ(vec.committed_bytes(), 4u * 64u * 1024u);
+}
+
+TEST_F(ArenaChunkedVectorTest, ReservationSizeCapsMaxSize)
+{
+    // 1 MB of address space holds 16 pages of 64 KB
+    using bounded_vector = arena_chunked_vector<uint64_t, 8192, size_t(1) << 20>;
+    EXPECT_EQ(bounded_vector::max_size(), 16u * 8192u);
+    EXPECT_LT(bounded_vector::max_size(), big_page_vector::max_size());
+
+    bounded_vector vec;
+    vec.resize(bounded_vector::max_size(), 5);
+    EXPECT_EQ(vec.committed_bytes(), size_t(1) << 20);
+    EXPECT_EQ(vec.back(), 5u);
+    EXPECT_THROW(vec.reserve(bounded_vector::max_size() + 1), std::length_error);
+    EXPECT_THROW(vec.push_back(6), std::length_error);
+    EXPECT_EQ(vec.size(), bounded_vector::max_size());
+}
+
+TEST_F(ArenaChunkedVectorTest, ShrinkToFitReusesPagesWithoutMovingElements)
+{
+    big_page_vector vec(8 * 8192, 3);
+    const uint64_t* first = &vec[0];
+    vec.resize(2 * 8192);
+    vec.shrink_to_fit();
+    EXPECT_EQ(vec.page_count(), 2u);
+    EXPECT_EQ(&vec[0], first);
+
+    // Regrowth takes pages from the free list instead of committing new ones
+    const size_t committed = vec.committed_bytes();
+    vec.resize(6 * 8192, 4);
+    EXPECT_EQ(vec.committed_bytes(), committed);
+    EXPECT_EQ(vec[2 * 8192 - 1], 3u);
+    EXPECT_EQ(vec[6 * 8192 - 1], 4u);
+}
+
+TEST_F(ArenaChunkedVectorTest, EraseRange)
+{
+    arena_chunked_vector<int, 8> vec;
+    std::vector<int> expected;
+    for (int i = 0; i < 100; ++i)
+    {
+        vec.push_back(i);
+        expected.push_back(i);
+    }
+
+    // Page-aligned: the pages are renumbered and the following elements keep their addresses
+    const int* kept = &vec[40];
+    vec.erase(16, 40);
+    expected.erase(expected.begin() + 16, expected.begin() + 40);
+    EXPECT_EQ(&vec[16], kept);
+
+    // Unaligned, within one page and across pages
+    vec.erase(3, 5);
+    expected.erase(expected.begin() + 3, expected.begin() + 5);
+    vec.erase(10, 29);
+    expected.erase(expected.begin() + 10, expected.begin() + 29);
+    vec.erase(vec.size() - 4, vec.size());
+    expected.resize(expected.size() - 4);
+
+    ASSERT_EQ(vec.size(), expected.size());
+    for (size_t i = 0; i < expected.size(); ++i)
+    {
+        EXPECT_EQ(vec[i], expected[i]);
+    }
+    size_t visited = 0;
+    for (int value : vec)
+    {
+        EXPECT_EQ(value, expected[visited++]);
+    }
+    EXPECT_EQ(visited, expected.size());
+}
+
+TEST_F(ArenaChunkedVectorTest, CompactMovesPagesDownAndDecommits)
+{
+    big_page_vector vec;
+    for (uint64_t i = 0; i < 8 * 8192; ++i)
+    {
+        vec.push_back(i);
+    }
+    EXPECT_EQ(vec.committed_bytes(), 8u * 64u * 1024u);
+
+    // Dropping the first three pages leaves them as spare pages; releasing them punches holes at the arena front
+    vec.erase(0, 3 * 8192);
+    vec.shrink_to_fit();
+    EXPECT_EQ(vec.page_count(), 5u);
+    EXPECT_EQ(vec.committed_bytes(), 8u * 64u * 1024u);
+
+    vec.compact();
+    EXPECT_EQ(vec.committed_bytes(), 5u * 64u * 1024u);
+    ASSERT_EQ(vec.size(), 5u * 8192u);
+    for (uint64_t i = 0; i < vec.size(); ++i)
+    {
+        ASSERT_EQ(vec[i], i + 3 * 8192);
+    }
+
+    // Compacting an already dense arena moves nothing
+    const uint64_t* first = &vec[0];
+    vec.compact();
+    EXPECT_EQ(&vec[0], first);
+
+    vec.clear();
+    vec.compact();
+    EXPECT_EQ(vec.committed_bytes(), 0u);
+    vec.push_back(42);
+    EXPECT_EQ(vec[0], 42u);
+}
+
+TEST_F(ArenaChunkedVectorTest, CompactRelocatesNonTrivialElements)
+{
+    {
+        arena_chunked_vector<TestObject, 4> vec;
+        for (int i = 0; i < 32; ++i)
+        {
+            vec.emplace_back(i);
+        }
+        vec.erase(0, 12);
+        vec.erase(4, 6);
+        vec.compact();
+        ASSERT_EQ(vec.size(), 18u);
+        for (int i = 0; i < 18; ++i)
+        {
+            EXPECT_EQ(vec[i].value, i < 4 ? 12 + i : 14 + i);
+        }
+    }
+    EXPECT_EQ(TestObject::constructor_calls + TestObject::copy_calls + TestObject::move_calls, TestObject::destructor_calls);
+}
@@ -0,0 +1,259 @@
+#include "chunked_vector/chunked_deque.h"
+#include "test_common.h"
+#include <deque>
+#include <gtest/gtest.h>
+#include <random>
+#include <string>
+
+using namespace dod;
+
+class ChunkedDequeTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        TestObject::constructor_calls = 0;
+        TestObject::destructor_calls = 0;
+        TestObject::copy_calls = 0;
+        TestObject::move_calls = 0;
+    }
+    void TearDown() override {}
+};
+
+// ============================================================================
+// Basic Operations
+// ============================================================================
+
+TEST_F(ChunkedDequeTest, PushAndPopBothEnds)
+{
+    chunked_deque<int, 4> deque;
+    EXPECT_TRUE(deque.empty());
+
+    for (int i = 0; i < 10; ++i)
+    {
+        deque.push_back(i);
+        deque.push_front(-i - 1);
+    }
+    ASSERT_EQ(deque.size(), 20);
+    EXPECT_EQ(deque.front(), -10);
+    EXPECT_EQ(deque.back(), 9);
+    for (int i = 0; i < 20; ++i)
+    {
+        EXPECT_EQ(deque[i], i - 10);
+    }
+    EXPECT_EQ(deque.at(19), 9);
+    EXPECT_THROW((void)deque.at(20), std::out_of_range);
+
+    deque.pop_front();
+    deque.pop_back();
+    EXPECT_EQ(deque.size(), 18);
+    EXPECT_EQ(deque.front(), -9);
+    EXPECT_EQ(deque.back(), 8);
+
+    while (!deque.empty())
+    {
+        deque.pop_front();
+    }
+    deque.push_front(42);
+    EXPECT_EQ(deque.front(), 42);
+    EXPECT_EQ(deque.back(), 42);
+}
+
+TEST_F(ChunkedDequeTest, ConstructorsAndIteration)
+{
+    chunked_deque<int, 4> list{1, 2, 3, 4, 5, 6};
+    int expected = 1;
+    for (int value : list)
+    {
+        EXPECT_EQ(value, expected++);
+    }
+    EXPECT_EQ(expected, 7);
+
+    chunked_deque<int, 4> zeros(5);
+    EXPECT_EQ(zeros.size(), 5);
+    EXPECT_EQ(zeros[4], 0);
+
+    const chunked_deque<std::string, 4> filled(3, "x");
+    for (auto it = filled.cbegin(); it != filled.cend(); ++it)
+    {
+        EXPECT_EQ(*it, "x");
+        EXPECT_EQ(it->size(), 1u);
+    }
+}
+
+TEST_F(ChunkedDequeTest, MatchesStdDequeUnderRandomOperations)
+{
+    chunked_deque<int, 8> deque;
+    std::deque<int> reference;
+    std::mt19937 rng(12345);
+
+    for (int step = 0; step < 20000; ++step)
+    {
+        const int op = static_cast<int>(rng() % 5);
+        if (op == 0 || reference.empty())
+        {
+            deque.push_back(step);
+            reference.push_back(step);
+        }
+        else if (op == 1)
+        {
+            deque.push_front(step);
+            reference.push_front(step);
+        }
+        else if (op == 2)
+        {
+            deque.pop_front();
+            reference.pop_front();
+        }
+        else if (op == 3)
+        {
+            deque.pop_back();
+            reference.pop_back();
+        }
+        else
+        {
+            const size_t pos = rng() % reference.size();
+            EXPECT_EQ(deque[pos], reference[pos]);
+        }
+        ASSERT_EQ(deque.size(), reference.size());
+    }
+
+    size_t idx = 0;
+    for (int value : deque)
+    {
+        EXPECT_EQ(value, reference[idx++]);
+    }
+}
+
+// ============================================================================
+// Page Recycling
+// ============================================================================
+
+TEST_F(ChunkedDequeTest, FifoQueueRecyclesPages)
+{
+    chunked_deque<int, 16> queue;
+    for (int i = 0; i < 64; ++i)
+    {
+        queue.push_back(i);
+    }
+    const size_t capacity = queue.capacity();
+
+    // Steady state: every consumed front page is reused at the back
+    int next_pop = 0;
+    for (int i = 64; i < 10000; ++i)
+    {
+        queue.push_back(i);
+        EXPECT_EQ(queue.front(), next_pop);
+        queue.pop_front();
+        ++next_pop;
+    }
+    EXPECT_EQ(queue.size(), 64);
+    EXPECT_LE(queue.capacity(), capacity + 16);
+    EXPECT_EQ(queue.front(), 10000 - 64);
+    EXPECT_EQ(queue.back(), 9999);
+}
+
+TEST_F(ChunkedDequeTest, StableReferences)
+{
+    chunked_deque<int, 4> deque;
+    deque.push_back(1);
+    int* first = &deque.front();
+    for (int i = 0; i < 100; ++i)
+    {
+        deque.push_back(i);
+        deque.push_front(-i);
+    }
+    EXPECT_EQ(*first, 1);
+    EXPECT_EQ(&deque[100], first);
+}
+
+TEST_F(ChunkedDequeTest, PushFrontReusesSparePages)
+{
+    chunked_deque<int, 4> deque;
+    for (int i = 0; i < 12; ++i)
+    {
+        deque.push_back(i);
+    }
+    while (deque.size() > 2)
+    {
+        deque.pop_back();
+    }
+    const size_t capacity = deque.capacity();
+
+    for (int i = 0; i < 8; ++i)
+    {
+        deque.push_front(-i);
+    }
+    EXPECT_EQ(deque.capacity(), capacity);
+    EXPECT_EQ(deque.front(), -7);
+    EXPECT_EQ(deque.back(), 1);
+}
+
+TEST_F(ChunkedDequeTest, ClearAndShrinkToFit)
+{
+    chunked_deque<int, 4> deque;
+    for (int i = 0; i < 10; ++i)
+    {
+        deque.push_front(i);
+    }
+    deque.clear();
+    EXPECT_TRUE(deque.empty());
+    EXPECT_GE(deque.capacity(), 12);
+
+    deque.push_back(5);
+    deque.shrink_to_fit();
+    EXPECT_EQ(deque.capacity(), 4);
+    EXPECT_EQ(deque.front(), 5);
+
+    deque.pop_back();
+    deque.shrink_to_fit();
+    EXPECT_EQ(deque.capacity(), 0);
+    deque.push_front(1);
+    EXPECT_EQ(deque.back(), 1);
+}
+
+TEST_F(ChunkedDequeTest, CopyAndMoveSemantics)
+{
+    chunked_deque<std::string, 4> deque;
+    for (int i = 0; i < 9; ++i)
+    {
+        deque.push_front(std::to_string(i));
+    }
+
+    chunked_deque<std::string, 4> copy(deque);
+    EXPECT_EQ(copy.size(), 9);
+    EXPECT_EQ(copy.front(), "8");
+    EXPECT_EQ(copy.back(), "0");
+
+    chunked_deque<std::string, 4> moved(std::move(copy));
+    EXPECT_TRUE(copy.empty());
+    EXPECT_EQ(moved[4], "4");
+
+    chunked_deque<std::string, 4> assigned{"old"};
+    assigned = deque;
+    EXPECT_EQ(assigned.size(), 9);
+    assigned = std::move(moved);
+    EXPECT_EQ(assigned.front(), "8");
+    assigned = assigned;
+    EXPECT_EQ(assigned.size(), 9);
+}
+
+TEST_F(ChunkedDequeTest, ObjectLifetimesBalanced)
+{
+    {
+        chunked_deque<TestObject, 4> deque;
+        for (int i = 0; i < 20; ++i)
+        {
+            deque.emplace_back(i);
+            deque.emplace_front(-i);
+        }
+        for (int i = 0; i < 7; ++i)
+        {
+            deque.pop_front();
+            deque.pop_back();
+        }
+        auto copy = deque;
+        copy.clear();
+    }
+    EXPECT_EQ(TestObject::constructor_calls + TestObject::copy_calls + TestObject::move_calls, TestObject::destructor_calls);
+}
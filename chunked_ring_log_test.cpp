@@ -0,0 +1,202 @@
+#include "chunked_vector/chunked_ring_log.h"
+#include "test_common.h"
+#include <gtest/gtest.h>
+#include <set>
+#include <string>
+
+using namespace dod;
+
+class ChunkedRingLogTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        TestObject::constructor_calls = 0;
+        TestObject::destructor_calls = 0;
+        TestObject::copy_calls = 0;
+        TestObject::move_calls = 0;
+    }
+    void TearDown() override {}
+};
+
+// ============================================================================
+// Sequence Numbers
+// ============================================================================
+
+TEST_F(ChunkedRingLogTest, AppendReturnsMonotonicSequenceNumbers)
+{
+    chunked_ring_log<int, 4> log(10);
+    EXPECT_TRUE(log.empty());
+    EXPECT_EQ(log.retention(), 10);
+    EXPECT_EQ(log.capacity(), 16); // 3 pages for the retention window + 1 tail page
+
+    for (int i = 0; i < 10; ++i)
+    {
+        EXPECT_EQ(log.push_back(i * 10), static_cast<uint64_t>(i));
+    }
+    EXPECT_EQ(log.size(), 10);
+    EXPECT_EQ(log.first_sequence(), 0u);
+    EXPECT_EQ(log.next_sequence(), 10u);
+    EXPECT_EQ(log[3], 30);
+    EXPECT_EQ(log.front(), 0);
+    EXPECT_EQ(log.back(), 90);
+}
+
+TEST_F(ChunkedRingLogTest, DropsWholePagesWhenRetentionExceeded)
+{
+    chunked_ring_log<int, 4> log(10);
+    for (int i = 0; i < 16; ++i)
+    {
+        log.push_back(i);
+    }
+    EXPECT_EQ(log.first_sequence(), 0u);
+
+    // The 17th entry needs a new page: the oldest one is dropped and reused
+    log.push_back(16);
+    EXPECT_EQ(log.first_sequence(), 4u);
+    EXPECT_EQ(log.size(), 13);
+    EXPECT_FALSE(log.contains(3));
+    EXPECT_TRUE(log.contains(4));
+    EXPECT_EQ(log.get(3), nullptr);
+    EXPECT_EQ(*log.get(16), 16);
+    EXPECT_THROW((void)log.at(3), std::out_of_range);
+    EXPECT_THROW((void)log.at(17), std::out_of_range);
+
+    for (int i = 17; i < 1000; ++i)
+    {
+        log.push_back(i);
+        EXPECT_GE(log.size(), log.retention());
+        EXPECT_LE(log.size(), log.capacity());
+    }
+    for (uint64_t seq = log.first_sequence(); seq < log.next_sequence(); ++seq)
+    {
+        EXPECT_EQ(log[seq], static_cast<int>(seq));
+    }
+}
+
+TEST_F(ChunkedRingLogTest, MemoryStaysFixedAndEntriesDoNotMove)
+{
+    chunked_ring_log<int, 4> log(8);
+    for (int i = 0; i < 12; ++i)
+    {
+        log.push_back(i);
+    }
+    const int* oldest_retained = log.get(4);
+    const int* newest = log.get(11);
+
+    // The ring holds 3 pages, so appending 4 more entries drops page 0 and reuses it
+    for (int i = 12; i < 16; ++i)
+    {
+        log.push_back(i);
+    }
+    EXPECT_EQ(log.get(4), oldest_retained);
+    EXPECT_EQ(log.get(11), newest);
+    EXPECT_EQ(*log.get(4), 4);
+
+    std::set<const int*> page_starts;
+    for (int round = 0; round < 10; ++round)
+    {
+        const uint64_t seq = log.push_back(100 + round);
+        page_starts.insert(log.get(seq - (seq % 4)));
+    }
+    EXPECT_LE(page_starts.size(), 3u);
+}
+
+TEST_F(ChunkedRingLogTest, CustomFirstSequence)
+{
+    const uint64_t start = (uint64_t(1) << 40) + 3;
+    chunked_ring_log<std::string, 4> log(4, start);
+    EXPECT_EQ(log.push_back("a"), start);
+    EXPECT_EQ(log.push_back("b"), start + 1);
+    EXPECT_EQ(log[start + 1], "b");
+    EXPECT_FALSE(log.contains(start - 1));
+}
+
+// ============================================================================
+// Iteration and Container Operations
+// ============================================================================
+
+TEST_F(ChunkedRingLogTest, IterationVisitsRetainedEntriesInOrder)
+{
+    chunked_ring_log<int, 4> log(6);
+    for (int i = 0; i < 23; ++i)
+    {
+        log.push_back(i);
+    }
+
+    uint64_t expected = log.first_sequence();
+    for (auto it = log.cbegin(); it != log.cend(); ++it)
+    {
+        EXPECT_EQ(it.sequence(), expected);
+        EXPECT_EQ(*it, static_cast<int>(expected));
+        ++expected;
+    }
+    EXPECT_EQ(expected, log.next_sequence());
+
+    for (int& value : log)
+    {
+        value = -value;
+    }
+    EXPECT_EQ(log.back(), -22);
+}
+
+TEST_F(ChunkedRingLogTest, ClearKeepsSequenceCounting)
+{
+    chunked_ring_log<std::string, 4> log(4);
+    for (int i = 0; i < 7; ++i)
+    {
+        log.push_back(std::to_string(i));
+    }
+    log.clear();
+    EXPECT_TRUE(log.empty());
+    EXPECT_FALSE(log.contains(6));
+    EXPECT_EQ(log.first_sequence(), 7u);
+
+    EXPECT_EQ(log.push_back("x"), 7u);
+    EXPECT_EQ(log[7], "x");
+    EXPECT_EQ(*log.begin(), "x");
+}
+
+TEST_F(ChunkedRingLogTest, CopyAndMoveSemantics)
+{
+    chunked_ring_log<std::string, 4> log(8);
+    for (int i = 0; i < 30; ++i)
+    {
+        log.push_back(std::to_string(i));
+    }
+
+    chunked_ring_log<std::string, 4> copy(log);
+    EXPECT_EQ(copy.first_sequence(), log.first_sequence());
+    EXPECT_EQ(copy.next_sequence(), 30u);
+    EXPECT_EQ(copy[29], "29");
+    copy.push_back("30");
+    EXPECT_EQ(copy[30], "30");
+    EXPECT_FALSE(log.contains(30));
+
+    chunked_ring_log<std::string, 4> moved(std::move(copy));
+    EXPECT_TRUE(copy.empty());
+    EXPECT_EQ(moved[30], "30");
+
+    chunked_ring_log<std::string, 4> assigned(2);
+    assigned.push_back("old");
+    assigned = log;
+    EXPECT_EQ(assigned.retention(), 8);
+    EXPECT_EQ(assigned[25], "25");
+    assigned = std::move(moved);
+    EXPECT_EQ(assigned[30], "30");
+}
+
+TEST_F(ChunkedRingLogTest, ObjectLifetimesBalanced)
+{
+    {
+        chunked_ring_log<TestObject, 4> log(5);
+        for (int i = 0; i < 50; ++i)
+        {
+            log.emplace_back(i);
+        }
+        auto copy = log;
+        copy.clear();
+        copy.emplace_back(1);
+    }
+    EXPECT_EQ(TestObject::constructor_calls + TestObject::copy_calls + TestObject::move_calls, TestObject::destructor_calls);
+}
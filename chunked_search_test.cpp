@@ -0,0 +1,135 @@
+#include "chunked_vector/chunked_search.h"
+#include "test_common.h"
+#include <gtest/gtest.h>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace dod;
+
+class ChunkedSearchTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override {}
+    void TearDown() override {}
+};
+
+template <typename Vector, typename T, typename Compare = std::less<T>>
+void check_against_std(const Vector& vec, const std::vector<T>& sorted, const std::vector<T>& keys, Compare comp = Compare())
+{
+    const auto index = build_fence_index(vec, comp);
+    EXPECT_EQ(index.page_count(), vec.segment_count());
+    for (const T& key : keys)
+    {
+        const size_t expected_lower = static_cast<size_t>(std::lower_bound(sorted.begin(), sorted.end(), key, comp) - sorted.begin());
+        const size_t expected_upper = static_cast<size_t>(std::upper_bound(sorted.begin(), sorted.end(), key, comp) - sorted.begin());
+        EXPECT_EQ(dod::lower_bound(vec, key, comp), expected_lower) << "key " << key;
+        EXPECT_EQ(dod::upper_bound(vec, key, comp), expected_upper) << "key " << key;
+        EXPECT_EQ(dod::lower_bound(vec, index, key), expected_lower) << "key " << key;
+        EXPECT_EQ(dod::upper_bound(vec, index, key), expected_upper) << "key " << key;
+    }
+}
+
+// ============================================================================
+// Search Results
+// ============================================================================
+
+TEST_F(ChunkedSearchTest, EmptyVector)
+{
+    chunked_vector<int, 4> vec;
+    EXPECT_EQ(dod::lower_bound(vec, 5), 0u);
+    EXPECT_EQ(dod::upper_bound(vec, 5), 0u);
+
+    const auto index = build_fence_index(vec);
+    EXPECT_EQ(index.page_count(), 0u);
+    EXPECT_EQ(dod::lower_bound(vec, index, 5), 0u);
+}
+
+/// @brief Search every key of every size up to 70 elements in vectors of type Vector
+template <typename Vector> void check_every_key_for_every_size()
+{
+    // Sizes cover partial last pages and page counts that are not 2^k - 1 (incomplete Eytzinger trees)
+    for (int count = 1; count <= 70; ++count)
+    {
+        Vector vec;
+        std::vector<int> sorted;
+        std::vector<int> keys;
+        for (int i = 0; i < count; ++i)
+        {
+            vec.push_back(i * 2);
+            sorted.push_back(i * 2);
+        }
+        for (int key = -1; key <= count * 2; ++key)
+        {
+            keys.push_back(key);
+        }
+        check_against_std(vec, sorted, keys);
+    }
+}
+
+TEST_F(ChunkedSearchTest, EveryKeyForEverySize) { check_every_key_for_every_size<chunked_vector<int, 4>>(); }
+
+TEST_F(ChunkedSearchTest, DuplicateKeysAcrossPages)
+{
+    chunked_vector<int, 4> vec{1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 5};
+    std::vector<int> sorted(vec.begin(), vec.end());
+    check_against_std(vec, sorted, {0, 1, 2, 3, 4, 5, 6});
+    EXPECT_EQ(dod::lower_bound(vec, 2), 1u);
+    EXPECT_EQ(dod::upper_bound(vec, 2), 10u);
+}
+
+TEST_F(ChunkedSearchTest, CustomCompareAndLargeRandom)
+{
+    std::mt19937 rng(17);
+    std::vector<int64_t> sorted(5000);
+    for (auto& value : sorted)
+    {
+        value = static_cast<int64_t>(rng() % 20000);
+    }
+    std::sort(sorted.begin(), sorted.end(), std::greater<int64_t>());
+
+    chunked_vector<int64_t, 64> vec;
+    for (int64_t value : sorted)
+    {
+        vec.push_back(value);
+    }
+    std::vector<int64_t> keys;
+    for (int i = 0; i < 500; ++i)
+    {
+        keys.push_back(static_cast<int64_t>(rng() % 20100) - 50);
+    }
+    check_against_std(vec, sorted, keys, std::greater<int64_t>());
+
+    // Key type converts to the element type
+    EXPECT_EQ(dod::lower_bound(vec, 30000, std::greater<int64_t>()), 0u);
+}
+
+TEST_F(ChunkedSearchTest, RebuildAfterMutation)
+{
+    chunked_vector<std::string, 2> vec{"b", "d", "f", "h", "j"};
+    auto index = build_fence_index(vec);
+    EXPECT_EQ(dod::lower_bound(vec, index, std::string("e")), 2u);
+
+    // Still sorted after mutation, but the first key of page 1 changed
+    vec[2] = "e";
+    index = build_fence_index(vec);
+    EXPECT_EQ(dod::lower_bound(vec, index, std::string("e")), 2u);
+    EXPECT_EQ(dod::upper_bound(vec, index, std::string("e")), 3u);
+
+    fence_index<std::string, 2> copy(index);
+    EXPECT_EQ(dod::lower_bound(vec, copy, std::string("i")), 4u);
+    fence_index<std::string, 2> moved(std::move(copy));
+    EXPECT_EQ(dod::lower_bound(vec, moved, std::string("a")), 0u);
+    copy = moved;
+    EXPECT_EQ(copy.page_count(), 3u);
+}
+
+// ============================================================================
+// Vector Template Parameters
+// ============================================================================
+
+TEST_F(ChunkedSearchTest, SmallFirstPage) { check_every_key_for_every_size<chunked_vector<int, 16, 2>>(); }
+
+TEST_F(ChunkedSearchTest, InlineCapacity) { check_every_key_for_every_size<chunked_vector<int, 16, 16, 4>>(); }
+
+TEST_F(ChunkedSearchTest, CompactSizeType) { check_every_key_for_every_size<chunked_vector<int, 16, 16, 0, uint16_t>>(); }
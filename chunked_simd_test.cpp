@@ -0,0 +1,233 @@
+#include "chunked_vector/chunked_simd.h"
+#include "test_common.h"
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <random>
+#include <vector>
+
+using namespace dod;
+
+class ChunkedSimdTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override { previous_limit = simd::set_level_limit(simd::level::avx512); }
+    void TearDown() override { simd::set_level_limit(previous_limit); }
+
+    /// @brief Every level this CPU can run, from scalar up to the detected one
+    static std::vector<simd::level> runnable_levels()
+    {
+        std::vector<simd::level> levels;
+        for (simd::level lvl : {simd::level::scalar, simd::level::sse2, simd::level::avx2, simd::level::avx512})
+        {
+            if (lvl <= simd::detected_level())
+            {
+                levels.push_back(lvl);
+            }
+        }
+        return levels;
+    }
+
+    simd::level previous_limit = simd::level::avx512;
+};
+
+// Small integer-valued inputs keep float sums and dot products exact regardless of the summation order
+template <typename T> std::vector<T> make_values(size_t count, uint32_t seed)
+{
+    std::mt19937 rng(seed);
+    std::vector<T> values(count);
+    for (T& value : values)
+    {
+        if constexpr (std::is_same_v<T, uint8_t>)
+        {
+            value = static_cast<T>(rng() & 0xFF);
+        }
+        else
+        {
+            value = static_cast<T>(static_cast<int>(rng() % 41) - 20);
+        }
+    }
+    return values;
+}
+
+template <typename Vector, typename T> Vector make_vector(const std::vector<T>& values)
+{
+    Vector vec;
+    vec.reserve(values.size());
+    for (const T& value : values)
+    {
+        vec.push_back(value);
+    }
+    return vec;
+}
+
+template <typename Vector, typename T> void check_kernels(const std::vector<T>& values, const std::vector<T>& other)
+{
+    const Vector vec = make_vector<Vector>(values);
+    const Vector vec_other = make_vector<Vector>(other);
+
+    for (T needle : {values.empty() ? T(0) : values.back(), T(7), T(100)})
+    {
+        const size_t expected_find = static_cast<size_t>(std::find(values.begin(), values.end(), needle) - values.begin());
+        EXPECT_EQ(simd::find(vec, needle), expected_find);
+        EXPECT_EQ(simd::count(vec, needle), static_cast<size_t>(std::count(values.begin(), values.end(), needle)));
+    }
+
+    EXPECT_EQ(simd::min_element(vec), static_cast<size_t>(std::min_element(values.begin(), values.end()) - values.begin()));
+    EXPECT_EQ(simd::max_element(vec), static_cast<size_t>(std::max_element(values.begin(), values.end()) - values.begin()));
+
+    simd::sum_result_t<T> expected_sum = 0;
+    simd::sum_result_t<T> expected_dot = 0;
+    for (size_t i = 0; i < values.size(); ++i)
+    {
+        expected_sum += static_cast<simd::sum_result_t<T>>(values[i]);
+        expected_dot += static_cast<simd::sum_result_t<T>>(values[i]) * static_cast<simd::sum_result_t<T>>(other[i]);
+    }
+    EXPECT_EQ(simd::sum(vec), expected_sum);
+    EXPECT_EQ(simd::dot(vec, vec_other), expected_dot);
+}
+
+template <typename T> void check_all_sizes(const std::vector<simd::level>& levels)
+{
+    for (simd::level lvl : levels)
+    {
+        simd::set_level_limit(lvl);
+        EXPECT_EQ(simd::active_level(), lvl);
+        // Empty, shorter than one vector, partial tails and several pages
+        for (size_t count : {0u, 1u, 3u, 15u, 64u, 65u, 255u, 256u, 1000u, 4099u})
+        {
+            SCOPED_TRACE(::testing::Message() << "level " << static_cast<int>(lvl) << " count " << count);
+            const std::vector<T> values = make_values<T>(count, static_cast<uint32_t>(count));
+            const std::vector<T> other = make_values<T>(count, static_cast<uint32_t>(count) + 1);
+            check_kernels<chunked_vector<T, 256>>(values, other);
+            check_kernels<chunked_vector<T, 100>>(values, other);
+        }
+    }
+}
+
+/// @brief Kernels on vectors of type Vector, at the active level
+template <typename Vector> void check_vector_sizes()
+{
+    using T = typename Vector::value_type;
+    for (size_t count : {0u, 1u, 3u, 15u, 64u, 65u, 255u, 256u, 1000u})
+    {
+        SCOPED_TRACE(::testing::Message() << "count " << count);
+        check_kernels<Vector>(make_values<T>(count, static_cast<uint32_t>(count)), make_values<T>(count, static_cast<uint32_t>(count) + 1));
+    }
+}
+
+// ============================================================================
+// Kernels Against std Algorithms
+// ============================================================================
+
+TEST_F(ChunkedSimdTest, Float) { check_all_sizes<float>(runnable_levels()); }
+
+TEST_F(ChunkedSimdTest, Int32) { check_all_sizes<int32_t>(runnable_levels()); }
+
+TEST_F(ChunkedSimdTest, Int64) { check_all_sizes<int64_t>(runnable_levels()); }
+
+TEST_F(ChunkedSimdTest, UInt8) { check_all_sizes<uint8_t>(runnable_levels()); }
+
+TEST_F(ChunkedSimdTest, TypesWithoutVectorKernelsUseScalarPath) { check_all_sizes<double>(runnable_levels()); }
+
+// ============================================================================
+// Edge Cases
+// ============================================================================
+
+TEST_F(ChunkedSimdTest, FirstMatchAndFirstExtremeWin)
+{
+    for (simd::level lvl : runnable_levels())
+    {
+        simd::set_level_limit(lvl);
+        chunked_vector<int32_t, 64> vec(300, 5);
+        vec[70] = -1;
+        vec[71] = 9;
+        vec[200] = -1;
+        vec[250] = 9;
+        EXPECT_EQ(simd::find(vec, -1), 70u);
+        EXPECT_EQ(simd::count(vec, 9), 2u);
+        EXPECT_EQ(simd::min_element(vec), 70u);
+        EXPECT_EQ(simd::max_element(vec), 71u);
+    }
+}
+
+TEST_F(ChunkedSimdTest, ExtremeIntegerValues)
+{
+    for (simd::level lvl : runnable_levels())
+    {
+        simd::set_level_limit(lvl);
+        chunked_vector<int64_t, 64> vec(200, 0);
+        vec[3] = std::numeric_limits<int64_t>::min();
+        vec[150] = std::numeric_limits<int64_t>::max();
+        EXPECT_EQ(simd::min_element(vec), 3u);
+        EXPECT_EQ(simd::max_element(vec), 150u);
+        EXPECT_EQ(simd::sum(vec), -1);
+
+        chunked_vector<int32_t, 64> wide(100, std::numeric_limits<int32_t>::max());
+        EXPECT_EQ(simd::sum(wide), int64_t(std::numeric_limits<int32_t>::max()) * 100);
+        chunked_vector<int32_t, 64> lowest(100, std::numeric_limits<int32_t>::min());
+        chunked_vector<int32_t, 64> threes(100, 3);
+        EXPECT_EQ(simd::dot(wide, threes), int64_t(std::numeric_limits<int32_t>::max()) * 300);
+        EXPECT_EQ(simd::dot(lowest, threes), int64_t(std::numeric_limits<int32_t>::min()) * 300);
+
+        chunked_vector<uint8_t, 1024> bytes(5000, 255);
+        EXPECT_EQ(simd::sum(bytes), 255u * 5000u);
+        EXPECT_EQ(simd::dot(bytes, bytes), 255u * 255u * 5000u);
+    }
+}
+
+TEST_F(ChunkedSimdTest, EmptyVectorReturnsSize)
+{
+    chunked_vector<float, 64> vec;
+    EXPECT_EQ(simd::find(vec, 1.0f), 0u);
+    EXPECT_EQ(simd::count(vec, 1.0f), 0u);
+    EXPECT_EQ(simd::min_element(vec), 0u);
+    EXPECT_EQ(simd::max_element(vec), 0u);
+    EXPECT_EQ(simd::sum(vec), 0.0f);
+}
+
+TEST_F(ChunkedSimdTest, LevelLimitIsClampedToDetected)
+{
+    EXPECT_EQ(simd::active_level(), simd::detected_level());
+    EXPECT_EQ(simd::set_level_limit(simd::level::scalar), simd::level::avx512);
+    EXPECT_EQ(simd::active_level(), simd::level::scalar);
+}
+
+// ============================================================================
+// Histogram
+// ============================================================================
+
+TEST_F(ChunkedSimdTest, Histogram)
+{
+    const std::vector<uint8_t> values = make_values<uint8_t>(10007, 42);
+    const chunked_vector<uint8_t, 512> vec = make_vector<chunked_vector<uint8_t, 512>>(values);
+    std::array<uint64_t, 256> expected{};
+    for (uint8_t value : values)
+    {
+        ++expected[value];
+    }
+    EXPECT_EQ(simd::histogram(vec), expected);
+
+    chunked_vector<uint8_t, 512> empty;
+    EXPECT_EQ(simd::histogram(empty), (std::array<uint64_t, 256>{}));
+}
+
+// ============================================================================
+// Vector Template Parameters
+// ============================================================================
+
+TEST_F(ChunkedSimdTest, SmallFirstPage) { check_vector_sizes<chunked_vector<int32_t, 256, 8>>(); }
+
+TEST_F(ChunkedSimdTest, InlineCapacity) { check_vector_sizes<chunked_vector<float, 256, 256, 16>>(); }
+
+TEST_F(ChunkedSimdTest, CompactSizeType)
+{
+    check_vector_sizes<chunked_vector<int64_t, 256, 256, 0, uint32_t>>();
+
+    const std::vector<uint8_t> values = make_values<uint8_t>(1000, 5);
+    std::array<uint64_t, 256> expected{};
+    for (uint8_t value : values)
+    {
+        ++expected[value];
+    }
+    EXPECT_EQ(simd::histogram(make_vector<chunked_vector<uint8_t, 64, 64, 0, uint16_t>>(values)), expected);
+}
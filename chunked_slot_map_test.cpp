@@ -0,0 +1,332 @@
+#include "chunked_vector/chunked_slot_map.h"
+#include "test_common.h"
+#include <gtest/gtest.h>
+#include <set>
+#include <string>
+
+using namespace dod;
+
+class ChunkedSlotMapTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        TestObject::constructor_calls = 0;
+        TestObject::destructor_calls = 0;
+        TestObject::copy_calls = 0;
+        TestObject::move_calls = 0;
+    }
+    void TearDown() override {}
+};
+
+// ============================================================================
+// Handles
+// ============================================================================
+
+TEST_F(ChunkedSlotMapTest, InsertAndLookup)
+{
+    chunked_slot_map<std::string, 4> map;
+    EXPECT_TRUE(map.empty());
+
+    auto a = map.insert("a");
+    auto b = map.emplace(3, 'b');
+    EXPECT_EQ(map.size(), 2);
+    EXPECT_EQ(map.capacity(), 4);
+
+    EXPECT_TRUE(map.contains(a));
+    EXPECT_EQ(map[a], "a");
+    EXPECT_EQ(map.at(b), "bbb");
+    EXPECT_EQ(*map.get(b), "bbb");
+
+    const auto& const_map = map;
+    EXPECT_EQ(const_map[a], "a");
+    EXPECT_EQ(*const_map.get(a), "a");
+
+    // Null handles never match
+    chunked_slot_map<std::string, 4>::handle null_handle;
+    EXPECT_TRUE(null_handle.is_null());
+    EXPECT_FALSE(map.contains(null_handle));
+    EXPECT_EQ(map.get(null_handle), nullptr);
+    EXPECT_THROW((void)map.at(null_handle), std::out_of_range);
+
+    // Handles round-trip through their 64-bit value
+    chunked_slot_map<std::string, 4>::handle copy(b.value());
+    EXPECT_EQ(copy, b);
+    EXPECT_EQ(map[copy], "bbb");
+}
+
+TEST_F(ChunkedSlotMapTest, EraseMakesHandleStale)
+{
+    chunked_slot_map<int, 4> map;
+    auto h = map.insert(1);
+    EXPECT_TRUE(map.erase(h));
+    EXPECT_FALSE(map.erase(h));
+    EXPECT_FALSE(map.contains(h));
+    EXPECT_EQ(map.get(h), nullptr);
+    EXPECT_THROW((void)map.at(h), std::out_of_range);
+    EXPECT_TRUE(map.empty());
+
+    // The slot is reused with a new generation
+    auto reused = map.insert(2);
+    EXPECT_EQ(reused.index(), h.index());
+    EXPECT_NE(reused.generation(), h.generation());
+    EXPECT_FALSE(map.contains(h));
+    EXPECT_EQ(map[reused], 2);
+
+    // Handles pointing past the allocated pages are rejected
+    chunked_slot_map<int, 4>::handle out_of_range(1000, 1);
+    EXPECT_FALSE(map.contains(out_of_range));
+}
+
+TEST_F(ChunkedSlotMapTest, EraseDoesNotMoveElements)
+{
+    chunked_slot_map<int, 4> map;
+    std::vector<chunked_slot_map<int, 4>::handle> handles;
+    std::vector<const int*> addresses;
+    for (int i = 0; i < 10; ++i)
+    {
+        handles.push_back(map.insert(i));
+        addresses.push_back(map.get(handles.back()));
+    }
+
+    for (int i = 0; i < 10; i += 3)
+    {
+        EXPECT_TRUE(map.erase(handles[i]));
+    }
+    EXPECT_EQ(map.size(), 6);
+
+    for (int i = 0; i < 10; ++i)
+    {
+        if (i % 3 == 0)
+        {
+            EXPECT_FALSE(map.contains(handles[i]));
+        }
+        else
+        {
+            EXPECT_EQ(map.get(handles[i]), addresses[i]);
+            EXPECT_EQ(map[handles[i]], i);
+        }
+    }
+
+    // Erased slots are reused before any new page is allocated
+    const size_t capacity = map.capacity();
+    std::set<uint32_t> erased_indices = {handles[0].index(), handles[3].index(), handles[6].index(), handles[9].index()};
+    std::set<uint32_t> reused_indices;
+    for (int i = 0; i < 4; ++i)
+    {
+        reused_indices.insert(map.insert(100 + i).index());
+    }
+    EXPECT_EQ(reused_indices, erased_indices);
+    EXPECT_EQ(map.capacity(), capacity);
+}
+
+// ============================================================================
+// Iteration
+// ============================================================================
+
+TEST_F(ChunkedSlotMapTest, IterationSkipsHoles)
+{
+    chunked_slot_map<int, 128> map;
+    std::vector<chunked_slot_map<int, 128>::handle> handles;
+    for (int i = 0; i < 300; ++i)
+    {
+        handles.push_back(map.insert(i));
+    }
+
+    // Leave whole 64-slot words and a whole page empty
+    for (int i = 0; i < 300; ++i)
+    {
+        if ((i >= 64 && i < 200) || i % 5 == 0)
+        {
+            map.erase(handles[i]);
+        }
+    }
+
+    int expected_count = 0;
+    long long expected_sum = 0;
+    for (int i = 0; i < 300; ++i)
+    {
+        if (!((i >= 64 && i < 200) || i % 5 == 0))
+        {
+            ++expected_count;
+            expected_sum += i;
+        }
+    }
+
+    int count = 0;
+    long long sum = 0;
+    for (int value : map)
+    {
+        ++count;
+        sum += value;
+    }
+    EXPECT_EQ(count, expected_count);
+    EXPECT_EQ(sum, expected_sum);
+    EXPECT_EQ(static_cast<size_t>(count), map.size());
+
+    // Iterator handles point back at the same element
+    for (auto it = map.cbegin(); it != map.cend(); ++it)
+    {
+        auto h = map.handle_of(it);
+        EXPECT_EQ(map[h], *it);
+    }
+}
+
+TEST_F(ChunkedSlotMapTest, EraseWhileIterating)
+{
+    chunked_slot_map<int, 8> map;
+    for (int i = 0; i < 30; ++i)
+    {
+        map.insert(i);
+    }
+
+    for (auto it = map.begin(); it != map.end();)
+    {
+        if (*it % 2 == 0)
+        {
+            it = map.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+
+    EXPECT_EQ(map.size(), 15);
+    for (int value : map)
+    {
+        EXPECT_EQ(value % 2, 1);
+    }
+}
+
+TEST_F(ChunkedSlotMapTest, EmptyIteration)
+{
+    chunked_slot_map<int, 8> map;
+    EXPECT_EQ(map.begin(), map.end());
+
+    auto h = map.insert(1);
+    map.erase(h);
+    EXPECT_EQ(map.begin(), map.end());
+}
+
+// ============================================================================
+// Container Operations
+// ============================================================================
+
+TEST_F(ChunkedSlotMapTest, ClearInvalidatesAllHandles)
+{
+    chunked_slot_map<int, 4> map;
+    std::vector<chunked_slot_map<int, 4>::handle> handles;
+    for (int i = 0; i < 10; ++i)
+    {
+        handles.push_back(map.insert(i));
+    }
+    map.clear();
+
+    EXPECT_TRUE(map.empty());
+    EXPECT_EQ(map.capacity(), 12);
+    for (const auto& h : handles)
+    {
+        EXPECT_FALSE(map.contains(h));
+    }
+
+    // Reuses the existing pages
+    for (int i = 0; i < 12; ++i)
+    {
+        map.insert(i);
+    }
+    EXPECT_EQ(map.capacity(), 12);
+    for (const auto& h : handles)
+    {
+        EXPECT_FALSE(map.contains(h));
+    }
+}
+
+TEST_F(ChunkedSlotMapTest, ReserveFillsLowPagesFirst)
+{
+    chunked_slot_map<int, 4> map;
+    map.reserve(10);
+    EXPECT_EQ(map.capacity(), 12);
+
+    auto first = map.insert(0);
+    EXPECT_EQ(first.index(), 0u);
+    for (int i = 1; i < 12; ++i)
+    {
+        map.insert(i);
+    }
+    EXPECT_EQ(map.capacity(), 12);
+    map.insert(12);
+    EXPECT_EQ(map.capacity(), 16);
+}
+
+TEST_F(ChunkedSlotMapTest, CopyKeepsHandlesValid)
+{
+    chunked_slot_map<std::string, 4> map;
+    std::vector<chunked_slot_map<std::string, 4>::handle> handles;
+    for (int i = 0; i < 9; ++i)
+    {
+        handles.push_back(map.insert(std::to_string(i)));
+    }
+    map.erase(handles[2]);
+
+    chunked_slot_map<std::string, 4> copy(map);
+    EXPECT_EQ(copy.size(), 8);
+    EXPECT_FALSE(copy.contains(handles[2]));
+    EXPECT_EQ(copy[handles[7]], "7");
+
+    // Both maps reuse the same free slot independently
+    auto in_copy = copy.insert("x");
+    auto in_map = map.insert("y");
+    EXPECT_EQ(in_copy, in_map);
+    EXPECT_EQ(copy[in_copy], "x");
+    EXPECT_EQ(map[in_map], "y");
+
+    chunked_slot_map<std::string, 4> moved(std::move(copy));
+    EXPECT_TRUE(copy.empty());
+    EXPECT_EQ(moved[handles[0]], "0");
+
+    chunked_slot_map<std::string, 4> assigned;
+    assigned.insert("old");
+    assigned = map;
+    EXPECT_EQ(assigned[handles[8]], "8");
+    assigned = std::move(moved);
+    EXPECT_EQ(assigned[in_copy], "x");
+}
+
+TEST_F(ChunkedSlotMapTest, TriviallyCopyableCopy)
+{
+    chunked_slot_map<int, 4> map;
+    auto a = map.insert(1);
+    auto b = map.insert(2);
+    map.erase(a);
+
+    chunked_slot_map<int, 4> copy = map;
+    EXPECT_FALSE(copy.contains(a));
+    EXPECT_EQ(copy[b], 2);
+    int count = 0;
+    for (int value : copy)
+    {
+        EXPECT_EQ(value, 2);
+        ++count;
+    }
+    EXPECT_EQ(count, 1);
+}
+
+TEST_F(ChunkedSlotMapTest, ObjectLifetimesBalanced)
+{
+    {
+        chunked_slot_map<TestObject, 4> map;
+        std::vector<chunked_slot_map<TestObject, 4>::handle> handles;
+        for (int i = 0; i < 10; ++i)
+        {
+            handles.push_back(map.emplace(i));
+        }
+        map.erase(handles[1]);
+        map.erase(handles[5]);
+        auto copy = map;
+        map.insert(TestObject(42));
+        copy.clear();
+        copy.emplace(7);
+    }
+    EXPECT_EQ(TestObject::constructor_calls + TestObject::copy_calls + TestObject::move_calls, TestObject::destructor_calls);
+}
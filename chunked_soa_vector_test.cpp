@@ -0,0 +1,217 @@
+#include "chunked_vector/chunked_soa_vector.h"
+#include "test_common.h"
+#include <gtest/gtest.h>
+#include <numeric>
+#include <string>
+
+using namespace dod;
+
+class ChunkedSoaVectorTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        TestObject::constructor_calls = 0;
+        TestObject::destructor_calls = 0;
+        TestObject::copy_calls = 0;
+        TestObject::move_calls = 0;
+    }
+    void TearDown() override {}
+};
+
+// ============================================================================
+// Page Layout
+// ============================================================================
+
+TEST_F(ChunkedSoaVectorTest, ColumnsAreContiguousAndAligned)
+{
+    basic_chunked_soa_vector<16, float, double, char> vec;
+    for (int i = 0; i < 40; ++i)
+    {
+        vec.emplace_back(static_cast<float>(i), static_cast<double>(i) * 2.0, static_cast<char>('a' + i % 26));
+    }
+
+    EXPECT_EQ(vec.segment_count(), 3);
+    EXPECT_EQ(vec.capacity(), 48);
+
+    for (size_t segment_idx = 0; segment_idx < vec.segment_count(); ++segment_idx)
+    {
+        auto positions = vec.segment<0>(segment_idx);
+        auto velocities = vec.segment<1>(segment_idx);
+        EXPECT_EQ(positions.size, segment_idx < 2 ? 16u : 8u);
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(positions.data) % 64, 0u);
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(velocities.data) % 64, 0u);
+
+        // Elements of one column inside a page are adjacent
+        EXPECT_EQ(&vec.get<0>(segment_idx * 16 + 1), positions.data + 1);
+    }
+
+    // All columns of a page come from the same allocation: the second column follows the first one
+    auto first = vec.segment<0>(0);
+    auto second = vec.segment<1>(0);
+    EXPECT_GE(reinterpret_cast<char*>(second.data), reinterpret_cast<char*>(first.data + 16));
+    EXPECT_LT(reinterpret_cast<char*>(second.data), reinterpret_cast<char*>(first.data + 16) + 64);
+}
+
+TEST_F(ChunkedSoaVectorTest, NonPowerOfTwoPageSize)
+{
+    basic_chunked_soa_vector<10, int, short> vec;
+    for (int i = 0; i < 25; ++i)
+    {
+        vec.push_back({i, static_cast<short>(-i)});
+    }
+    EXPECT_EQ(vec.segment_count(), 3);
+    EXPECT_EQ(vec.segment<1>(2).size, 5u);
+    EXPECT_EQ(vec.get<0>(24), 24);
+    EXPECT_EQ(vec.get<1>(13), -13);
+}
+
+// ============================================================================
+// Element Access
+// ============================================================================
+
+TEST_F(ChunkedSoaVectorTest, TupleAndColumnAccess)
+{
+    chunked_soa_vector<int, float> vec{{1, 1.5f}, {2, 2.5f}, {3, 3.5f}};
+    EXPECT_EQ(vec.size(), 3);
+    EXPECT_EQ(vec.column_count(), 2);
+
+    auto [id, weight] = vec[1];
+    EXPECT_EQ(id, 2);
+    EXPECT_FLOAT_EQ(weight, 2.5f);
+
+    // operator[] returns references into the columns
+    std::get<0>(vec[1]) = 20;
+    EXPECT_EQ(vec.get<0>(1), 20);
+    vec.get<1>(2) = 7.0f;
+    EXPECT_FLOAT_EQ(std::get<1>(vec.at(2)), 7.0f);
+
+    const auto& const_vec = vec;
+    EXPECT_EQ(std::get<0>(const_vec[0]), 1);
+    EXPECT_EQ(const_vec.get<0>(1), 20);
+    EXPECT_THROW((void)const_vec.at(3), std::out_of_range);
+    EXPECT_THROW((void)vec.at(3), std::out_of_range);
+}
+
+TEST_F(ChunkedSoaVectorTest, SegmentsCoverAllElements)
+{
+    basic_chunked_soa_vector<64, float, int> vec;
+    for (int i = 0; i < 1000; ++i)
+    {
+        vec.emplace_back(1.0f, i);
+    }
+
+    // Scale one column through its segments without touching the other one
+    for (size_t segment_idx = 0; segment_idx < vec.segment_count(); ++segment_idx)
+    {
+        for (float& value : vec.segment<0>(segment_idx))
+        {
+            value *= 2.0f;
+        }
+    }
+
+    float float_sum = 0.0f;
+    long long int_sum = 0;
+    const auto& const_vec = vec;
+    for (size_t segment_idx = 0; segment_idx < const_vec.segment_count(); ++segment_idx)
+    {
+        auto floats = const_vec.segment<0>(segment_idx);
+        auto ints = const_vec.segment<1>(segment_idx);
+        float_sum = std::accumulate(floats.begin(), floats.end(), float_sum);
+        int_sum = std::accumulate(ints.begin(), ints.end(), int_sum);
+    }
+    EXPECT_FLOAT_EQ(float_sum, 2000.0f);
+    EXPECT_EQ(int_sum, 999LL * 1000 / 2);
+}
+
+// ============================================================================
+// Modifiers
+// ============================================================================
+
+TEST_F(ChunkedSoaVectorTest, ResizeAndPopBack)
+{
+    basic_chunked_soa_vector<4, int, std::string> vec(6);
+    EXPECT_EQ(vec.size(), 6);
+    EXPECT_EQ(vec.get<0>(5), 0);
+    EXPECT_TRUE(vec.get<1>(5).empty());
+
+    vec.resize(11, {7, "seven"});
+    EXPECT_EQ(vec.size(), 11);
+    EXPECT_EQ(vec.get<0>(10), 7);
+    EXPECT_EQ(vec.get<1>(6), "seven");
+
+    vec.pop_back();
+    EXPECT_EQ(vec.size(), 10);
+
+    vec.resize(3);
+    EXPECT_EQ(vec.size(), 3);
+    EXPECT_EQ(vec.capacity(), 12); // pages are kept
+
+    vec.clear();
+    EXPECT_TRUE(vec.empty());
+    EXPECT_EQ(vec.capacity(), 12);
+
+    vec.reserve(20);
+    EXPECT_EQ(vec.capacity(), 20);
+}
+
+TEST_F(ChunkedSoaVectorTest, PushBackMovesColumns)
+{
+    chunked_soa_vector<std::string, int> vec;
+    std::string long_text(100, 'x');
+    vec.push_back({std::move(long_text), 1});
+    EXPECT_EQ(vec.get<0>(0).size(), 100u);
+
+    std::string other(50, 'y');
+    vec.emplace_back(std::move(other), 2);
+    EXPECT_EQ(vec.get<0>(1).size(), 50u);
+    EXPECT_TRUE(other.empty());
+}
+
+TEST_F(ChunkedSoaVectorTest, CopyAndMoveSemantics)
+{
+    basic_chunked_soa_vector<4, int, std::string> vec;
+    for (int i = 0; i < 9; ++i)
+    {
+        vec.emplace_back(i, std::to_string(i));
+    }
+
+    basic_chunked_soa_vector<4, int, std::string> copy(vec);
+    EXPECT_EQ(copy.size(), 9);
+    EXPECT_EQ(copy.get<1>(8), "8");
+    copy.get<0>(0) = 100;
+    EXPECT_EQ(vec.get<0>(0), 0);
+
+    basic_chunked_soa_vector<4, int, std::string> moved(std::move(copy));
+    EXPECT_TRUE(copy.empty());
+    EXPECT_EQ(moved.get<0>(0), 100);
+
+    basic_chunked_soa_vector<4, int, std::string> assigned;
+    assigned.emplace_back(-1, "old");
+    assigned = vec;
+    EXPECT_EQ(assigned.size(), 9);
+    EXPECT_EQ(assigned.get<1>(4), "4");
+
+    assigned = std::move(moved);
+    EXPECT_EQ(assigned.get<0>(0), 100);
+
+    assigned = assigned;
+    EXPECT_EQ(assigned.size(), 9);
+}
+
+TEST_F(ChunkedSoaVectorTest, ObjectLifetimesBalanced)
+{
+    {
+        basic_chunked_soa_vector<4, TestObject, int> vec;
+        for (int i = 0; i < 10; ++i)
+        {
+            vec.emplace_back(TestObject(i), i);
+        }
+        auto copy = vec;
+        vec.resize(3);
+        vec.resize(7, {TestObject(5), 5});
+        vec.pop_back();
+        copy.clear();
+    }
+    EXPECT_EQ(TestObject::constructor_calls + TestObject::copy_calls + TestObject::move_calls, TestObject::destructor_calls);
+}
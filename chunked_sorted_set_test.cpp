@@ -0,0 +1,280 @@
+#include "chunked_vector/chunked_sorted_set.h"
+#include "test_common.h"
+#include <gtest/gtest.h>
+#include <list>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+using namespace dod;
+
+class ChunkedSortedSetTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        TestObject::constructor_calls = 0;
+        TestObject::destructor_calls = 0;
+        TestObject::copy_calls = 0;
+        TestObject::move_calls = 0;
+    }
+    void TearDown() override {}
+};
+
+template <typename Set, typename Reference> void expect_same_keys(const Set& actual, const Reference& expected)
+{
+    ASSERT_EQ(actual.size(), expected.size());
+    auto expected_it = expected.begin();
+    for (const auto& key : actual)
+    {
+        ASSERT_TRUE(expected_it != expected.end());
+        EXPECT_EQ(key, *expected_it);
+        ++expected_it;
+    }
+    EXPECT_TRUE(expected_it == expected.end());
+}
+
+// ============================================================================
+// Basic Operations
+// ============================================================================
+
+TEST_F(ChunkedSortedSetTest, InsertFindErase)
+{
+    chunked_sorted_set<int, std::less<int>, 4> set;
+    EXPECT_TRUE(set.empty());
+    EXPECT_TRUE(set.find(1) == set.end());
+
+    for (int key : {5, 1, 9, 3, 7, 2, 8})
+    {
+        EXPECT_TRUE(set.insert(key).second);
+    }
+    EXPECT_FALSE(set.insert(7).second);
+    EXPECT_EQ(*set.insert(7).first, 7);
+    EXPECT_EQ(set.size(), 7);
+    EXPECT_EQ(set.front(), 1);
+    EXPECT_EQ(set.back(), 9);
+    expect_same_keys(set, std::vector<int>{1, 2, 3, 5, 7, 8, 9});
+
+    EXPECT_TRUE(set.contains(3));
+    EXPECT_FALSE(set.contains(4));
+    EXPECT_EQ(set.count(8), 1);
+    EXPECT_EQ(*set.lower_bound(4), 5);
+    EXPECT_EQ(*set.upper_bound(5), 7);
+    EXPECT_TRUE(set.lower_bound(10) == set.end());
+    EXPECT_EQ(*set.lower_bound(0), 1);
+
+    EXPECT_EQ(set.erase(3), 1);
+    EXPECT_EQ(set.erase(3), 0);
+    expect_same_keys(set, std::vector<int>{1, 2, 5, 7, 8, 9});
+}
+
+TEST_F(ChunkedSortedSetTest, PagesSplitWhenFull)
+{
+    chunked_sorted_set<int, std::less<int>, 4> set;
+    for (int key = 0; key < 8; ++key)
+    {
+        set.insert(key * 10);
+    }
+    // Ascending inserts start new pages instead of splitting
+    EXPECT_EQ(set.page_count(), 2);
+
+    set.insert(15);
+    EXPECT_EQ(set.page_count(), 3);
+    expect_same_keys(set, std::vector<int>{0, 10, 15, 20, 30, 40, 50, 60, 70});
+}
+
+TEST_F(ChunkedSortedSetTest, UnderfullPagesMerge)
+{
+    chunked_sorted_set<int, std::less<int>, 8> set;
+    std::vector<int> keys(32);
+    std::iota(keys.begin(), keys.end(), 0);
+    set.assign_sorted(keys.data(), keys.data() + keys.size());
+    EXPECT_EQ(set.page_count(), 4);
+
+    // Shrink the first page, then drain the second one until it merges into the first
+    for (int key = 0; key < 6; ++key)
+    {
+        set.erase(key);
+    }
+    EXPECT_EQ(set.page_count(), 4);
+    for (int key = 8; key < 15; ++key)
+    {
+        set.erase(key);
+    }
+    EXPECT_EQ(set.page_count(), 3);
+    EXPECT_TRUE(set.contains(6));
+    EXPECT_TRUE(set.contains(15));
+    EXPECT_FALSE(set.contains(8));
+    EXPECT_EQ(set.size(), 19);
+    expect_same_keys(set, std::vector<int>{6, 7, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31});
+}
+
+TEST_F(ChunkedSortedSetTest, EraseReturnsNextIterator)
+{
+    chunked_sorted_set<int, std::less<int>, 4> set;
+    std::vector<int> keys{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+    set.assign_sorted(keys.begin(), keys.end());
+
+    auto it = set.find(3);
+    it = set.erase(it);
+    ASSERT_TRUE(it != set.end());
+    EXPECT_EQ(*it, 4);
+
+    // Erase every remaining key through the returned iterators
+    int expected = 0;
+    for (auto cur = set.begin(); cur != set.end();)
+    {
+        if (expected == 3)
+        {
+            ++expected;
+        }
+        EXPECT_EQ(*cur, expected++);
+        cur = set.erase(cur);
+    }
+    EXPECT_TRUE(set.empty());
+    EXPECT_EQ(set.page_count(), 0);
+}
+
+TEST_F(ChunkedSortedSetTest, CustomCompare)
+{
+    chunked_sorted_set<std::string, std::greater<std::string>, 4> set{"b", "d", "a", "c", "e", "f"};
+    expect_same_keys(set, std::vector<std::string>{"f", "e", "d", "c", "b", "a"});
+    EXPECT_EQ(*set.lower_bound("cc"), "c");
+}
+
+// ============================================================================
+// Bulk Loading
+// ============================================================================
+
+TEST_F(ChunkedSortedSetTest, AssignSortedFillsPages)
+{
+    std::vector<int> keys(1000);
+    for (size_t i = 0; i < keys.size(); ++i)
+    {
+        keys[i] = static_cast<int>(i * 3);
+    }
+
+    chunked_sorted_set<int, std::less<int>, 64> set;
+    set.insert(-5);
+    set.assign_sorted(keys.data(), keys.data() + keys.size());
+    EXPECT_EQ(set.size(), 1000);
+    EXPECT_EQ(set.page_count(), 16);
+    EXPECT_FALSE(set.contains(-5));
+    expect_same_keys(set, keys);
+
+    EXPECT_TRUE(set.insert(301).second);
+    EXPECT_EQ(*std::next(set.find(300)), 301);
+
+    std::list<std::string> strings{"alpha", "beta", "gamma"};
+    chunked_sorted_set<std::string, std::less<std::string>, 4> string_set;
+    string_set.assign_sorted(strings.begin(), strings.end());
+    expect_same_keys(string_set, strings);
+}
+
+// ============================================================================
+// Randomized Comparison
+// ============================================================================
+
+TEST_F(ChunkedSortedSetTest, RandomOperationsMatchStdSet)
+{
+    chunked_sorted_set<int, std::less<int>, 8> set;
+    std::set<int> expected;
+    std::mt19937 rng(7);
+
+    for (int step = 0; step < 20000; ++step)
+    {
+        const int key = static_cast<int>(rng() % 2000);
+        switch (rng() % 4)
+        {
+        case 0:
+        case 1:
+            EXPECT_EQ(set.insert(key).second, expected.insert(key).second);
+            break;
+        case 2:
+            EXPECT_EQ(set.erase(key), expected.erase(key));
+            break;
+        default:
+        {
+            auto it = set.lower_bound(key);
+            auto expected_it = expected.lower_bound(key);
+            ASSERT_EQ(it == set.end(), expected_it == expected.end());
+            if (expected_it != expected.end())
+            {
+                EXPECT_EQ(*it, *expected_it);
+            }
+            break;
+        }
+        }
+    }
+    expect_same_keys(set, expected);
+}
+
+TEST_F(ChunkedSortedSetTest, RandomOperationsNonTrivial)
+{
+    chunked_sorted_set<std::string, std::less<std::string>, 4> set;
+    std::set<std::string> expected;
+    std::mt19937 rng(11);
+
+    for (int step = 0; step < 5000; ++step)
+    {
+        const std::string key = "key number " + std::to_string(rng() % 500);
+        if (rng() % 3 != 0)
+        {
+            EXPECT_EQ(set.insert(key).second, expected.insert(key).second);
+        }
+        else
+        {
+            EXPECT_EQ(set.erase(key), expected.erase(key));
+        }
+    }
+    expect_same_keys(set, expected);
+}
+
+// ============================================================================
+// Copy and Move
+// ============================================================================
+
+TEST_F(ChunkedSortedSetTest, CopyAndMove)
+{
+    chunked_sorted_set<std::string, std::less<std::string>, 4> set;
+    for (int i = 0; i < 9; ++i)
+    {
+        set.insert(std::to_string(i));
+    }
+
+    chunked_sorted_set<std::string, std::less<std::string>, 4> copy(set);
+    expect_same_keys(copy, set);
+    EXPECT_TRUE(copy.contains("5"));
+
+    chunked_sorted_set<std::string, std::less<std::string>, 4> moved(std::move(copy));
+    EXPECT_TRUE(copy.empty());
+    EXPECT_EQ(moved.front(), "0");
+    EXPECT_EQ(moved.back(), "8");
+
+    chunked_sorted_set<std::string, std::less<std::string>, 4> assigned{"old"};
+    assigned = set;
+    expect_same_keys(assigned, set);
+    assigned = std::move(moved);
+    EXPECT_EQ(assigned.size(), 9);
+    EXPECT_TRUE(assigned.contains("8"));
+}
+
+TEST_F(ChunkedSortedSetTest, ObjectLifetimesBalanced)
+{
+    auto less = [](const TestObject& a, const TestObject& b) { return a.value < b.value; };
+    {
+        chunked_sorted_set<TestObject, decltype(less), 4> set(less);
+        for (int i = 0; i < 40; ++i)
+        {
+            set.insert(TestObject((i * 7) % 40));
+        }
+        for (int i = 0; i < 30; ++i)
+        {
+            set.erase(TestObject(i));
+        }
+        auto copy = set;
+        copy.clear();
+    }
+    EXPECT_EQ(TestObject::constructor_calls + TestObject::copy_calls + TestObject::move_calls, TestObject::destructor_calls);
+}
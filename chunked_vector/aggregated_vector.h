@@ -0,0 +1,292 @@
+#pragma once
+
+#include "chunked_vector.h"
+
+namespace dod
+{
+
+/// @brief Sum aggregate policy for aggregated_vector
+template <typename T> struct sum_aggregate
+{
+    [[nodiscard]] static constexpr T identity() noexcept { return T(0); }
+    [[nodiscard]] static CHUNKED_VEC_INLINE T combine(const T& a, const T& b) { return a + b; }
+};
+
+/// @brief Minimum aggregate policy for aggregated_vector
+template <typename T> struct min_aggregate
+{
+    [[nodiscard]] static constexpr T identity() noexcept
+    {
+        return std::numeric_limits<T>::has_infinity ? std::numeric_limits<T>::infinity() : std::numeric_limits<T>::max();
+    }
+    [[nodiscard]] static CHUNKED_VEC_INLINE T combine(const T& a, const T& b) { return b < a ? b : a; }
+};
+
+/// @brief Maximum aggregate policy for aggregated_vector
+template <typename T> struct max_aggregate
+{
+    [[nodiscard]] static constexpr T identity() noexcept
+    {
+        return std::numeric_limits<T>::has_infinity ? -std::numeric_limits<T>::infinity() : std::numeric_limits<T>::lowest();
+    }
+    [[nodiscard]] static CHUNKED_VEC_INLINE T combine(const T& a, const T& b) { return a < b ? b : a; }
+};
+
+/// @brief A chunked_vector that maintains per-page aggregates for fast range queries
+/// @details Every full page has its aggregate stored as a leaf of a segment tree over pages; the
+/// last (partially filled) page keeps a separate running aggregate. Appends fold the new value into
+/// the tail aggregate in O(1) and move it into the tree when the page fills up (O(log pages) once
+/// per PAGE_SIZE appends). A range query combines whole-page aggregates through the tree in
+/// O(log pages) and scans only the two partially covered edge pages.
+///
+/// Elements are read-only through the container; set() updates one element and recomputes the
+/// aggregate of its page.
+///
+/// @tparam T Element type
+/// @tparam Aggregate Policy with static identity() and an associative combine(a, b)
+///         (default: sum_aggregate<T>, see also min_aggregate and max_aggregate)
+/// @tparam PAGE_SIZE The number of elements per page (default: 1024)
+template <typename T, typename Aggregate = sum_aggregate<T>, size_t PAGE_SIZE = 1024> class aggregated_vector
+{
+  public:
+    using value_type = T;
+    using const_reference = const T&;
+    using size_type = std::size_t;
+    using const_iterator = typename chunked_vector<T, PAGE_SIZE>::const_iterator;
+
+    /// @brief Returns the page size used by this container
+    [[nodiscard]] static constexpr size_t page_size() { return PAGE_SIZE; }
+
+    aggregated_vector()
+        : m_tail(Aggregate::identity())
+        , m_full_pages(0)
+        , m_leaf_capacity(0)
+    {
+    }
+
+    aggregated_vector(std::initializer_list<T> init)
+        : aggregated_vector()
+    {
+        reserve(init.size());
+        for (const auto& item : init)
+        {
+            push_back(item);
+        }
+    }
+
+    /// @brief Read-only access to the underlying values
+    [[nodiscard]] CHUNKED_VEC_INLINE const chunked_vector<T, PAGE_SIZE>& values() const noexcept { return m_values; }
+
+    [[nodiscard]] CHUNKED_VEC_INLINE const_reference operator[](size_type pos) const { return m_values[pos]; }
+
+    [[nodiscard]] CHUNKED_VEC_INLINE const_reference at(size_type pos) const
+    {
+        if (pos >= size())
+        {
+            throw std::out_of_range("aggregated_vector::at: index out of range");
+        }
+        return m_values[pos];
+    }
+
+    [[nodiscard]] CHUNKED_VEC_INLINE const_reference front() const { return m_values.front(); }
+    [[nodiscard]] CHUNKED_VEC_INLINE const_reference back() const { return m_values.back(); }
+
+    [[nodiscard]] CHUNKED_VEC_INLINE const_iterator begin() const noexcept { return m_values.begin(); }
+    [[nodiscard]] CHUNKED_VEC_INLINE const_iterator end() const noexcept { return m_values.end(); }
+    [[nodiscard]] CHUNKED_VEC_INLINE const_iterator cbegin() const noexcept { return m_values.cbegin(); }
+    [[nodiscard]] CHUNKED_VEC_INLINE const_iterator cend() const noexcept { return m_values.cend(); }
+
+    [[nodiscard]] CHUNKED_VEC_INLINE bool empty() const noexcept { return m_values.empty(); }
+    [[nodiscard]] CHUNKED_VEC_INLINE size_type size() const noexcept { return m_values.size(); }
+    [[nodiscard]] CHUNKED_VEC_INLINE size_type capacity() const noexcept { return m_values.capacity(); }
+
+    void reserve(size_type new_capacity) { m_values.reserve(new_capacity); }
+
+    void clear() noexcept
+    {
+        m_values.clear();
+        m_tree.clear();
+        m_tail = Aggregate::identity();
+        m_full_pages = 0;
+        m_leaf_capacity = 0;
+    }
+
+    void push_back(const T& value) { emplace_back(value); }
+    void push_back(T&& value) { emplace_back(std::move(value)); }
+
+    template <typename... Args> const_reference emplace_back(Args&&... args)
+    {
+        const T& value = m_values.emplace_back(std::forward<Args>(args)...);
+        m_tail = Aggregate::combine(m_tail, value);
+        if (layout::split(m_values.size()).second == 0)
+        {
+            // The tail page is full: its aggregate becomes a tree leaf
+            append_leaf(m_tail);
+            m_tail = Aggregate::identity();
+        }
+        return value;
+    }
+
+    /// @note Time complexity: O(PAGE_SIZE), the tail aggregate is recomputed
+    void pop_back()
+    {
+        CHUNKED_VEC_ASSERT(!empty() && "Cannot pop from empty aggregated_vector");
+        if (layout::split(m_values.size()).second == 0)
+        {
+            // The last full page becomes the tail page again
+            --m_full_pages;
+            set_leaf(m_full_pages, Aggregate::identity());
+        }
+        m_values.pop_back();
+        m_tail = scan_page(m_full_pages, 0, tail_page_count());
+    }
+
+    /// @brief Replace the element at pos and update the aggregate of its page
+    /// @note Time complexity: O(PAGE_SIZE + log(page count))
+    void set(size_type pos, const T& value)
+    {
+        CHUNKED_VEC_ASSERT(pos < size() && "Index out of range");
+        m_values[pos] = value;
+        const size_type page_idx = layout::split(pos).first;
+        if (page_idx < m_full_pages)
+        {
+            set_leaf(page_idx, scan_page(page_idx, 0, PAGE_SIZE));
+        }
+        else
+        {
+            m_tail = scan_page(page_idx, 0, tail_page_count());
+        }
+    }
+
+    /// @brief Aggregate of all elements
+    [[nodiscard]] T total() const { return Aggregate::combine(query_pages(0, m_full_pages), m_tail); }
+
+    /// @brief Aggregate of the elements in [first, last)
+    /// @note Time complexity: O(log(page count) + PAGE_SIZE)
+    [[nodiscard]] T query(size_type first, size_type last) const
+    {
+        CHUNKED_VEC_ASSERT(first <= last && last <= size() && "Invalid range");
+        if (first == last)
+        {
+            return Aggregate::identity();
+        }
+
+        auto [first_page, first_elem] = layout::split(first);
+        auto [last_page, last_elem] = layout::split(last - 1);
+        ++last_elem;
+        if (first_page == last_page)
+        {
+            return aggregate_page(first_page, first_elem, last_elem);
+        }
+
+        T result = aggregate_page(first_page, first_elem, elements_in_page(first_page));
+        result = Aggregate::combine(result, query_pages(first_page + 1, last_page));
+        return Aggregate::combine(result, aggregate_page(last_page, 0, last_elem));
+    }
+
+  private:
+    using layout = detail::page_layout<PAGE_SIZE>;
+
+    chunked_vector<T, PAGE_SIZE> m_values;
+    // Bottom-up segment tree over full pages: leaves live at [m_leaf_capacity, 2 * m_leaf_capacity), node i covers 2i and 2i + 1
+    chunked_vector<T, 256> m_tree;
+    // Aggregate of the partially filled last page
+    T m_tail;
+    size_type m_full_pages;
+    size_type m_leaf_capacity;
+
+    [[nodiscard]] CHUNKED_VEC_INLINE size_type tail_page_count() const noexcept { return size() - m_full_pages * PAGE_SIZE; }
+
+    [[nodiscard]] CHUNKED_VEC_INLINE size_type elements_in_page(size_type page_idx) const noexcept
+    {
+        return page_idx < m_full_pages ? PAGE_SIZE : tail_page_count();
+    }
+
+    /// @brief Aggregate of elements [first_elem, last_elem) of one page; uses the stored aggregate for whole pages
+    [[nodiscard]] T aggregate_page(size_type page_idx, size_type first_elem, size_type last_elem) const
+    {
+        if (first_elem == 0 && last_elem == elements_in_page(page_idx))
+        {
+            return page_idx < m_full_pages ? m_tree[m_leaf_capacity + page_idx] : m_tail;
+        }
+        return scan_page(page_idx, first_elem, last_elem);
+    }
+
+    [[nodiscard]] T scan_page(size_type page_idx, size_type first_elem, size_type last_elem) const
+    {
+        if (first_elem == last_elem)
+        {
+            return Aggregate::identity();
+        }
+        const page_segment<const T> page = m_values.segment(page_idx);
+        T result = Aggregate::identity();
+        for (size_type elem_idx = first_elem; elem_idx < last_elem; ++elem_idx)
+        {
+            result = Aggregate::combine(result, page[elem_idx]);
+        }
+        return result;
+    }
+
+    /// @brief Aggregate of full pages [first_page, last_page)
+    [[nodiscard]] T query_pages(size_type first_page, size_type last_page) const
+    {
+        CHUNKED_VEC_ASSERT(last_page <= m_full_pages && "Page range out of bounds");
+        // Left and right accumulators keep the combine order for non-commutative aggregates
+        T left = Aggregate::identity();
+        T right = Aggregate::identity();
+        size_type lo = first_page + m_leaf_capacity;
+        size_type hi = last_page + m_leaf_capacity;
+        while (lo < hi)
+        {
+            if (lo & 1)
+            {
+                left = Aggregate::combine(left, m_tree[lo++]);
+            }
+            if (hi & 1)
+            {
+                right = Aggregate::combine(m_tree[--hi], right);
+            }
+            lo >>= 1;
+            hi >>= 1;
+        }
+        return Aggregate::combine(left, right);
+    }
+
+    void append_leaf(const T& page_aggregate)
+    {
+        if (m_full_pages == m_leaf_capacity)
+        {
+            grow_tree();
+        }
+        set_leaf(m_full_pages++, page_aggregate);
+    }
+
+    void set_leaf(size_type page_idx, const T& page_aggregate)
+    {
+        size_type node = m_leaf_capacity + page_idx;
+        m_tree[node] = page_aggregate;
+        for (node >>= 1; node > 0; node >>= 1)
+        {
+            m_tree[node] = Aggregate::combine(m_tree[2 * node], m_tree[2 * node + 1]);
+        }
+    }
+
+    /// @brief Double the number of leaves and rebuild the inner nodes (amortized O(1) per page)
+    void grow_tree()
+    {
+        const size_type new_leaf_capacity = m_leaf_capacity == 0 ? 1 : m_leaf_capacity * 2;
+        chunked_vector<T, 256> new_tree(2 * new_leaf_capacity, Aggregate::identity());
+        for (size_type page_idx = 0; page_idx < m_full_pages; ++page_idx)
+        {
+            new_tree[new_leaf_capacity + page_idx] = m_tree[m_leaf_capacity + page_idx];
+        }
+        for (size_type node = new_leaf_capacity - 1; node > 0; --node)
+        {
+            new_tree[node] = Aggregate::combine(new_tree[2 * node], new_tree[2 * node + 1]);
+        }
+        m_tree = std::move(new_tree);
+        m_leaf_capacity = new_leaf_capacity;
+    }
+};
+
+} // namespace dod
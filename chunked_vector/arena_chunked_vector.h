@@ -0,0 +1,753 @@
+#pragma once
+
+#include "chunked_vector.h"
+
+#include <cstdint>
+
+// Virtual memory primitives used by arena_chunked_vector. Define all four to plug in a custom mechanism:
+//   CHUNKED_VEC_VM_RESERVE(sizeInBytes)       - reserve an inaccessible address range, returns nullptr on failure
+//   CHUNKED_VEC_VM_COMMIT(ptr, sizeInBytes)   - make a reserved range readable and writable, returns false on failure
+//   CHUNKED_VEC_VM_DECOMMIT(ptr, sizeInBytes) - give the memory of a committed range back, keeping it reserved
+//   CHUNKED_VEC_VM_RELEASE(ptr, sizeInBytes)  - release a whole reservation
+#if !defined(CHUNKED_VEC_VM_RESERVE) || !defined(CHUNKED_VEC_VM_COMMIT) || !defined(CHUNKED_VEC_VM_DECOMMIT) ||                    \
+    !defined(CHUNKED_VEC_VM_RELEASE)
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#define CHUNKED_VEC_UNDEF_NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#define CHUNKED_VEC_UNDEF_WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#ifdef CHUNKED_VEC_UNDEF_NOMINMAX
+#undef NOMINMAX
+#undef CHUNKED_VEC_UNDEF_NOMINMAX
+#endif
+#ifdef CHUNKED_VEC_UNDEF_WIN32_LEAN_AND_MEAN
+#undef WIN32_LEAN_AND_MEAN
+#undef CHUNKED_VEC_UNDEF_WIN32_LEAN_AND_MEAN
+#endif
+
+#define CHUNKED_VEC_VM_RESERVE(sizeInBytes) VirtualAlloc(nullptr, sizeInBytes, MEM_RESERVE, PAGE_NOACCESS)
+#define CHUNKED_VEC_VM_COMMIT(ptr, sizeInBytes) (VirtualAlloc(ptr, sizeInBytes, MEM_COMMIT, PAGE_READWRITE) != nullptr)
+#define CHUNKED_VEC_VM_DECOMMIT(ptr, sizeInBytes) VirtualFree(ptr, sizeInBytes, MEM_DECOMMIT)
+#define CHUNKED_VEC_VM_RELEASE(ptr, sizeInBytes) VirtualFree(ptr, 0, MEM_RELEASE)
+
+#elif defined(__unix__) || defined(__APPLE__)
+#include <sys/mman.h>
+
+#ifdef MAP_NORESERVE
+#define CHUNKED_VEC_MAP_NORESERVE MAP_NORESERVE
+#else
+#define CHUNKED_VEC_MAP_NORESERVE 0
+#endif
+
+namespace dod
+{
+namespace detail
+{
+inline void* vm_reserve(size_t bytes) noexcept
+{
+    void* ptr = mmap(nullptr, bytes, PROT_NONE, MAP_PRIVATE | MAP_ANON | CHUNKED_VEC_MAP_NORESERVE, -1, 0);
+    return ptr == MAP_FAILED ? nullptr : ptr;
+}
+
+inline void vm_decommit(void* ptr, size_t bytes) noexcept
+{
+    // Drop the physical pages (they read back as zeros) and make the range inaccessible again
+    madvise(ptr, bytes, MADV_DONTNEED);
+    mprotect(ptr, bytes, PROT_NONE);
+}
+} // namespace detail
+} // namespace dod
+
+#define CHUNKED_VEC_VM_RESERVE(sizeInBytes) dod::detail::vm_reserve(sizeInBytes)
+#define CHUNKED_VEC_VM_COMMIT(ptr, sizeInBytes) (mprotect(ptr, sizeInBytes, PROT_READ | PROT_WRITE) == 0)
+#define CHUNKED_VEC_VM_DECOMMIT(ptr, sizeInBytes) dod::detail::vm_decommit(ptr, sizeInBytes)
+#define CHUNKED_VEC_VM_RELEASE(ptr, sizeInBytes) munmap(ptr, sizeInBytes)
+
+#else
+#error "arena_chunked_vector needs CHUNKED_VEC_VM_RESERVE/COMMIT/DECOMMIT/RELEASE on this platform"
+#endif
+
+#endif
+
+// Default address space each arena_chunked_vector reserves on its first allocation; only committed pages use memory
+#if !defined(CHUNKED_VEC_ARENA_RESERVE_BYTES)
+#define CHUNKED_VEC_ARENA_RESERVE_BYTES (sizeof(void*) >= 8 ? (size_t(64) << 30) : (size_t(256) << 20))
+#endif
+
+namespace dod
+{
+
+/// @brief A chunked vector whose pages live in one reserved virtual address region
+/// @details On the first allocation the container reserves RESERVE_BYTES of address space and commits it front to
+/// back as pages are needed. The page table stores 32-bit arena page numbers instead of
+/// 8-byte pointers, so for vectors with hundreds of thousands of pages it takes half the cache space on random
+/// access; an element address is arena base + page number * page stride + offset.
+///
+/// Because pages are named by number rather than address, they can be reordered and moved inside the arena:
+/// - erase() of a page-aligned range rotates the erased pages to the end of the page table without moving elements
+/// - shrink_to_fit() puts spare pages on a free list that later growth reuses; no element moves
+/// - compact() moves the pages that live above the first page_count() arena pages into the holes below them
+///   and gives the memory above back to the OS. It invalidates pointers, references and iterators.
+///
+/// Otherwise it behaves like chunked_vector: elements never move on growth and push_back() never invalidates
+/// iterators.
+///
+/// The reservation is made once and never grows, since moving the arena would move every element. Each non-empty
+/// container therefore holds RESERVE_BYTES of address space (64 GB by default on 64-bit targets), even when it
+/// commits a single page. A 47-bit user address space fits about two thousand such vectors, and a process limited
+/// with ulimit -v fails the reservation. Programs with many live vectors should pass a RESERVE_BYTES sized for
+/// their largest expected vector.
+///
+/// @tparam T The type of elements stored in the vector
+/// @tparam PAGE_SIZE The number of elements per page (default: 1024)
+/// @tparam RESERVE_BYTES Address space reserved per container; caps max_size() (default: CHUNKED_VEC_ARENA_RESERVE_BYTES)
+template <typename T, size_t PAGE_SIZE = 1024, size_t RESERVE_BYTES = CHUNKED_VEC_ARENA_RESERVE_BYTES> class arena_chunked_vector
+{
+  public:
+    using value_type = T;
+    using reference = T&;
+    using const_reference = const T&;
+    using pointer = T*;
+    using const_pointer = const T*;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+
+    template <typename ValueType> class basic_iterator;
+    using iterator = basic_iterator<T>;
+    using const_iterator = basic_iterator<const T>;
+
+    /// @brief Returns the page size used by this container
+    [[nodiscard]] static constexpr size_t page_size() { return PAGE_SIZE; }
+
+    arena_chunked_vector() noexcept
+        : m_arena(nullptr)
+        , m_committed_bytes(0)
+        , m_arena_page_count(0)
+        , m_free_arena_page(NO_PAGE)
+        , m_page_numbers(nullptr)
+        , m_page_count(0)
+        , m_page_capacity(0)
+        , m_size(0)
+    {
+    }
+
+    explicit arena_chunked_vector(size_type count)
+        : arena_chunked_vector()
+    {
+        resize(count);
+    }
+
+    arena_chunked_vector(size_type count, const T& value)
+        : arena_chunked_vector()
+    {
+        resize(count, value);
+    }
+
+    arena_chunked_vector(std::initializer_list<T> init)
+        : arena_chunked_vector()
+    {
+        reserve(init.size());
+        for (const auto& item : init)
+        {
+            push_back(item);
+        }
+    }
+
+    /// @brief Copy constructor - the copy gets its own arena with pages numbered from 0
+    arena_chunked_vector(const arena_chunked_vector& other)
+        : arena_chunked_vector()
+    {
+        copy_from(other);
+    }
+
+    arena_chunked_vector(arena_chunked_vector&& other) noexcept
+        : m_arena(other.m_arena)
+        , m_committed_bytes(other.m_committed_bytes)
+        , m_arena_page_count(other.m_arena_page_count)
+        , m_free_arena_page(other.m_free_arena_page)
+        , m_page_numbers(other.m_page_numbers)
+        , m_page_count(other.m_page_count)
+        , m_page_capacity(other.m_page_capacity)
+        , m_size(other.m_size)
+    {
+        other.reset();
+    }
+
+    ~arena_chunked_vector() { free_storage(); }
+
+    /// @brief Copy assignment - reuses already allocated pages
+    arena_chunked_vector& operator=(const arena_chunked_vector& other)
+    {
+        if (this != &other)
+        {
+            clear();
+            copy_from(other);
+        }
+        return *this;
+    }
+
+    arena_chunked_vector& operator=(arena_chunked_vector&& other) noexcept
+    {
+        if (this != &other)
+        {
+            free_storage();
+
+            m_arena = other.m_arena;
+            m_committed_bytes = other.m_committed_bytes;
+            m_arena_page_count = other.m_arena_page_count;
+            m_free_arena_page = other.m_free_arena_page;
+            m_page_numbers = other.m_page_numbers;
+            m_page_count = other.m_page_count;
+            m_page_capacity = other.m_page_capacity;
+            m_size = other.m_size;
+
+            other.reset();
+        }
+        return *this;
+    }
+
+    [[nodiscard]] CHUNKED_VEC_INLINE reference operator[](size_type pos)
+    {
+        CHUNKED_VEC_ASSERT(pos < m_size && "Index out of range");
+        auto [page_idx, elem_idx] = layout::split(pos);
+        return page_data(m_page_numbers[page_idx])[elem_idx];
+    }
+
+    [[nodiscard]] CHUNKED_VEC_INLINE const_reference operator[](size_type pos) const
+    {
+        CHUNKED_VEC_ASSERT(pos < m_size && "Index out of range");
+        auto [page_idx, elem_idx] = layout::split(pos);
+        return page_data(m_page_numbers[page_idx])[elem_idx];
+    }
+
+    [[nodiscard]] CHUNKED_VEC_INLINE reference at(size_type pos)
+    {
+        if (pos >= m_size)
+        {
+            throw std::out_of_range("arena_chunked_vector::at: index out of range");
+        }
+        return (*this)[pos];
+    }
+
+    [[nodiscard]] CHUNKED_VEC_INLINE const_reference at(size_type pos) const
+    {
+        if (pos >= m_size)
+        {
+            throw std::out_of_range("arena_chunked_vector::at: index out of range");
+        }
+        return (*this)[pos];
+    }
+
+    [[nodiscard]] CHUNKED_VEC_INLINE reference front()
+    {
+        CHUNKED_VEC_ASSERT(m_size > 0 && "Cannot access front of empty arena_chunked_vector");
+        return (*this)[0];
+    }
+
+    [[nodiscard]] CHUNKED_VEC_INLINE const_reference front() const
+    {
+        CHUNKED_VEC_ASSERT(m_size > 0 && "Cannot access front of empty arena_chunked_vector");
+        return (*this)[0];
+    }
+
+    [[nodiscard]] CHUNKED_VEC_INLINE reference back()
+    {
+        CHUNKED_VEC_ASSERT(m_size > 0 && "Cannot access back of empty arena_chunked_vector");
+        return (*this)[m_size - 1];
+    }
+
+    [[nodiscard]] CHUNKED_VEC_INLINE const_reference back() const
+    {
+        CHUNKED_VEC_ASSERT(m_size > 0 && "Cannot access back of empty arena_chunked_vector");
+        return (*this)[m_size - 1];
+    }
+
+    [[nodiscard]] CHUNKED_VEC_INLINE iterator begin() noexcept { return iterator(this, 0); }
+    [[nodiscard]] CHUNKED_VEC_INLINE const_iterator begin() const noexcept { return const_iterator(this, 0); }
+    [[nodiscard]] CHUNKED_VEC_INLINE const_iterator cbegin() const noexcept { return const_iterator(this, 0); }
+
+    [[nodiscard]] CHUNKED_VEC_INLINE iterator end() noexcept { return iterator(this, m_size); }
+    [[nodiscard]] CHUNKED_VEC_INLINE const_iterator end() const noexcept { return const_iterator(this, m_size); }
+    [[nodiscard]] CHUNKED_VEC_INLINE const_iterator cend() const noexcept { return const_iterator(this, m_size); }
+
+    [[nodiscard]] CHUNKED_VEC_INLINE bool empty() const noexcept { return m_size == 0; }
+    [[nodiscard]] CHUNKED_VEC_INLINE size_type size() const noexcept { return m_size; }
+    [[nodiscard]] CHUNKED_VEC_INLINE size_type capacity() const noexcept { return m_page_count * PAGE_SIZE; }
+    [[nodiscard]] static constexpr size_type max_size() noexcept { return MAX_ARENA_PAGES * PAGE_SIZE; }
+
+    /// @brief Number of pages owned by the container (live and spare)
+    [[nodiscard]] CHUNKED_VEC_INLINE size_type page_count() const noexcept { return m_page_count; }
+
+    /// @brief Bytes of the arena that are currently committed
+    [[nodiscard]] CHUNKED_VEC_INLINE size_t committed_bytes() const noexcept { return m_committed_bytes; }
+
+    void reserve(size_type new_capacity)
+    {
+        if (new_capacity <= capacity())
+        {
+            return;
+        }
+        if (new_capacity > max_size())
+        {
+            throw std::length_error("arena_chunked_vector::reserve: capacity exceeds the arena reservation");
+        }
+
+        const size_type pages_needed = layout::pages_needed(new_capacity);
+        ensure_page_capacity(pages_needed);
+        while (m_page_count < pages_needed)
+        {
+            m_page_numbers[m_page_count] = allocate_arena_page();
+            ++m_page_count;
+        }
+    }
+
+    void resize(size_type count)
+    {
+        if (count < m_size)
+        {
+            destroy_from(count);
+            return;
+        }
+        reserve(count);
+        while (m_size < count)
+        {
+            emplace_back();
+        }
+    }
+
+    void resize(size_type count, const T& value)
+    {
+        if (count < m_size)
+        {
+            destroy_from(count);
+            return;
+        }
+        reserve(count);
+        while (m_size < count)
+        {
+            push_back(value);
+        }
+    }
+
+    /// @brief Destroy all elements, keeping the pages as spare capacity
+    void clear() noexcept { destroy_from(0); }
+
+    void push_back(const T& value) { emplace_back(value); }
+    void push_back(T&& value) { emplace_back(std::move(value)); }
+
+    template <typename... Args> CHUNKED_VEC_INLINE reference emplace_back(Args&&... args)
+    {
+        auto [page_idx, elem_idx] = layout::split(m_size);
+        if (page_idx >= m_page_count)
+        {
+            reserve(m_size + 1);
+        }
+
+        T* ptr = dod::construct<T>(page_data(m_page_numbers[page_idx]) + elem_idx, std::forward<Args>(args)...);
+        ++m_size;
+        return *ptr;
+    }
+
+    void pop_back()
+    {
+        CHUNKED_VEC_ASSERT(m_size > 0 && "Cannot pop from empty arena_chunked_vector");
+        if constexpr (!std::is_trivially_destructible_v<T>)
+        {
+            dod::destruct(&back());
+        }
+        --m_size;
+    }
+
+    /// @brief Erase the elements [first, last)
+    /// @note When first and last are multiples of PAGE_SIZE the erased pages are rotated to the end as spare
+    ///       pages by renumbering, so no element moves and pointers to the following elements stay valid.
+    ///       Otherwise the following elements are relocated page segment by page segment.
+    void erase(size_type first, size_type last)
+    {
+        CHUNKED_VEC_ASSERT(first <= last && last <= m_size && "Erase range out of range");
+        if (first == last)
+        {
+            return;
+        }
+
+        const size_type old_size = m_size;
+        auto [first_page, first_elem] = layout::split(first);
+        auto [last_page, last_elem] = layout::split(last);
+        if (first_elem == 0 && last_elem == 0)
+        {
+            destroy_range(first, last);
+            std::rotate(m_page_numbers + first_page, m_page_numbers + last_page, m_page_numbers + m_page_count);
+            m_size = old_size - (last - first);
+            return;
+        }
+
+        destroy_range(first, last);
+        size_type src_idx = last;
+        size_type dst_idx = first;
+        while (src_idx < old_size)
+        {
+            auto [src_page, src_elem] = layout::split(src_idx);
+            auto [dst_page, dst_elem] = layout::split(dst_idx);
+            const size_type count = std::min({old_size - src_idx, PAGE_SIZE - src_elem, PAGE_SIZE - dst_elem});
+            relocate_elements(page_data(m_page_numbers[dst_page]) + dst_elem, page_data(m_page_numbers[src_page]) + src_elem, count);
+            src_idx += count;
+            dst_idx += count;
+        }
+        m_size = old_size - (last - first);
+    }
+
+    /// @brief Return spare pages to the arena free list
+    /// @note No element moves; the memory stays committed until compact()
+    void shrink_to_fit() noexcept
+    {
+        const size_type pages_needed = layout::pages_needed(m_size);
+        while (m_page_count > pages_needed)
+        {
+            --m_page_count;
+            free_arena_page(m_page_numbers[m_page_count]);
+        }
+    }
+
+    /// @brief Release spare pages, move every page into the first page_count() arena pages and decommit the rest
+    /// @note Time complexity: O(pages + moved elements). Invalidates pointers, references and iterators.
+    void compact()
+    {
+        shrink_to_fit();
+
+        // Arena pages [0, m_arena_page_count) are either used or free, so every used page at or above
+        // live_pages has a matching free page below it
+        const page_number live_pages = static_cast<page_number>(m_page_count);
+        page_number hole = m_free_arena_page;
+        for (size_type page_idx = 0; page_idx < m_page_count; ++page_idx)
+        {
+            const page_number number = m_page_numbers[page_idx];
+            if (number < live_pages)
+            {
+                continue;
+            }
+
+            while (hole >= live_pages)
+            {
+                CHUNKED_VEC_ASSERT(hole != NO_PAGE && "Free list is missing a hole below the live pages");
+                hole = next_free_arena_page(hole);
+            }
+            // Read the link before the hole is overwritten
+            const page_number target = hole;
+            hole = next_free_arena_page(hole);
+
+            relocate_elements(page_data(target), page_data(number), elements_in_page(page_idx));
+            m_page_numbers[page_idx] = target;
+        }
+
+        m_arena_page_count = live_pages;
+        m_free_arena_page = NO_PAGE;
+
+        const size_t keep_bytes = round_up(size_t(live_pages) * PAGE_STRIDE, COMMIT_GRANULARITY);
+        if (keep_bytes < m_committed_bytes)
+        {
+            CHUNKED_VEC_VM_DECOMMIT(m_arena + keep_bytes, m_committed_bytes - keep_bytes);
+            m_committed_bytes = keep_bytes;
+        }
+    }
+
+  private:
+    using layout = detail::page_layout<PAGE_SIZE>;
+    using page_number = uint32_t;
+
+    static constexpr page_number NO_PAGE = std::numeric_limits<page_number>::max();
+
+    [[nodiscard]] static constexpr size_t round_up(size_t value, size_t multiple) noexcept
+    {
+        return (value + multiple - 1) / multiple * multiple;
+    }
+
+    // Distance between arena pages: keeps every page aligned for T and large enough to hold a free list link
+    static constexpr size_t PAGE_BYTES = PAGE_SIZE * sizeof(T) > sizeof(page_number) ? PAGE_SIZE * sizeof(T) : sizeof(page_number);
+    static constexpr size_t PAGE_STRIDE = round_up(PAGE_BYTES, safe_alignment_of<T>);
+
+    // Memory is committed and decommitted in steps that are a multiple of the OS page size on all platforms
+    static constexpr size_t COMMIT_GRANULARITY = 64 * 1024;
+
+    static constexpr size_t MAX_ARENA_PAGES = RESERVE_BYTES / PAGE_STRIDE < NO_PAGE ? RESERVE_BYTES / PAGE_STRIDE : NO_PAGE;
+    static constexpr size_t RESERVED_BYTES = round_up(MAX_ARENA_PAGES * PAGE_STRIDE, COMMIT_GRANULARITY);
+
+    static_assert(PAGE_SIZE > 0, "PAGE_SIZE must be greater than 0");
+    static_assert(MAX_ARENA_PAGES > 0, "RESERVE_BYTES must hold at least one page");
+
+    unsigned char* m_arena;          // Reserved region, nullptr until the first page is allocated
+    size_t m_committed_bytes;        // [m_arena, m_arena + m_committed_bytes) is readable and writable
+    page_number m_arena_page_count;  // Arena pages handed out so far, used or free
+    page_number m_free_arena_page;   // Head of the free list, linked through the first bytes of each free page
+    page_number* m_page_numbers;     // Arena page number of every page the container owns
+    size_type m_page_count;
+    size_type m_page_capacity;
+    size_type m_size;
+
+    [[nodiscard]] CHUNKED_VEC_INLINE T* page_data(page_number number) const noexcept
+    {
+        return reinterpret_cast<T*>(m_arena + size_t(number) * PAGE_STRIDE);
+    }
+
+    [[nodiscard]] CHUNKED_VEC_INLINE size_type elements_in_page(size_type page_idx) const noexcept
+    {
+        const size_type page_start = page_idx * PAGE_SIZE;
+        return m_size > page_start ? std::min(m_size - page_start, PAGE_SIZE) : 0;
+    }
+
+    [[nodiscard]] page_number next_free_arena_page(page_number number) const noexcept
+    {
+        page_number next;
+        std::memcpy(&next, page_data(number), sizeof(next));
+        return next;
+    }
+
+    void free_arena_page(page_number number) noexcept
+    {
+        std::memcpy(static_cast<void*>(page_data(number)), &m_free_arena_page, sizeof(m_free_arena_page));
+        m_free_arena_page = number;
+    }
+
+    [[nodiscard]] page_number allocate_arena_page()
+    {
+        if (m_free_arena_page != NO_PAGE)
+        {
+            const page_number number = m_free_arena_page;
+            m_free_arena_page = next_free_arena_page(number);
+            return number;
+        }
+
+        if (!m_arena)
+        {
+            m_arena = static_cast<unsigned char*>(CHUNKED_VEC_VM_RESERVE(RESERVED_BYTES));
+            if (!m_arena)
+            {
+                throw std::bad_alloc();
+            }
+        }
+        if (m_arena_page_count == MAX_ARENA_PAGES)
+        {
+            throw std::bad_alloc();
+        }
+
+        const size_t used_bytes = (size_t(m_arena_page_count) + 1) * PAGE_STRIDE;
+        if (used_bytes > m_committed_bytes)
+        {
+            const size_t new_committed_bytes = round_up(used_bytes, COMMIT_GRANULARITY);
+            if (!CHUNKED_VEC_VM_COMMIT(m_arena + m_committed_bytes, new_committed_bytes - m_committed_bytes))
+            {
+                throw std::bad_alloc();
+            }
+            m_committed_bytes = new_committed_bytes;
+        }
+        return m_arena_page_count++;
+    }
+
+    /// @brief Relocate count contiguous elements from src to dst (dst <= src when the ranges overlap)
+    static void relocate_elements(T* dst, T* src, size_type count) noexcept
+    {
+        if constexpr (is_trivially_relocatable_v<T>)
+        {
+            std::memmove(static_cast<void*>(dst), static_cast<const void*>(src), count * sizeof(T));
+        }
+        else
+        {
+            for (size_type i = 0; i < count; ++i)
+            {
+                dod::construct<T>(&dst[i], std::move(src[i]));
+                dod::destruct(&src[i]);
+            }
+        }
+    }
+
+    /// @brief Destroy the elements [first, last) page by page without changing the size
+    void destroy_range(size_type first, size_type last) noexcept
+    {
+        if constexpr (!std::is_trivially_destructible_v<T>)
+        {
+            while (first < last)
+            {
+                auto [page_idx, elem_idx] = layout::split(first);
+                T* page = page_data(m_page_numbers[page_idx]);
+                const size_type count = std::min(last - first, PAGE_SIZE - elem_idx);
+                for (size_type i = elem_idx; i < elem_idx + count; ++i)
+                {
+                    dod::destruct(&page[i]);
+                }
+                first += count;
+            }
+        }
+    }
+
+    /// @brief Destroy the elements [new_size, size())
+    void destroy_from(size_type new_size) noexcept
+    {
+        destroy_range(new_size, m_size);
+        m_size = new_size;
+    }
+
+    void copy_from(const arena_chunked_vector& other)
+    {
+        CHUNKED_VEC_ASSERT(m_size == 0 && "copy_from expects an empty container");
+        reserve(other.m_size);
+
+        size_type remaining = other.m_size;
+        for (size_type page_idx = 0; remaining > 0; ++page_idx)
+        {
+            const T* src = other.page_data(other.m_page_numbers[page_idx]);
+            T* dst = page_data(m_page_numbers[page_idx]);
+            const size_type count = std::min(remaining, PAGE_SIZE);
+            if constexpr (std::is_trivially_copyable_v<T>)
+            {
+                std::memcpy(static_cast<void*>(dst), static_cast<const void*>(src), count * sizeof(T));
+                m_size += count;
+            }
+            else
+            {
+                for (size_type elem_idx = 0; elem_idx < count; ++elem_idx)
+                {
+                    dod::construct<T>(dst + elem_idx, src[elem_idx]);
+                    ++m_size;
+                }
+            }
+            remaining -= count;
+        }
+    }
+
+    void ensure_page_capacity(size_type pages_needed)
+    {
+        // The page table never needs more entries than the arena has pages
+        detail::grow_page_table(m_page_numbers, m_page_capacity, m_page_count, pages_needed, static_cast<size_type>(MAX_ARENA_PAGES));
+    }
+
+    void free_storage() noexcept
+    {
+        clear();
+        if (m_page_numbers)
+        {
+            CHUNKED_VEC_FREE(m_page_numbers);
+        }
+        if (m_arena)
+        {
+            CHUNKED_VEC_VM_RELEASE(m_arena, RESERVED_BYTES);
+        }
+        reset();
+    }
+
+    void reset() noexcept
+    {
+        m_arena = nullptr;
+        m_committed_bytes = 0;
+        m_arena_page_count = 0;
+        m_free_arena_page = NO_PAGE;
+        m_page_numbers = nullptr;
+        m_page_count = 0;
+        m_page_capacity = 0;
+        m_size = 0;
+    }
+
+  public:
+    /// @brief Forward iterator that walks the vector page by page
+    template <typename ValueType> class basic_iterator
+    {
+      public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = std::remove_cv_t<ValueType>;
+        using difference_type = std::ptrdiff_t;
+        using pointer = ValueType*;
+        using reference = ValueType&;
+
+        template <typename> friend class basic_iterator;
+        friend class arena_chunked_vector;
+
+        basic_iterator() noexcept
+            : m_current(nullptr)
+            , m_page_end(nullptr)
+            , m_container(nullptr)
+            , m_page_index(0)
+        {
+        }
+
+        template <typename U, typename = std::enable_if_t<std::is_const_v<ValueType> && !std::is_const_v<U>>>
+        basic_iterator(const basic_iterator<U>& other) noexcept
+            : m_current(other.m_current)
+            , m_page_end(other.m_page_end)
+            , m_container(other.m_container)
+            , m_page_index(other.m_page_index)
+        {
+        }
+
+        reference operator*() const
+        {
+            CHUNKED_VEC_ASSERT(m_current && "Iterator out of range");
+            return *m_current;
+        }
+
+        pointer operator->() const { return &**this; }
+
+        CHUNKED_VEC_INLINE basic_iterator& operator++()
+        {
+            CHUNKED_VEC_ASSERT(m_current && "Cannot increment past the end");
+            if (++m_current == m_page_end)
+            {
+                enter_page(m_page_index + 1);
+            }
+            return *this;
+        }
+
+        CHUNKED_VEC_INLINE basic_iterator operator++(int)
+        {
+            basic_iterator temp = *this;
+            ++(*this);
+            return temp;
+        }
+
+        /// @note Every position maps to a unique element address and end() is the only position without one
+        bool operator==(const basic_iterator& other) const noexcept { return m_current == other.m_current; }
+        bool operator!=(const basic_iterator& other) const noexcept { return !(*this == other); }
+
+      private:
+        // The page end is cached so that only crossing into the next page reads the page table
+        ValueType* m_current;
+        ValueType* m_page_end;
+        const arena_chunked_vector* m_container;
+        size_type m_page_index;
+
+        basic_iterator(const arena_chunked_vector* container, size_type index) noexcept
+            : m_current(nullptr)
+            , m_page_end(nullptr)
+            , m_container(container)
+            , m_page_index(0)
+        {
+            auto [page_idx, elem_idx] = layout::split(index);
+            enter_page(page_idx);
+            if (m_current)
+            {
+                m_current += elem_idx;
+            }
+        }
+
+        /// @brief Point at the first element of the given page, or at the end sentinel (nullptr) if there is none
+        CHUNKED_VEC_INLINE void enter_page(size_type page_idx) noexcept
+        {
+            m_page_index = page_idx;
+            if (page_idx < m_container->m_page_count)
+            {
+                m_current = m_container->page_data(m_container->m_page_numbers[page_idx]);
+                m_page_end = m_current + PAGE_SIZE;
+            }
+            else
+            {
+                m_current = nullptr;
+                m_page_end = nullptr;
+            }
+        }
+    };
+};
+
+} // namespace dod
@@ -0,0 +1,559 @@
+#pragma once
+
+#include "chunked_vector.h"
+
+namespace dod
+{
+
+/// @brief A double-ended chunked container
+/// @details Same page design as chunked_vector (PAGE_SIZE contiguous elements per page, elements
+/// never move), plus a logical offset of the first element inside the first page. The allocated
+/// pages form a contiguous block in the middle of the page table that can grow at both ends:
+/// - push_front/pop_front and push_back/pop_back are O(1) worst-case in elements (only the page
+///   table itself is occasionally re-centered or grown, which costs O(pages))
+/// - random access is O(1): one add, one page/element split and one page table load
+/// - a fully consumed front page is recycled to the back of the block instead of being freed, so
+///   a steady-state FIFO queue performs no allocations at all
+///
+/// Spare (empty) pages always sit at the back of the block; push_front borrows the last one.
+///
+/// @tparam T The type of elements stored in the deque
+/// @tparam PAGE_SIZE The number of elements per page (default: 1024)
+template <typename T, size_t PAGE_SIZE = 1024> class chunked_deque
+{
+  public:
+    using value_type = T;
+    using reference = T&;
+    using const_reference = const T&;
+    using pointer = T*;
+    using const_pointer = const T*;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+
+    template <typename ValueType> class basic_iterator;
+    using iterator = basic_iterator<T>;
+    using const_iterator = basic_iterator<const T>;
+
+    /// @brief Returns the page size used by this container
+    [[nodiscard]] static constexpr size_t page_size() { return PAGE_SIZE; }
+
+    chunked_deque() noexcept
+        : m_pages(nullptr)
+        , m_table_capacity(0)
+        , m_first_page(0)
+        , m_page_count(0)
+        , m_offset(0)
+        , m_size(0)
+    {
+    }
+
+    explicit chunked_deque(size_type count)
+        : chunked_deque()
+    {
+        for (size_type i = 0; i < count; ++i)
+        {
+            emplace_back();
+        }
+    }
+
+    chunked_deque(size_type count, const T& value)
+        : chunked_deque()
+    {
+        for (size_type i = 0; i < count; ++i)
+        {
+            push_back(value);
+        }
+    }
+
+    chunked_deque(std::initializer_list<T> init)
+        : chunked_deque()
+    {
+        for (const auto& item : init)
+        {
+            push_back(item);
+        }
+    }
+
+    chunked_deque(const chunked_deque& other)
+        : chunked_deque()
+    {
+        copy_from(other);
+    }
+
+    chunked_deque(chunked_deque&& other) noexcept
+        : m_pages(other.m_pages)
+        , m_table_capacity(other.m_table_capacity)
+        , m_first_page(other.m_first_page)
+        , m_page_count(other.m_page_count)
+        , m_offset(other.m_offset)
+        , m_size(other.m_size)
+    {
+        other.m_pages = nullptr;
+        other.m_table_capacity = 0;
+        other.m_first_page = 0;
+        other.m_page_count = 0;
+        other.m_offset = 0;
+        other.m_size = 0;
+    }
+
+    ~chunked_deque() { free_pages(); }
+
+    /// @brief Copy assignment - reuses already allocated pages
+    chunked_deque& operator=(const chunked_deque& other)
+    {
+        if (this != &other)
+        {
+            clear();
+            copy_from(other);
+        }
+        return *this;
+    }
+
+    chunked_deque& operator=(chunked_deque&& other) noexcept
+    {
+        if (this != &other)
+        {
+            free_pages();
+
+            m_pages = other.m_pages;
+            m_table_capacity = other.m_table_capacity;
+            m_first_page = other.m_first_page;
+            m_page_count = other.m_page_count;
+            m_offset = other.m_offset;
+            m_size = other.m_size;
+
+            other.m_pages = nullptr;
+            other.m_table_capacity = 0;
+            other.m_first_page = 0;
+            other.m_page_count = 0;
+            other.m_offset = 0;
+            other.m_size = 0;
+        }
+        return *this;
+    }
+
+    [[nodiscard]] CHUNKED_VEC_INLINE reference operator[](size_type pos)
+    {
+        CHUNKED_VEC_ASSERT(pos < m_size && "Index out of range");
+        auto [page_idx, elem_idx] = layout::split(m_offset + pos);
+        return m_pages[m_first_page + page_idx][elem_idx];
+    }
+
+    [[nodiscard]] CHUNKED_VEC_INLINE const_reference operator[](size_type pos) const
+    {
+        CHUNKED_VEC_ASSERT(pos < m_size && "Index out of range");
+        auto [page_idx, elem_idx] = layout::split(m_offset + pos);
+        return m_pages[m_first_page + page_idx][elem_idx];
+    }
+
+    [[nodiscard]] CHUNKED_VEC_INLINE reference at(size_type pos)
+    {
+        if (pos >= m_size)
+        {
+            throw std::out_of_range("chunked_deque::at: index out of range");
+        }
+        return (*this)[pos];
+    }
+
+    [[nodiscard]] CHUNKED_VEC_INLINE const_reference at(size_type pos) const
+    {
+        if (pos >= m_size)
+        {
+            throw std::out_of_range("chunked_deque::at: index out of range");
+        }
+        return (*this)[pos];
+    }
+
+    [[nodiscard]] CHUNKED_VEC_INLINE reference front()
+    {
+        CHUNKED_VEC_ASSERT(m_size > 0 && "Cannot access front of empty chunked_deque");
+        return m_pages[m_first_page][m_offset];
+    }
+
+    [[nodiscard]] CHUNKED_VEC_INLINE const_reference front() const
+    {
+        CHUNKED_VEC_ASSERT(m_size > 0 && "Cannot access front of empty chunked_deque");
+        return m_pages[m_first_page][m_offset];
+    }
+
+    [[nodiscard]] CHUNKED_VEC_INLINE reference back()
+    {
+        CHUNKED_VEC_ASSERT(m_size > 0 && "Cannot access back of empty chunked_deque");
+        return (*this)[m_size - 1];
+    }
+
+    [[nodiscard]] CHUNKED_VEC_INLINE const_reference back() const
+    {
+        CHUNKED_VEC_ASSERT(m_size > 0 && "Cannot access back of empty chunked_deque");
+        return (*this)[m_size - 1];
+    }
+
+    [[nodiscard]] CHUNKED_VEC_INLINE iterator begin() noexcept { return iterator(this, 0); }
+    [[nodiscard]] CHUNKED_VEC_INLINE const_iterator begin() const noexcept { return const_iterator(this, 0); }
+    [[nodiscard]] CHUNKED_VEC_INLINE const_iterator cbegin() const noexcept { return const_iterator(this, 0); }
+
+    [[nodiscard]] CHUNKED_VEC_INLINE iterator end() noexcept { return iterator(this, m_size); }
+    [[nodiscard]] CHUNKED_VEC_INLINE const_iterator end() const noexcept { return const_iterator(this, m_size); }
+    [[nodiscard]] CHUNKED_VEC_INLINE const_iterator cend() const noexcept { return const_iterator(this, m_size); }
+
+    [[nodiscard]] CHUNKED_VEC_INLINE bool empty() const noexcept { return m_size == 0; }
+    [[nodiscard]] CHUNKED_VEC_INLINE size_type size() const noexcept { return m_size; }
+
+    /// @brief Number of elements the allocated pages can hold (including the unused part of the first page)
+    [[nodiscard]] CHUNKED_VEC_INLINE size_type capacity() const noexcept { return m_page_count * PAGE_SIZE; }
+
+    void push_back(const T& value) { emplace_back(value); }
+    void push_back(T&& value) { emplace_back(std::move(value)); }
+
+    /// @brief Construct an element at the end
+    /// @note Never invalidates references to other elements
+    template <typename... Args> reference emplace_back(Args&&... args)
+    {
+        auto [page_idx, elem_idx] = layout::split(m_offset + m_size);
+        if (page_idx >= m_page_count)
+        {
+            make_room_after_block();
+            m_pages[m_first_page + m_page_count] = allocate_page();
+            ++m_page_count;
+        }
+
+        T* ptr = dod::construct<T>(&m_pages[m_first_page + page_idx][elem_idx], std::forward<Args>(args)...);
+        ++m_size;
+        return *ptr;
+    }
+
+    void push_front(const T& value) { emplace_front(value); }
+    void push_front(T&& value) { emplace_front(std::move(value)); }
+
+    /// @brief Construct an element at the beginning
+    /// @note Never invalidates references to other elements
+    template <typename... Args> reference emplace_front(Args&&... args)
+    {
+        if (m_offset == 0)
+        {
+            if (m_size == 0 && m_page_count > 0)
+            {
+                // Empty deque: start from the end of the first page so that the page is filled backwards
+                m_offset = PAGE_SIZE;
+            }
+            else
+            {
+                add_front_page();
+            }
+        }
+
+        T* ptr = dod::construct<T>(&m_pages[m_first_page][m_offset - 1], std::forward<Args>(args)...);
+        --m_offset;
+        ++m_size;
+        return *ptr;
+    }
+
+    void pop_back()
+    {
+        CHUNKED_VEC_ASSERT(m_size > 0 && "Cannot pop from empty chunked_deque");
+        if constexpr (!std::is_trivially_destructible_v<T>)
+        {
+            dod::destruct(&back());
+        }
+        --m_size;
+        if (m_size == 0)
+        {
+            m_offset = 0;
+        }
+    }
+
+    /// @brief Remove the first element
+    /// @note A page that becomes fully consumed is moved to the back of the page block for reuse
+    void pop_front()
+    {
+        CHUNKED_VEC_ASSERT(m_size > 0 && "Cannot pop from empty chunked_deque");
+        if constexpr (!std::is_trivially_destructible_v<T>)
+        {
+            dod::destruct(&front());
+        }
+        ++m_offset;
+        --m_size;
+
+        if (m_size == 0)
+        {
+            m_offset = 0;
+        }
+        else if (m_offset == PAGE_SIZE)
+        {
+            recycle_front_page();
+            m_offset = 0;
+        }
+    }
+
+    /// @brief Destroy all elements, keeping every page as spare capacity
+    void clear() noexcept
+    {
+        if constexpr (!std::is_trivially_destructible_v<T>)
+        {
+            for_each_segment(0, m_size,
+                             [](T* data, size_type count)
+                             {
+                                 for (size_type elem_idx = 0; elem_idx < count; ++elem_idx)
+                                 {
+                                     dod::destruct(&data[elem_idx]);
+                                 }
+                             });
+        }
+        m_size = 0;
+        m_offset = 0;
+    }
+
+    /// @brief Free spare pages that do not hold any element
+    void shrink_to_fit() noexcept
+    {
+        const size_type live_pages = live_page_count();
+        for (size_type page_idx = live_pages; page_idx < m_page_count; ++page_idx)
+        {
+            CHUNKED_VEC_FREE(m_pages[m_first_page + page_idx]);
+            m_pages[m_first_page + page_idx] = nullptr;
+        }
+        m_page_count = live_pages;
+    }
+
+  private:
+    using layout = detail::page_layout<PAGE_SIZE>;
+
+    // Allocated pages live in m_pages[m_first_page, m_first_page + m_page_count); all other slots are nullptr.
+    // Element i is stored at logical position m_offset + i counted from the start of the first page.
+    T** m_pages;
+    size_type m_table_capacity;
+    size_type m_first_page;
+    size_type m_page_count;
+    size_type m_offset;
+    size_type m_size;
+
+    [[nodiscard]] static T* allocate_page() { return static_cast<T*>(CHUNKED_VEC_ALLOC(PAGE_SIZE * sizeof(T), safe_alignment_of<T>)); }
+
+    [[nodiscard]] CHUNKED_VEC_INLINE size_type live_page_count() const noexcept
+    {
+        return m_size == 0 ? 0 : layout::pages_needed(m_offset + m_size);
+    }
+
+    /// @brief Calls fn(data, count) for each contiguous run of elements [start, end)
+    template <typename Fn> void for_each_segment(size_type start, size_type end, Fn&& fn) const
+    {
+        size_type current_idx = start;
+        while (current_idx < end)
+        {
+            auto [page_idx, elem_idx] = layout::split(m_offset + current_idx);
+            const size_type count = std::min(end - current_idx, PAGE_SIZE - elem_idx);
+            fn(&m_pages[m_first_page + page_idx][elem_idx], count);
+            current_idx += count;
+        }
+    }
+
+    void add_front_page()
+    {
+        // Borrow the last spare page of the block if there is one, otherwise allocate
+        T* page = nullptr;
+        if (live_page_count() < m_page_count)
+        {
+            --m_page_count;
+            page = m_pages[m_first_page + m_page_count];
+            m_pages[m_first_page + m_page_count] = nullptr;
+        }
+        else
+        {
+            page = allocate_page();
+        }
+
+        if (m_first_page == 0)
+        {
+            make_room();
+        }
+        --m_first_page;
+        m_pages[m_first_page] = page;
+        ++m_page_count;
+        m_offset = PAGE_SIZE;
+    }
+
+    void recycle_front_page()
+    {
+        make_room_after_block();
+        T* page = m_pages[m_first_page];
+        m_pages[m_first_page] = nullptr;
+        m_pages[m_first_page + m_page_count] = page;
+        ++m_first_page;
+    }
+
+    CHUNKED_VEC_INLINE void make_room_after_block()
+    {
+        if (m_first_page + m_page_count == m_table_capacity)
+        {
+            make_room();
+        }
+    }
+
+    /// @brief Re-center the page block, growing the page table when it is more than half full
+    /// @note Amortized O(1) per page: after re-centering each side has at least a quarter of the table free
+    void make_room()
+    {
+        const size_type slots_needed = m_page_count + 1;
+        if (slots_needed * 2 > m_table_capacity)
+        {
+            size_type new_table_capacity = m_table_capacity + m_table_capacity / 2;
+            if (new_table_capacity < slots_needed * 2)
+            {
+                new_table_capacity = slots_needed * 2;
+            }
+
+            T** new_pages = static_cast<T**>(CHUNKED_VEC_ALLOC(new_table_capacity * sizeof(T*), safe_alignment_of<T*>));
+            std::fill(new_pages, new_pages + new_table_capacity, nullptr);
+            const size_type new_first_page = (new_table_capacity - m_page_count) / 2;
+            if (m_page_count > 0)
+            {
+                std::memcpy(new_pages + new_first_page, m_pages + m_first_page, m_page_count * sizeof(T*));
+            }
+            if (m_pages)
+            {
+                CHUNKED_VEC_FREE(m_pages);
+            }
+            m_pages = new_pages;
+            m_table_capacity = new_table_capacity;
+            m_first_page = new_first_page;
+            return;
+        }
+
+        const size_type new_first_page = (m_table_capacity - m_page_count) / 2;
+        std::memmove(m_pages + new_first_page, m_pages + m_first_page, m_page_count * sizeof(T*));
+        if (new_first_page < m_first_page)
+        {
+            const size_type stale_begin = std::max(new_first_page + m_page_count, m_first_page);
+            std::fill(m_pages + stale_begin, m_pages + m_first_page + m_page_count, nullptr);
+        }
+        else
+        {
+            std::fill(m_pages + m_first_page, m_pages + std::min(new_first_page, m_first_page + m_page_count), nullptr);
+        }
+        m_first_page = new_first_page;
+    }
+
+    void copy_from(const chunked_deque& other)
+    {
+        CHUNKED_VEC_ASSERT(m_size == 0 && "copy_from expects an empty deque");
+        other.for_each_segment(0, other.m_size,
+                               [this](const T* data, size_type count)
+                               {
+                                   for (size_type elem_idx = 0; elem_idx < count; ++elem_idx)
+                                   {
+                                       emplace_back(data[elem_idx]);
+                                   }
+                               });
+    }
+
+    void free_pages() noexcept
+    {
+        clear();
+        for (size_type page_idx = 0; page_idx < m_page_count; ++page_idx)
+        {
+            CHUNKED_VEC_FREE(m_pages[m_first_page + page_idx]);
+        }
+        if (m_pages)
+        {
+            CHUNKED_VEC_FREE(m_pages);
+        }
+        m_pages = nullptr;
+        m_table_capacity = 0;
+        m_first_page = 0;
+        m_page_count = 0;
+    }
+
+  public:
+    /// @brief Forward iterator that walks the deque page by page
+    /// @note Invalidated by push_front/push_back/pop_front (positions are relative to the current front)
+    template <typename ValueType> class basic_iterator
+    {
+      public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = std::remove_cv_t<ValueType>;
+        using difference_type = std::ptrdiff_t;
+        using pointer = ValueType*;
+        using reference = ValueType&;
+
+        template <typename> friend class basic_iterator;
+        friend class chunked_deque;
+
+        using container_pointer = std::conditional_t<std::is_const_v<ValueType>, const chunked_deque*, chunked_deque*>;
+
+        basic_iterator() noexcept
+            : m_container(nullptr)
+            , m_index(0)
+            , m_current(nullptr)
+            , m_page_end(nullptr)
+        {
+        }
+
+        template <typename U, typename = std::enable_if_t<std::is_const_v<ValueType> && !std::is_const_v<U>>>
+        basic_iterator(const basic_iterator<U>& other) noexcept
+            : m_container(other.m_container)
+            , m_index(other.m_index)
+            , m_current(other.m_current)
+            , m_page_end(other.m_page_end)
+        {
+        }
+
+        reference operator*() const
+        {
+            CHUNKED_VEC_ASSERT(m_container && m_index < m_container->size() && "Iterator out of range");
+            return *m_current;
+        }
+
+        pointer operator->() const { return &**this; }
+
+        CHUNKED_VEC_INLINE basic_iterator& operator++() noexcept
+        {
+            ++m_index;
+            if (++m_current == m_page_end)
+            {
+                update_page_cache();
+            }
+            return *this;
+        }
+
+        CHUNKED_VEC_INLINE basic_iterator operator++(int) noexcept
+        {
+            basic_iterator temp = *this;
+            ++(*this);
+            return temp;
+        }
+
+        bool operator==(const basic_iterator& other) const noexcept { return m_container == other.m_container && m_index == other.m_index; }
+        bool operator!=(const basic_iterator& other) const noexcept { return !(*this == other); }
+
+      private:
+        container_pointer m_container;
+        size_type m_index;
+        ValueType* m_current;
+        ValueType* m_page_end;
+
+        basic_iterator(container_pointer container, size_type index) noexcept
+            : m_container(container)
+            , m_index(index)
+            , m_current(nullptr)
+            , m_page_end(nullptr)
+        {
+            update_page_cache();
+        }
+
+        void update_page_cache() noexcept
+        {
+            if (m_index >= m_container->m_size)
+            {
+                m_current = nullptr;
+                m_page_end = nullptr;
+                return;
+            }
+            auto [page_idx, elem_idx] = layout::split(m_container->m_offset + m_index);
+            ValueType* page = m_container->m_pages[m_container->m_first_page + page_idx];
+            m_current = page + elem_idx;
+            m_page_end = page + PAGE_SIZE;
+        }
+    };
+};
+
+} // namespace dod
@@ -0,0 +1,411 @@
+#pragma once
+
+#include "chunked_vector.h"
+
+#include <cstdint>
+
+namespace dod
+{
+
+/// @brief An append-only log with a bounded retention window, addressed by global sequence numbers
+/// @details Entries are stored in chunked_vector style pages kept in a fixed ring of page slots.
+/// Every appended entry gets the next monotonic sequence number. Once the ring is full, the oldest
+/// page is dropped as a whole (its elements are destroyed) and reused for new entries, so memory
+/// stays fixed after warm-up and no element is ever moved.
+///
+/// Lookup subtracts the sequence number of the oldest retained entry and goes through the page
+/// ring, so checking whether a sequence number is still retained is a single comparison.
+///
+/// The log always retains at least the most recent `retention` entries (up to one extra page).
+///
+/// @tparam T The type of entries stored in the log
+/// @tparam PAGE_SIZE The number of entries per page (default: 1024)
+template <typename T, size_t PAGE_SIZE = 1024> class chunked_ring_log
+{
+  public:
+    using value_type = T;
+    using reference = T&;
+    using const_reference = const T&;
+    using pointer = T*;
+    using const_pointer = const T*;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using sequence_type = uint64_t;
+
+    template <typename ValueType> class basic_iterator;
+    using iterator = basic_iterator<T>;
+    using const_iterator = basic_iterator<const T>;
+
+    /// @brief Returns the page size used by this container
+    [[nodiscard]] static constexpr size_t page_size() { return PAGE_SIZE; }
+
+    /// @brief Create a log that retains at least the last `retention` entries
+    /// @param retention Minimum number of most recent entries to keep (must be > 0)
+    /// @param first_sequence Sequence number assigned to the first appended entry
+    explicit chunked_ring_log(size_type retention, sequence_type first_sequence = 0)
+        : m_pages(nullptr)
+        , m_ring_size(layout::pages_needed(retention) + 1)
+        , m_head(0)
+        , m_retention(retention)
+        , m_base_seq(first_sequence)
+        , m_next_seq(first_sequence)
+    {
+        CHUNKED_VEC_ASSERT(retention > 0 && "Retention must be greater than 0");
+        // The page table is allocated once; pages themselves are allocated on first use
+        m_pages = static_cast<T**>(CHUNKED_VEC_ALLOC(m_ring_size * sizeof(T*), safe_alignment_of<T*>));
+        std::fill(m_pages, m_pages + m_ring_size, nullptr);
+    }
+
+    chunked_ring_log(const chunked_ring_log& other)
+        : chunked_ring_log(other.m_retention, other.m_base_seq)
+    {
+        copy_from(other);
+    }
+
+    chunked_ring_log(chunked_ring_log&& other) noexcept
+        : m_pages(other.m_pages)
+        , m_ring_size(other.m_ring_size)
+        , m_head(other.m_head)
+        , m_retention(other.m_retention)
+        , m_base_seq(other.m_base_seq)
+        , m_next_seq(other.m_next_seq)
+    {
+        // The moved-from log keeps its sequence position but owns no pages
+        other.m_pages = nullptr;
+        other.m_ring_size = 0;
+        other.m_head = 0;
+        other.m_base_seq = other.m_next_seq;
+    }
+
+    ~chunked_ring_log() { free_pages(); }
+
+    chunked_ring_log& operator=(const chunked_ring_log& other)
+    {
+        if (this != &other)
+        {
+            chunked_ring_log copy(other);
+            *this = std::move(copy);
+        }
+        return *this;
+    }
+
+    chunked_ring_log& operator=(chunked_ring_log&& other) noexcept
+    {
+        if (this != &other)
+        {
+            free_pages();
+
+            m_pages = other.m_pages;
+            m_ring_size = other.m_ring_size;
+            m_head = other.m_head;
+            m_retention = other.m_retention;
+            m_base_seq = other.m_base_seq;
+            m_next_seq = other.m_next_seq;
+
+            other.m_pages = nullptr;
+            other.m_ring_size = 0;
+            other.m_head = 0;
+            other.m_base_seq = other.m_next_seq;
+        }
+        return *this;
+    }
+
+    /// @brief Append an entry
+    /// @return Sequence number of the new entry
+    /// @note Time complexity: O(1), or O(PAGE_SIZE) destructor calls when the oldest page is dropped
+    sequence_type push_back(const T& value) { return emplace_back(value); }
+    sequence_type push_back(T&& value) { return emplace_back(std::move(value)); }
+
+    template <typename... Args> sequence_type emplace_back(Args&&... args)
+    {
+        CHUNKED_VEC_ASSERT(m_pages && "Appending to a moved-from chunked_ring_log");
+        auto [page_idx, elem_idx] = layout::split(static_cast<size_type>(m_next_seq - m_base_seq));
+        if (page_idx == m_ring_size)
+        {
+            // Every ring slot holds live entries: the oldest page becomes the new tail page
+            drop_oldest_page();
+            --page_idx;
+        }
+
+        const size_type slot = ring_slot(page_idx);
+        if (m_pages[slot] == nullptr)
+        {
+            m_pages[slot] = allocate_page();
+        }
+
+        dod::construct<T>(&m_pages[slot][elem_idx], std::forward<Args>(args)...);
+        return m_next_seq++;
+    }
+
+    /// @brief Returns true if the entry with this sequence number is still retained
+    [[nodiscard]] CHUNKED_VEC_INLINE bool contains(sequence_type seq) const noexcept { return seq >= m_base_seq && seq < m_next_seq; }
+
+    /// @brief Access a retained entry by sequence number
+    [[nodiscard]] CHUNKED_VEC_INLINE reference operator[](sequence_type seq)
+    {
+        CHUNKED_VEC_ASSERT(contains(seq) && "Sequence number is not retained");
+        return *entry_at(seq);
+    }
+
+    [[nodiscard]] CHUNKED_VEC_INLINE const_reference operator[](sequence_type seq) const
+    {
+        CHUNKED_VEC_ASSERT(contains(seq) && "Sequence number is not retained");
+        return *entry_at(seq);
+    }
+
+    [[nodiscard]] reference at(sequence_type seq)
+    {
+        if (!contains(seq))
+        {
+            throw std::out_of_range("chunked_ring_log::at: sequence number is not retained");
+        }
+        return *entry_at(seq);
+    }
+
+    [[nodiscard]] const_reference at(sequence_type seq) const
+    {
+        if (!contains(seq))
+        {
+            throw std::out_of_range("chunked_ring_log::at: sequence number is not retained");
+        }
+        return *entry_at(seq);
+    }
+
+    /// @brief Returns a pointer to the entry or nullptr if it was dropped (or not written yet)
+    [[nodiscard]] CHUNKED_VEC_INLINE T* get(sequence_type seq) noexcept { return contains(seq) ? entry_at(seq) : nullptr; }
+    [[nodiscard]] CHUNKED_VEC_INLINE const T* get(sequence_type seq) const noexcept { return contains(seq) ? entry_at(seq) : nullptr; }
+
+    [[nodiscard]] CHUNKED_VEC_INLINE reference front() { return (*this)[m_base_seq]; }
+    [[nodiscard]] CHUNKED_VEC_INLINE const_reference front() const { return (*this)[m_base_seq]; }
+    [[nodiscard]] CHUNKED_VEC_INLINE reference back() { return (*this)[m_next_seq - 1]; }
+    [[nodiscard]] CHUNKED_VEC_INLINE const_reference back() const { return (*this)[m_next_seq - 1]; }
+
+    /// @brief Sequence number of the oldest retained entry
+    [[nodiscard]] CHUNKED_VEC_INLINE sequence_type first_sequence() const noexcept { return m_base_seq; }
+
+    /// @brief Sequence number the next appended entry will get
+    [[nodiscard]] CHUNKED_VEC_INLINE sequence_type next_sequence() const noexcept { return m_next_seq; }
+
+    [[nodiscard]] CHUNKED_VEC_INLINE bool empty() const noexcept { return m_next_seq == m_base_seq; }
+    [[nodiscard]] CHUNKED_VEC_INLINE size_type size() const noexcept { return static_cast<size_type>(m_next_seq - m_base_seq); }
+    [[nodiscard]] CHUNKED_VEC_INLINE size_type retention() const noexcept { return m_retention; }
+
+    /// @brief Maximum number of entries held before the oldest page is dropped
+    [[nodiscard]] CHUNKED_VEC_INLINE size_type capacity() const noexcept { return m_ring_size * PAGE_SIZE; }
+
+    [[nodiscard]] CHUNKED_VEC_INLINE iterator begin() noexcept { return iterator(this, m_base_seq); }
+    [[nodiscard]] CHUNKED_VEC_INLINE const_iterator begin() const noexcept { return const_iterator(this, m_base_seq); }
+    [[nodiscard]] CHUNKED_VEC_INLINE const_iterator cbegin() const noexcept { return const_iterator(this, m_base_seq); }
+
+    [[nodiscard]] CHUNKED_VEC_INLINE iterator end() noexcept { return iterator(this, m_next_seq); }
+    [[nodiscard]] CHUNKED_VEC_INLINE const_iterator end() const noexcept { return const_iterator(this, m_next_seq); }
+    [[nodiscard]] CHUNKED_VEC_INLINE const_iterator cend() const noexcept { return const_iterator(this, m_next_seq); }
+
+    /// @brief Drop every retained entry; sequence numbers keep counting from next_sequence()
+    /// @note Pages are kept for reuse
+    void clear() noexcept
+    {
+        destroy_all();
+        m_base_seq = m_next_seq;
+    }
+
+  private:
+    using layout = detail::page_layout<PAGE_SIZE>;
+
+    // Ring of page slots; the oldest retained page is at m_head. Entry seq lives at index
+    // (seq - m_base_seq) counted from the start of the head page.
+    T** m_pages;
+    size_type m_ring_size;
+    size_type m_head;
+    size_type m_retention;
+    sequence_type m_base_seq;
+    sequence_type m_next_seq;
+
+    [[nodiscard]] static T* allocate_page() { return static_cast<T*>(CHUNKED_VEC_ALLOC(PAGE_SIZE * sizeof(T), safe_alignment_of<T>)); }
+
+    [[nodiscard]] CHUNKED_VEC_INLINE size_type ring_slot(size_type page_idx) const noexcept
+    {
+        const size_type slot = m_head + page_idx;
+        return slot >= m_ring_size ? slot - m_ring_size : slot;
+    }
+
+    [[nodiscard]] CHUNKED_VEC_INLINE T* entry_at(sequence_type seq) const noexcept
+    {
+        auto [page_idx, elem_idx] = layout::split(static_cast<size_type>(seq - m_base_seq));
+        return &m_pages[ring_slot(page_idx)][elem_idx];
+    }
+
+    void drop_oldest_page() noexcept
+    {
+        if constexpr (!std::is_trivially_destructible_v<T>)
+        {
+            T* page = m_pages[m_head];
+            for (size_type elem_idx = 0; elem_idx < PAGE_SIZE; ++elem_idx)
+            {
+                dod::destruct(&page[elem_idx]);
+            }
+        }
+        m_head = ring_slot(1);
+        m_base_seq += PAGE_SIZE;
+    }
+
+    /// @brief Destroy all retained entries page by page
+    void destroy_all() noexcept
+    {
+        if constexpr (!std::is_trivially_destructible_v<T>)
+        {
+            size_type remaining = size();
+            for (size_type page_idx = 0; remaining > 0; ++page_idx)
+            {
+                T* page = m_pages[ring_slot(page_idx)];
+                const size_type count = std::min(remaining, PAGE_SIZE);
+                for (size_type elem_idx = 0; elem_idx < count; ++elem_idx)
+                {
+                    dod::destruct(&page[elem_idx]);
+                }
+                remaining -= count;
+            }
+        }
+    }
+
+    void copy_from(const chunked_ring_log& other)
+    {
+        CHUNKED_VEC_ASSERT(empty() && "copy_from expects an empty log");
+        size_type remaining = other.size();
+        for (size_type page_idx = 0; remaining > 0; ++page_idx)
+        {
+            const T* src = other.m_pages[other.ring_slot(page_idx)];
+            T* dst = m_pages[page_idx] = allocate_page();
+            const size_type count = std::min(remaining, PAGE_SIZE);
+            if constexpr (std::is_trivially_copyable_v<T>)
+            {
+                std::memcpy(dst, src, count * sizeof(T));
+                m_next_seq += count;
+            }
+            else
+            {
+                for (size_type elem_idx = 0; elem_idx < count; ++elem_idx)
+                {
+                    dod::construct<T>(&dst[elem_idx], src[elem_idx]);
+                    ++m_next_seq;
+                }
+            }
+            remaining -= count;
+        }
+    }
+
+    void free_pages() noexcept
+    {
+        if (!m_pages)
+        {
+            return;
+        }
+        destroy_all();
+        for (size_type slot = 0; slot < m_ring_size; ++slot)
+        {
+            if (m_pages[slot])
+            {
+                CHUNKED_VEC_FREE(m_pages[slot]);
+            }
+        }
+        CHUNKED_VEC_FREE(m_pages);
+        m_pages = nullptr;
+        m_base_seq = m_next_seq;
+    }
+
+  public:
+    /// @brief Forward iterator over retained entries, oldest first
+    template <typename ValueType> class basic_iterator
+    {
+      public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = std::remove_cv_t<ValueType>;
+        using difference_type = std::ptrdiff_t;
+        using pointer = ValueType*;
+        using reference = ValueType&;
+
+        template <typename> friend class basic_iterator;
+        friend class chunked_ring_log;
+
+        using container_pointer = std::conditional_t<std::is_const_v<ValueType>, const chunked_ring_log*, chunked_ring_log*>;
+
+        basic_iterator() noexcept
+            : m_container(nullptr)
+            , m_seq(0)
+            , m_current(nullptr)
+            , m_page_end(nullptr)
+        {
+        }
+
+        template <typename U, typename = std::enable_if_t<std::is_const_v<ValueType> && !std::is_const_v<U>>>
+        basic_iterator(const basic_iterator<U>& other) noexcept
+            : m_container(other.m_container)
+            , m_seq(other.m_seq)
+            , m_current(other.m_current)
+            , m_page_end(other.m_page_end)
+        {
+        }
+
+        reference operator*() const
+        {
+            CHUNKED_VEC_ASSERT(m_container && m_container->contains(m_seq) && "Iterator out of range");
+            return *m_current;
+        }
+
+        pointer operator->() const { return &**this; }
+
+        /// @brief Sequence number of the current entry
+        [[nodiscard]] sequence_type sequence() const noexcept { return m_seq; }
+
+        CHUNKED_VEC_INLINE basic_iterator& operator++() noexcept
+        {
+            ++m_seq;
+            if (++m_current == m_page_end)
+            {
+                update_page_cache();
+            }
+            return *this;
+        }
+
+        CHUNKED_VEC_INLINE basic_iterator operator++(int) noexcept
+        {
+            basic_iterator temp = *this;
+            ++(*this);
+            return temp;
+        }
+
+        bool operator==(const basic_iterator& other) const noexcept { return m_container == other.m_container && m_seq == other.m_seq; }
+        bool operator!=(const basic_iterator& other) const noexcept { return !(*this == other); }
+
+      private:
+        container_pointer m_container;
+        sequence_type m_seq;
+        ValueType* m_current;
+        ValueType* m_page_end;
+
+        basic_iterator(container_pointer container, sequence_type seq) noexcept
+            : m_container(container)
+            , m_seq(seq)
+            , m_current(nullptr)
+            , m_page_end(nullptr)
+        {
+            update_page_cache();
+        }
+
+        void update_page_cache() noexcept
+        {
+            if (!m_container->contains(m_seq))
+            {
+                m_current = nullptr;
+                m_page_end = nullptr;
+                return;
+            }
+            auto [page_idx, elem_idx] = layout::split(static_cast<size_type>(m_seq - m_container->m_base_seq));
+            ValueType* page = m_container->m_pages[m_container->ring_slot(page_idx)];
+            m_current = page + elem_idx;
+            m_page_end = page + PAGE_SIZE;
+        }
+    };
+};
+
+} // namespace dod
@@ -0,0 +1,289 @@
+#pragma once
+
+#include "chunked_vector.h"
+#include <functional>
+
+namespace dod
+{
+
+namespace detail
+{
+
+/// @brief Number of leading indices in [0, count) for which pred holds (pred must be partitioned)
+/// @details Branchless: every step halves the range with a conditional move instead of a branch,
+/// so the loop runs exactly ceil(log2(count)) iterations regardless of the data.
+template <typename Pred> [[nodiscard]] CHUNKED_VEC_INLINE size_t branchless_partition_point(size_t count, Pred&& pred)
+{
+    if (count == 0)
+    {
+        return 0;
+    }
+
+    size_t base = 0;
+    while (count > 1)
+    {
+        const size_t half = count / 2;
+        base = pred(base + half) ? base + half : base;
+        count -= half;
+    }
+    return base + (pred(base) ? 1 : 0);
+}
+
+/// @brief Branchless partition point over contiguous elements
+/// @details Without branches the CPU cannot speculate into the next probe, so both candidate
+/// probes of the next step are prefetched to overlap their cache misses with the current one.
+template <typename T, typename Pred> [[nodiscard]] CHUNKED_VEC_INLINE size_t branchless_partition_point(const T* data, size_t count, Pred&& pred)
+{
+    if (count == 0)
+    {
+        return 0;
+    }
+
+    const T* base = data;
+    while (count > 1)
+    {
+        const size_t half = count / 2;
+        CHUNKED_VEC_PREFETCH(base + half / 2);
+        CHUNKED_VEC_PREFETCH(base + half + half / 2);
+        base = pred(base[half]) ? base + half : base;
+        count -= half;
+    }
+    return static_cast<size_t>(base - data) + (pred(*base) ? 1 : 0);
+}
+
+/// @brief Finish a search inside page page_end - 1 once the number of pages whose first key satisfies pred is known
+template <typename T, size_t PAGE_SIZE, size_t MIN_FIRST_PAGE_SIZE, size_t INLINE_CAPACITY, typename SizeType, typename Pred>
+[[nodiscard]] CHUNKED_VEC_INLINE size_t
+search_in_page(const chunked_vector<T, PAGE_SIZE, MIN_FIRST_PAGE_SIZE, INLINE_CAPACITY, SizeType>& vec, size_t page_end, Pred&& pred)
+{
+    if (page_end == 0)
+    {
+        return 0;
+    }
+    const page_segment<const T> page = vec.segment(page_end - 1);
+    return (page_end - 1) * PAGE_SIZE + branchless_partition_point(page.data, page.size, pred);
+}
+
+} // namespace detail
+
+/// @brief Index of the first element of a sorted chunked_vector that is not less than key
+/// @details Searches the first element of every page to pick a page, then does a branchless
+/// binary search inside that single contiguous page.
+/// @return Index in [0, vec.size()]
+template <typename T, size_t PAGE_SIZE, size_t MIN_FIRST_PAGE_SIZE, size_t INLINE_CAPACITY, typename SizeType,
+          typename Compare = std::less<T>>
+[[nodiscard]] size_t lower_bound(const chunked_vector<T, PAGE_SIZE, MIN_FIRST_PAGE_SIZE, INLINE_CAPACITY, SizeType>& vec,
+                                 const detail::type_identity_t<T>& key, Compare comp = Compare())
+{
+    auto pred = [&](const T& value) { return comp(value, key); };
+    const size_t page_end = detail::branchless_partition_point(vec.segment_count(), [&](size_t page_idx) { return pred(vec.segment(page_idx)[0]); });
+    return detail::search_in_page(vec, page_end, pred);
+}
+
+/// @brief Index of the first element of a sorted chunked_vector that is greater than key
+/// @return Index in [0, vec.size()]
+template <typename T, size_t PAGE_SIZE, size_t MIN_FIRST_PAGE_SIZE, size_t INLINE_CAPACITY, typename SizeType,
+          typename Compare = std::less<T>>
+[[nodiscard]] size_t upper_bound(const chunked_vector<T, PAGE_SIZE, MIN_FIRST_PAGE_SIZE, INLINE_CAPACITY, SizeType>& vec,
+                                 const detail::type_identity_t<T>& key, Compare comp = Compare())
+{
+    auto pred = [&](const T& value) { return !comp(key, value); };
+    const size_t page_end = detail::branchless_partition_point(vec.segment_count(), [&](size_t page_idx) { return pred(vec.segment(page_idx)[0]); });
+    return detail::search_in_page(vec, page_end, pred);
+}
+
+/// @brief Copy of the first key of every page of a sorted chunked_vector, in Eytzinger (BFS) order
+/// @details The fences of a million-element vector fit in a few KB, and the Eytzinger layout puts the
+/// first levels of the implicit search tree next to each other, so picking a page touches only
+/// cache-resident memory and never dereferences the page table. The index is a snapshot: rebuild it
+/// with build_fence_index() after modifying the vector.
+/// @tparam T Key type (must be copyable)
+/// @tparam PAGE_SIZE Page size of the indexed chunked_vector
+/// @tparam Compare Ordering of the indexed vector (default: std::less<T>)
+template <typename T, size_t PAGE_SIZE, typename Compare = std::less<T>> class fence_index
+{
+  public:
+    using size_type = std::size_t;
+
+    fence_index() noexcept
+        : m_keys(nullptr)
+        , m_ranks(nullptr)
+        , m_page_count(0)
+        , m_compare()
+    {
+    }
+
+    template <size_t MIN_FIRST_PAGE_SIZE, size_t INLINE_CAPACITY, typename SizeType>
+    explicit fence_index(const chunked_vector<T, PAGE_SIZE, MIN_FIRST_PAGE_SIZE, INLINE_CAPACITY, SizeType>& vec, Compare comp = Compare())
+        : m_keys(nullptr)
+        , m_ranks(nullptr)
+        , m_page_count(0)
+        , m_compare(comp)
+    {
+        allocate(vec.segment_count());
+        size_type next_page = 0;
+        fill(vec, 1, next_page);
+        CHUNKED_VEC_ASSERT(next_page == m_page_count && "Every page must be placed in the index");
+    }
+
+    fence_index(const fence_index& other)
+        : m_keys(nullptr)
+        , m_ranks(nullptr)
+        , m_page_count(0)
+        , m_compare(other.m_compare)
+    {
+        allocate(other.m_page_count);
+        for (size_type node = 1; node <= m_page_count; ++node)
+        {
+            dod::construct<T>(m_keys + node, other.m_keys[node]);
+        }
+        if (m_page_count > 0)
+        {
+            std::memcpy(m_ranks, other.m_ranks, (m_page_count + 1) * sizeof(size_type));
+        }
+    }
+
+    fence_index(fence_index&& other) noexcept
+        : m_keys(other.m_keys)
+        , m_ranks(other.m_ranks)
+        , m_page_count(other.m_page_count)
+        , m_compare(std::move(other.m_compare))
+    {
+        other.m_keys = nullptr;
+        other.m_ranks = nullptr;
+        other.m_page_count = 0;
+    }
+
+    ~fence_index() { release(); }
+
+    fence_index& operator=(const fence_index& other)
+    {
+        if (this != &other)
+        {
+            fence_index copy(other);
+            *this = std::move(copy);
+        }
+        return *this;
+    }
+
+    fence_index& operator=(fence_index&& other) noexcept
+    {
+        if (this != &other)
+        {
+            release();
+            m_keys = other.m_keys;
+            m_ranks = other.m_ranks;
+            m_page_count = other.m_page_count;
+            m_compare = std::move(other.m_compare);
+            other.m_keys = nullptr;
+            other.m_ranks = nullptr;
+            other.m_page_count = 0;
+        }
+        return *this;
+    }
+
+    /// @brief Number of indexed pages
+    [[nodiscard]] CHUNKED_VEC_INLINE size_type page_count() const noexcept { return m_page_count; }
+
+    /// @brief Number of pages whose first key satisfies pred (pred must be partitioned over the pages)
+    template <typename Pred> [[nodiscard]] CHUNKED_VEC_INLINE size_type count_pages(Pred&& pred) const
+    {
+        // Descend the implicit tree: the path bits record whether each visited fence satisfied pred
+        size_type node = 1;
+        while (node <= m_page_count)
+        {
+            node = 2 * node + (pred(m_keys[node]) ? 1 : 0);
+        }
+        // Strip the trailing "went right" steps and the final "went left" step to get the first fence failing pred
+        node >>= detail::lowest_set_bit(~static_cast<uint64_t>(node)) + 1;
+        return node == 0 ? m_page_count : m_ranks[node];
+    }
+
+    [[nodiscard]] const Compare& compare() const noexcept { return m_compare; }
+
+  private:
+    // 1-based Eytzinger arrays: node k has children 2k and 2k + 1; m_ranks[k] is the page index of m_keys[k]
+    T* m_keys;
+    size_type* m_ranks;
+    size_type m_page_count;
+    Compare m_compare;
+
+    void allocate(size_type page_count)
+    {
+        if (page_count == 0)
+        {
+            return;
+        }
+        m_keys = static_cast<T*>(CHUNKED_VEC_ALLOC((page_count + 1) * sizeof(T), safe_alignment_of<T>));
+        m_ranks = static_cast<size_type*>(CHUNKED_VEC_ALLOC((page_count + 1) * sizeof(size_type), safe_alignment_of<size_type>));
+        m_ranks[0] = 0;
+        m_page_count = page_count;
+    }
+
+    /// @brief In-order walk of the implicit tree assigns pages in ascending order
+    template <size_t MIN_FIRST_PAGE_SIZE, size_t INLINE_CAPACITY, typename SizeType>
+    void fill(const chunked_vector<T, PAGE_SIZE, MIN_FIRST_PAGE_SIZE, INLINE_CAPACITY, SizeType>& vec, size_type node, size_type& next_page)
+    {
+        if (node > m_page_count)
+        {
+            return;
+        }
+        fill(vec, 2 * node, next_page);
+        dod::construct<T>(m_keys + node, vec.segment(next_page)[0]);
+        m_ranks[node] = next_page++;
+        fill(vec, 2 * node + 1, next_page);
+    }
+
+    void release() noexcept
+    {
+        if (m_keys)
+        {
+            if constexpr (!std::is_trivially_destructible_v<T>)
+            {
+                for (size_type node = 1; node <= m_page_count; ++node)
+                {
+                    dod::destruct(m_keys + node);
+                }
+            }
+            CHUNKED_VEC_FREE(m_keys);
+            CHUNKED_VEC_FREE(m_ranks);
+        }
+        m_keys = nullptr;
+        m_ranks = nullptr;
+        m_page_count = 0;
+    }
+};
+
+/// @brief Build a fence index over a sorted chunked_vector
+/// @note Rebuild the index after modifying the vector; searches assume it matches the vector's pages
+template <typename T, size_t PAGE_SIZE, size_t MIN_FIRST_PAGE_SIZE, size_t INLINE_CAPACITY, typename SizeType,
+          typename Compare = std::less<T>>
+[[nodiscard]] fence_index<T, PAGE_SIZE, Compare>
+build_fence_index(const chunked_vector<T, PAGE_SIZE, MIN_FIRST_PAGE_SIZE, INLINE_CAPACITY, SizeType>& vec, Compare comp = Compare())
+{
+    return fence_index<T, PAGE_SIZE, Compare>(vec, comp);
+}
+
+/// @brief lower_bound that picks the page through a fence index
+template <typename T, size_t PAGE_SIZE, size_t MIN_FIRST_PAGE_SIZE, size_t INLINE_CAPACITY, typename SizeType, typename Compare>
+[[nodiscard]] size_t lower_bound(const chunked_vector<T, PAGE_SIZE, MIN_FIRST_PAGE_SIZE, INLINE_CAPACITY, SizeType>& vec,
+                                 const fence_index<T, PAGE_SIZE, Compare>& index, const detail::type_identity_t<T>& key)
+{
+    CHUNKED_VEC_ASSERT(index.page_count() == vec.segment_count() && "Fence index is out of date");
+    const Compare& comp = index.compare();
+    auto pred = [&](const T& value) { return comp(value, key); };
+    return detail::search_in_page(vec, index.count_pages(pred), pred);
+}
+
+/// @brief upper_bound that picks the page through a fence index
+template <typename T, size_t PAGE_SIZE, size_t MIN_FIRST_PAGE_SIZE, size_t INLINE_CAPACITY, typename SizeType, typename Compare>
+[[nodiscard]] size_t upper_bound(const chunked_vector<T, PAGE_SIZE, MIN_FIRST_PAGE_SIZE, INLINE_CAPACITY, SizeType>& vec,
+                                 const fence_index<T, PAGE_SIZE, Compare>& index, const detail::type_identity_t<T>& key)
+{
+    CHUNKED_VEC_ASSERT(index.page_count() == vec.segment_count() && "Fence index is out of date");
+    const Compare& comp = index.compare();
+    auto pred = [&](const T& value) { return !comp(key, value); };
+    return detail::search_in_page(vec, index.count_pages(pred), pred);
+}
+
+} // namespace dod
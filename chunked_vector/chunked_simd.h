@@ -0,0 +1,861 @@
+#pragma once
+
+#include "chunked_vector.h"
+
+#include <array>
+#include <atomic>
+
+// SIMD kernels are compiled for x86-64 only; every other target uses the scalar kernels
+#if !defined(CHUNKED_VEC_SIMD_X86)
+#if defined(__x86_64__) || defined(_M_X64)
+#define CHUNKED_VEC_SIMD_X86 1
+#else
+#define CHUNKED_VEC_SIMD_X86 0
+#endif
+#endif
+
+#if CHUNKED_VEC_SIMD_X86
+#include <immintrin.h>
+#if defined(__GNUC__) || defined(__clang__)
+// AVX2/AVX-512 kernels are compiled for their instruction set regardless of -march and only called after runtime detection
+#define CHUNKED_VEC_TARGET_AVX2 __attribute__((target("avx2")))
+#define CHUNKED_VEC_TARGET_AVX512 __attribute__((target("avx512f,avx512bw")))
+#else
+#define CHUNKED_VEC_TARGET_AVX2
+#define CHUNKED_VEC_TARGET_AVX512
+#endif
+#endif
+
+namespace dod
+{
+namespace simd
+{
+
+/// @brief Instruction set used by the kernels, in increasing order of width
+enum class level
+{
+    scalar,
+    sse2,
+    avx2,
+    avx512 ///< AVX-512F + AVX-512BW
+};
+
+/// @brief Accumulator type of sum() and dot(): floating-point types keep their type, integers widen to 64 bits
+template <typename T>
+using sum_result_t = std::conditional_t<std::is_floating_point_v<T>, T, std::conditional_t<std::is_signed_v<T>, int64_t, uint64_t>>;
+
+namespace detail
+{
+
+[[nodiscard]] CHUNKED_VEC_INLINE size_t popcount(uint64_t bits) noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<size_t>(__builtin_popcountll(bits));
+#else
+    // POPCNT is not part of the SSE2 baseline
+    bits = bits - ((bits >> 1) & 0x5555555555555555ull);
+    bits = (bits & 0x3333333333333333ull) + ((bits >> 2) & 0x3333333333333333ull);
+    bits = (bits + (bits >> 4)) & 0x0F0F0F0F0F0F0F0Full;
+    return static_cast<size_t>((bits * 0x0101010101010101ull) >> 56);
+#endif
+}
+
+[[nodiscard]] inline level detect_level() noexcept
+{
+#if CHUNKED_VEC_SIMD_X86
+#if defined(_MSC_VER) && !defined(__clang__)
+    int info[4];
+    __cpuid(info, 0);
+    const int max_leaf = info[0];
+    __cpuid(info, 1);
+    const bool os_saves_ymm = (info[2] & (1 << 27)) != 0 && (info[2] & (1 << 28)) != 0;
+    if (!os_saves_ymm || max_leaf < 7)
+    {
+        return level::sse2;
+    }
+    const unsigned long long xcr0 = _xgetbv(0);
+    if ((xcr0 & 0x6) != 0x6)
+    {
+        return level::sse2;
+    }
+    __cpuidex(info, 7, 0);
+    const bool avx2 = (info[1] & (1 << 5)) != 0;
+    const bool avx512 = (info[1] & (1 << 16)) != 0 && (info[1] & (1 << 30)) != 0 && (xcr0 & 0xE6) == 0xE6;
+    return avx512 ? level::avx512 : (avx2 ? level::avx2 : level::sse2);
+#else
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw"))
+    {
+        return level::avx512;
+    }
+    return __builtin_cpu_supports("avx2") ? level::avx2 : level::sse2;
+#endif
+#else
+    return level::scalar;
+#endif
+}
+
+inline std::atomic<level>& level_limit() noexcept
+{
+    static std::atomic<level> limit{level::avx512};
+    return limit;
+}
+
+/// @brief Reference kernels; also used for element types and operations without a vector implementation
+struct scalar_kernels
+{
+    template <typename T> static size_t find(const T* data, size_t count, T value)
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            if (data[i] == value)
+            {
+                return i;
+            }
+        }
+        return count;
+    }
+
+    template <typename T> static size_t count(const T* data, size_t count, T value)
+    {
+        size_t matches = 0;
+        for (size_t i = 0; i < count; ++i)
+        {
+            matches += data[i] == value ? 1 : 0;
+        }
+        return matches;
+    }
+
+    template <typename T> static T min_value(const T* data, size_t count)
+    {
+        T result = data[0];
+        for (size_t i = 1; i < count; ++i)
+        {
+            result = data[i] < result ? data[i] : result;
+        }
+        return result;
+    }
+
+    template <typename T> static T max_value(const T* data, size_t count)
+    {
+        T result = data[0];
+        for (size_t i = 1; i < count; ++i)
+        {
+            result = result < data[i] ? data[i] : result;
+        }
+        return result;
+    }
+
+    template <typename T> static sum_result_t<T> sum(const T* data, size_t count)
+    {
+        sum_result_t<T> result = 0;
+        for (size_t i = 0; i < count; ++i)
+        {
+            result += static_cast<sum_result_t<T>>(data[i]);
+        }
+        return result;
+    }
+
+    template <typename T> static sum_result_t<T> dot(const T* a, const T* b, size_t count)
+    {
+        sum_result_t<T> result = 0;
+        for (size_t i = 0; i < count; ++i)
+        {
+            result += static_cast<sum_result_t<T>>(a[i]) * static_cast<sum_result_t<T>>(b[i]);
+        }
+        return result;
+    }
+};
+
+#if CHUNKED_VEC_SIMD_X86
+
+// Per instruction set and element type operations. Each specialization provides:
+//   vec / lanes / load / store / set1 / eq_mask (one bit per lane)
+//   has_minmax: vmin / vmax
+//   acc / acc_lanes / acc_zero / acc_add / acc_store (sum accumulator, widened for integers)
+//   has_dot: acc_dot
+template <typename T> struct sse2_ops
+{
+    static constexpr bool supported = false;
+};
+
+template <> struct sse2_ops<float>
+{
+    static constexpr bool supported = true;
+    static constexpr bool has_minmax = true;
+    static constexpr bool has_dot = true;
+    using vec = __m128;
+    using acc = __m128;
+    static constexpr size_t lanes = 4;
+    static constexpr size_t acc_lanes = 4;
+
+    static CHUNKED_VEC_INLINE vec load(const float* p) { return _mm_loadu_ps(p); }
+    static CHUNKED_VEC_INLINE void store(float* p, vec v) { _mm_storeu_ps(p, v); }
+    static CHUNKED_VEC_INLINE vec set1(float value) { return _mm_set1_ps(value); }
+    static CHUNKED_VEC_INLINE uint64_t eq_mask(vec a, vec b) { return static_cast<uint64_t>(_mm_movemask_ps(_mm_cmpeq_ps(a, b))); }
+    static CHUNKED_VEC_INLINE vec vmin(vec a, vec b) { return _mm_min_ps(a, b); }
+    static CHUNKED_VEC_INLINE vec vmax(vec a, vec b) { return _mm_max_ps(a, b); }
+    static CHUNKED_VEC_INLINE acc acc_zero() { return _mm_setzero_ps(); }
+    static CHUNKED_VEC_INLINE acc acc_add(acc sum, vec v) { return _mm_add_ps(sum, v); }
+    static CHUNKED_VEC_INLINE acc acc_dot(acc sum, vec a, vec b) { return _mm_add_ps(sum, _mm_mul_ps(a, b)); }
+    static CHUNKED_VEC_INLINE void acc_store(float* p, acc sum) { _mm_storeu_ps(p, sum); }
+};
+
+template <> struct sse2_ops<int32_t>
+{
+    static constexpr bool supported = true;
+    static constexpr bool has_minmax = true;
+    static constexpr bool has_dot = false; // signed 32x32->64 multiply needs SSE4.1
+    using vec = __m128i;
+    using acc = __m128i;
+    static constexpr size_t lanes = 4;
+    static constexpr size_t acc_lanes = 2;
+
+    static CHUNKED_VEC_INLINE vec load(const int32_t* p) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p)); }
+    static CHUNKED_VEC_INLINE void store(int32_t* p, vec v) { _mm_storeu_si128(reinterpret_cast<__m128i*>(p), v); }
+    static CHUNKED_VEC_INLINE vec set1(int32_t value) { return _mm_set1_epi32(value); }
+    static CHUNKED_VEC_INLINE uint64_t eq_mask(vec a, vec b)
+    {
+        return static_cast<uint64_t>(_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(a, b))));
+    }
+    static CHUNKED_VEC_INLINE vec vmin(vec a, vec b)
+    {
+        const __m128i a_greater = _mm_cmpgt_epi32(a, b);
+        return _mm_or_si128(_mm_and_si128(a_greater, b), _mm_andnot_si128(a_greater, a));
+    }
+    static CHUNKED_VEC_INLINE vec vmax(vec a, vec b)
+    {
+        const __m128i a_greater = _mm_cmpgt_epi32(a, b);
+        return _mm_or_si128(_mm_and_si128(a_greater, a), _mm_andnot_si128(a_greater, b));
+    }
+    static CHUNKED_VEC_INLINE acc acc_zero() { return _mm_setzero_si128(); }
+    static CHUNKED_VEC_INLINE acc acc_add(acc sum, vec v)
+    {
+        // Sign-extend to 64 bits by interleaving with the sign mask
+        const __m128i sign = _mm_srai_epi32(v, 31);
+        sum = _mm_add_epi64(sum, _mm_unpacklo_epi32(v, sign));
+        return _mm_add_epi64(sum, _mm_unpackhi_epi32(v, sign));
+    }
+    static CHUNKED_VEC_INLINE void acc_store(int64_t* p, acc sum) { _mm_storeu_si128(reinterpret_cast<__m128i*>(p), sum); }
+};
+
+template <> struct sse2_ops<int64_t>
+{
+    static constexpr bool supported = true;
+    static constexpr bool has_minmax = false; // 64-bit compares need SSE4.2
+    static constexpr bool has_dot = false;
+    using vec = __m128i;
+    using acc = __m128i;
+    static constexpr size_t lanes = 2;
+    static constexpr size_t acc_lanes = 2;
+
+    static CHUNKED_VEC_INLINE vec load(const int64_t* p) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p)); }
+    static CHUNKED_VEC_INLINE vec set1(int64_t value) { return _mm_set1_epi64x(value); }
+    static CHUNKED_VEC_INLINE uint64_t eq_mask(vec a, vec b)
+    {
+        // A 64-bit lane is equal when both of its 32-bit halves are
+        const __m128i halves = _mm_cmpeq_epi32(a, b);
+        const __m128i both = _mm_and_si128(halves, _mm_shuffle_epi32(halves, _MM_SHUFFLE(2, 3, 0, 1)));
+        return static_cast<uint64_t>(_mm_movemask_pd(_mm_castsi128_pd(both)));
+    }
+    static CHUNKED_VEC_INLINE acc acc_zero() { return _mm_setzero_si128(); }
+    static CHUNKED_VEC_INLINE acc acc_add(acc sum, vec v) { return _mm_add_epi64(sum, v); }
+    static CHUNKED_VEC_INLINE void acc_store(int64_t* p, acc sum) { _mm_storeu_si128(reinterpret_cast<__m128i*>(p), sum); }
+};
+
+template <> struct sse2_ops<uint8_t>
+{
+    static constexpr bool supported = true;
+    static constexpr bool has_minmax = true;
+    static constexpr bool has_dot = true;
+    using vec = __m128i;
+    using acc = __m128i;
+    static constexpr size_t lanes = 16;
+    static constexpr size_t acc_lanes = 2;
+
+    static CHUNKED_VEC_INLINE vec load(const uint8_t* p) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p)); }
+    static CHUNKED_VEC_INLINE void store(uint8_t* p, vec v) { _mm_storeu_si128(reinterpret_cast<__m128i*>(p), v); }
+    static CHUNKED_VEC_INLINE vec set1(uint8_t value) { return _mm_set1_epi8(static_cast<char>(value)); }
+    static CHUNKED_VEC_INLINE uint64_t eq_mask(vec a, vec b) { return static_cast<uint64_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(a, b))); }
+    static CHUNKED_VEC_INLINE vec vmin(vec a, vec b) { return _mm_min_epu8(a, b); }
+    static CHUNKED_VEC_INLINE vec vmax(vec a, vec b) { return _mm_max_epu8(a, b); }
+    static CHUNKED_VEC_INLINE acc acc_zero() { return _mm_setzero_si128(); }
+    static CHUNKED_VEC_INLINE acc acc_add(acc sum, vec v) { return _mm_add_epi64(sum, _mm_sad_epu8(v, _mm_setzero_si128())); }
+    static CHUNKED_VEC_INLINE acc acc_dot(acc sum, vec a, vec b)
+    {
+        // Widen to 16 bits, multiply-add pairs into 32-bit lanes, then widen to 64 bits
+        const __m128i zero = _mm_setzero_si128();
+        const __m128i lo = _mm_madd_epi16(_mm_unpacklo_epi8(a, zero), _mm_unpacklo_epi8(b, zero));
+        const __m128i hi = _mm_madd_epi16(_mm_unpackhi_epi8(a, zero), _mm_unpackhi_epi8(b, zero));
+        const __m128i pairs = _mm_add_epi32(lo, hi);
+        sum = _mm_add_epi64(sum, _mm_unpacklo_epi32(pairs, zero));
+        return _mm_add_epi64(sum, _mm_unpackhi_epi32(pairs, zero));
+    }
+    static CHUNKED_VEC_INLINE void acc_store(uint64_t* p, acc sum) { _mm_storeu_si128(reinterpret_cast<__m128i*>(p), sum); }
+};
+
+template <typename T> struct avx2_ops
+{
+    static constexpr bool supported = false;
+};
+
+template <> struct avx2_ops<float>
+{
+    static constexpr bool supported = true;
+    static constexpr bool has_minmax = true;
+    static constexpr bool has_dot = true;
+    using vec = __m256;
+    using acc = __m256;
+    static constexpr size_t lanes = 8;
+    static constexpr size_t acc_lanes = 8;
+
+    static CHUNKED_VEC_INLINE CHUNKED_VEC_TARGET_AVX2 vec load(const float* p) { return _mm256_loadu_ps(p); }
+    static CHUNKED_VEC_INLINE CHUNKED_VEC_TARGET_AVX2 void store(float* p, vec v) { _mm256_storeu_ps(p, v); }
+    static CHUNKED_VEC_INLINE CHUNKED_VEC_TARGET_AVX2 vec set1(float value) { return _mm256_set1_ps(value); }
+    static CHUNKED_VEC_INLINE CHUNKED_VEC_TARGET_AVX2 uint64_t eq_mask(vec a, vec b)
+    {
+        return static_cast<uint64_t>(_mm256_movemask_ps(_mm256_cmp_ps(a, b, _CMP_EQ_OQ)));
+    }
+    static CHUNKED_VEC_INLINE CHUNKED_VEC_TARGET_AVX2 vec vmin(vec a, vec b) { return _mm256_min_ps(a, b); }
+    static CHUNKED_VEC_INLINE CHUNKED_VEC_TARGET_AVX2 vec vmax(vec a, vec b) { return _mm256_max_ps(a, b); }
+    static CHUNKED_VEC_INLINE CHUNKED_VEC_TARGET_AVX2 acc acc_zero() { return _mm256_setzero_ps(); }
+    static CHUNKED_VEC_INLINE CHUNKED_VEC_TARGET_AVX2 acc acc_add(acc sum, vec v) { return _mm256_add_ps(sum, v); }
+    static CHUNKED_VEC_INLINE CHUNKED_VEC_TARGET_AVX2 acc acc_dot(acc sum, vec a, vec b) { return _mm256_add_ps(sum, _mm256_mul_ps(a, b)); }
+    static CHUNKED_VEC_INLINE CHUNKED_VEC_TARGET_AVX2 void acc_store(float* p, acc sum) { _mm256_storeu_ps(p, sum); }
+};
+
+template <> struct avx2_ops<int32_t>
+{
+    static constexpr bool supported = true;
+    static constexpr bool has_minmax = true;
+    static constexpr bool has_dot = true;
+    using vec = __m256i;
+    using acc = __m256i;
+    static constexpr size_t lanes = 8;
+    static constexpr size_t acc_lanes = 4;
+
+    static CHUNKED_VEC_INLINE CHUNKED_VEC_TARGET_AVX2 vec load(const int32_t* p) { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)); }
+    static CHUNKED_VEC_INLINE CHUNKED_VEC_TARGET_AVX2 void store(int32_t* p, vec v) { _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), v); }
+    static CHUNKED_VEC_INLINE CHUNKED_VEC_TARGET_AVX2 vec set1(int32_t value) { return _mm256_set1_epi32(value); }
+    static CHUNKED_VEC_INLINE CHUNKED_VEC_TARGET_AVX2 uint64_t eq_mask(vec a, vec b)
+    {
+        return static_cast<uint64_t>(_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(a, b))));
+    }
+    static CHUNKED_VEC_INLINE CHUNKED_VEC_TARGET_AVX2 vec vmin(vec a, vec b) { return _mm256_min_epi32(a, b); }
+    static CHUNKED_VEC_INLINE CHUNKED_VEC_TARGET_AVX2 vec vmax(vec a, vec b) { return _mm256_max_epi32(a, b); }
+    static CHUNKED_VEC_INLINE CHUNKED_VEC_TARGET_AVX2 acc acc_zero() { return _mm256_setzero_si256(); }
+    static CHUNKED_VEC_INLINE CHUNKED_VEC_TARGET_AVX2 acc acc_add(acc sum, vec v)
+    {
+        sum = _mm256_add_epi64(sum, _mm256_cvtepi32_epi64(_mm256_castsi256_si128(v)));
+        return _mm256_add_epi64(sum, _mm256_cvtepi32_epi64(_mm256_extracti128_si256(v, 1)));
+    }
+    static CHUNKED_VEC_INLINE CHUNKED_VEC_TARGET_AVX2 acc acc_dot(acc sum, vec a, vec b)
+    {
+        // mul_epi32 multiplies the even (low) 32-bit lanes of each 64-bit lane; shift to reach the odd ones
+        sum = _mm256_add_epi64(sum, _mm256_mul_epi32(a, b));
+        return _mm256_add_epi64(sum, _mm256_mul_epi32(_mm256_srli_epi64(a, 32), _mm256_srli_epi64(b, 32)));
+    }
+    static CHUNKED_VEC_INLINE CHUNKED_VEC_TARGET_AVX2 void acc_store(int64_t* p, acc sum) { _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), sum); }
+};
+
+template <> struct avx2_ops<int64_t>
+{
+    static constexpr bool supported = true;
+    static constexpr bool has_minmax = true;
+    static constexpr bool has_dot = false; // no 64-bit multiply before AVX-512DQ
+    using vec = __m256i;
+    using acc = __m256i;
+    static constexpr size_t lanes = 4;
+    static constexpr size_t acc_lanes = 4;
+
+    static CHUNKED_VEC_INLINE CHUNKED_VEC_TARGET_AVX2 vec load(const int64_t* p) { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)); }
+    static CHUNKED_VEC_INLINE CHUNKED_VEC_TARGET_AVX2 void store(int64_t* p, vec v) { _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), v); }
+    static CHUNKED_VEC_INLINE CHUNKED_VEC_TARGET_AVX2 vec set1(int64_t value) { return _mm256_set1_epi64x(value); }
+    static CHUNKED_VEC_INLINE CHUNKED_VEC_TARGET_AVX2 uint64_t eq_mask(vec a, vec b)
+    {
+        return static_cast<uint64_t>(_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(a, b))));
+    }
+    static CHUNKED_VEC_INLINE CHUNKED_VEC_TARGET_AVX2 vec vmin(vec a, vec b) { return _mm256_blendv_epi8(a, b, _mm256_cmpgt_epi64(a, b)); }
+    static CHUNKED_VEC_INLINE CHUNKED_VEC_TARGET_AVX2 vec vmax(vec a, vec b) { return _mm256_blendv_epi8(b, a, _mm256_cmpgt_epi64(a, b)); }
+    static CHUNKED_VEC_INLINE CHUNKED_VEC_TARGET_AVX2 acc acc_zero() { return _mm256_setzero_si256(); }
+    static CHUNKED_VEC_INLINE CHUNKED_VEC_TARGET_AVX2 acc acc_add(acc sum, vec v) { return _mm256_add_epi64(sum, v); }
+    static CHUNKED_VEC_INLINE CHUNKED_VEC_TARGET_AVX2 void acc_store(int64_t* p, acc sum) { _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), sum); }
+};
+
+template <> struct avx2_ops<uint8_t>
+{
+    static constexpr bool supported = true;
+    static constexpr bool has_minmax = true;
+    static constexpr bool has_dot = true;
+    using vec = __m256i;
+    using acc = __m256i;
+    static constexpr size_t lanes = 32;
+    static constexpr size_t acc_lanes = 4;
+
+    static CHUNKED_VEC_INLINE CHUNKED_VEC_TARGET_AVX2 vec load(const uint8_t* p) { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)); }
+    static CHUNKED_VEC_INLINE CHUNKED_VEC_TARGET_AVX2 void store(uint8_t* p, vec v) { _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), v); }
+    static CHUNKED_VEC_INLINE CHUNKED_VEC_TARGET_AVX2 vec set1(uint8_t value) { return _mm256_set1_epi8(static_cast<char>(value)); }
+    static CHUNKED_VEC_INLINE CHUNKED_VEC_TARGET_AVX2 uint64_t eq_mask(vec a, vec b)
+    {
+        return static_cast<uint64_t>(static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(a, b))));
+    }
+    static CHUNKED_VEC_INLINE CHUNKED_VEC_TARGET_AVX2 vec vmin(vec a, vec b) { return _mm256_min_epu8(a, b); }
+    static CHUNKED_VEC_INLINE CHUNKED_VEC_TARGET_AVX2 vec vmax(vec a, vec b) { return _mm256_max_epu8(a, b); }
+    static CHUNKED_VEC_INLINE CHUNKED_VEC_TARGET_AVX2 acc acc_zero() { return _mm256_setzero_si256(); }
+    static CHUNKED_VEC_INLINE CHUNKED_VEC_TARGET_AVX2 acc acc_add(acc sum, vec v) { return _mm256_add_epi64(sum, _mm256_sad_epu8(v, _mm256_setzero_si256())); }
+    static CHUNKED_VEC_INLINE CHUNKED_VEC_TARGET_AVX2 acc acc_dot(acc sum, vec a, vec b)
+    {
+        const __m256i zero = _mm256_setzero_si256();
+        const __m256i lo = _mm256_madd_epi16(_mm256_unpacklo_epi8(a, zero), _mm256_unpacklo_epi8(b, zero));
+        const __m256i hi = _mm256_madd_epi16(_mm256_unpackhi_epi8(a, zero), _mm256_unpackhi_epi8(b, zero));
+        const __m256i pairs = _mm256_add_epi32(lo, hi);
+        sum = _mm256_add_epi64(sum, _mm256_unpacklo_epi32(pairs, zero));
+        return _mm256_add_epi64(sum, _mm256_unpackhi_epi32(pairs, zero));
+    }
+    static CHUNKED_VEC_INLINE CHUNKED_VEC_TARGET_AVX2 void acc_store(uint64_t* p, acc sum) { _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), sum); }
+};
+
+template <typename T> struct avx512_ops
+{
+    static constexpr bool supported = false;
+};
+
+template <> struct avx512_ops<float>
+{
+    static constexpr bool supported = true;
+    static constexpr bool has_minmax = true;
+    static constexpr bool has_dot = true;
+    using vec = __m512;
+    using acc = __m512;
+    static constexpr size_t lanes = 16;
+    static constexpr size_t acc_lanes = 16;
+
+    static CHUNKED_VEC_INLINE CHUNKED_VEC_TARGET_AVX512 vec load(const float* p) { return _mm512_loadu_ps(p); }
+    static CHUNKED_VEC_INLINE CHUNKED_VEC_TARGET_AVX512 void store(float* p, vec v) { _mm512_storeu_ps(p, v); }
+    static CHUNKED_VEC_INLINE CHUNKED_VEC_TARGET_AVX512 vec set1(float value) { return _mm512_set1_ps(value); }
+    static CHUNKED_VEC_INLINE CHUNKED_VEC_TARGET_AVX512 uint64_t eq_mask(vec a, vec b) { return _mm512_cmp_ps_mask(a, b, _CMP_EQ_OQ); }
+    static CHUNKED_VEC_INLINE CHUNKED_VEC_TARGET_AVX512 vec vmin(vec a, vec b) { return _mm512_min_ps(a, b); }
+    static CHUNKED_VEC_INLINE CHUNKED_VEC_TARGET_AVX512 vec vmax(vec a, vec b) { return _mm512_max_ps(a, b); }
+    static CHUNKED_VEC_INLINE CHUNKED_VEC_TARGET_AVX512 acc acc_zero() { return _mm512_setzero_ps(); }
+    static CHUNKED_VEC_INLINE CHUNKED_VEC_TARGET_AVX512 acc acc_add(acc sum, vec v) { return _mm512_add_ps(sum, v); }
+    static CHUNKED_VEC_INLINE CHUNKED_VEC_TARGET_AVX512 acc acc_dot(acc sum, vec a, vec b) { return _mm512_add_ps(sum, _mm512_mul_ps(a, b)); }
+    static CHUNKED_VEC_INLINE CHUNKED_VEC_TARGET_AVX512 void acc_store(float* p, acc sum) { _mm512_storeu_ps(p, sum); }
+};
+
+template <> struct avx512_ops<int32_t>
+{
+    static constexpr bool supported = true;
+    static constexpr bool has_minmax = true;
+    static constexpr bool has_dot = true;
+    using vec = __m512i;
+    using acc = __m512i;
+    static constexpr size_t lanes = 16;
+    static constexpr size_t acc_lanes = 8;
+
+    static CHUNKED_VEC_INLINE CHUNKED_VEC_TARGET_AVX512 vec load(const int32_t* p) { return _mm512_loadu_si512(p); }
+    static CHUNKED_VEC_INLINE CHUNKED_VEC_TARGET_AVX512 void store(int32_t* p, vec v) { _mm512_storeu_si512(p, v); }
+    static CHUNKED_VEC_INLINE CHUNKED_VEC_TARGET_AVX512 vec set1(int32_t value) { return _mm512_set1_epi32(value); }
+    static CHUNKED_VEC_INLINE CHUNKED_VEC_TARGET_AVX512 uint64_t eq_mask(vec a, vec b) { return _mm512_cmpeq_epi32_mask(a, b); }
+    static CHUNKED_VEC_INLINE CHUNKED_VEC_TARGET_AVX512 vec vmin(vec a, vec b) { return _mm512_min_epi32(a, b); }
+    static CHUNKED_VEC_INLINE CHUNKED_VEC_TARGET_AVX512 vec vmax(vec a, vec b) { return _mm512_max_epi32(a, b); }
+    static CHUNKED_VEC_INLINE CHUNKED_VEC_TARGET_AVX512 acc acc_zero() { return _mm512_setzero_si512(); }
+    static CHUNKED_VEC_INLINE CHUNKED_VEC_TARGET_AVX512 acc acc_add(acc sum, vec v)
+    {
+        sum = _mm512_add_epi64(sum, _mm512_cvtepi32_epi64(_mm512_castsi512_si256(v)));
+        return _mm512_add_epi64(sum, _mm512_cvtepi32_epi64(_mm512_extracti64x4_epi64(v, 1)));
+    }
+    static CHUNKED_VEC_INLINE CHUNKED_VEC_TARGET_AVX512 acc acc_dot(acc sum, vec a, vec b)
+    {
+        sum = _mm512_add_epi64(sum, _mm512_mul_epi32(a, b));
+        return _mm512_add_epi64(sum, _mm512_mul_epi32(_mm512_srli_epi64(a, 32), _mm512_srli_epi64(b, 32)));
+    }
+    static CHUNKED_VEC_INLINE CHUNKED_VEC_TARGET_AVX512 void acc_store(int64_t* p, acc sum) { _mm512_storeu_si512(p, sum); }
+};
+
+template <> struct avx512_ops<int64_t>
+{
+    static constexpr bool supported = true;
+    static constexpr bool has_minmax = true;
+    static constexpr bool has_dot = false; // 64-bit multiply needs AVX-512DQ
+    using vec = __m512i;
+    using acc = __m512i;
+    static constexpr size_t lanes = 8;
+    static constexpr size_t acc_lanes = 8;
+
+    static CHUNKED_VEC_INLINE CHUNKED_VEC_TARGET_AVX512 vec load(const int64_t* p) { return _mm512_loadu_si512(p); }
+    static CHUNKED_VEC_INLINE CHUNKED_VEC_TARGET_AVX512 void store(int64_t* p, vec v) { _mm512_storeu_si512(p, v); }
+    static CHUNKED_VEC_INLINE CHUNKED_VEC_TARGET_AVX512 vec set1(int64_t value) { return _mm512_set1_epi64(value); }
+    static CHUNKED_VEC_INLINE CHUNKED_VEC_TARGET_AVX512 uint64_t eq_mask(vec a, vec b) { return _mm512_cmpeq_epi64_mask(a, b); }
+    static CHUNKED_VEC_INLINE CHUNKED_VEC_TARGET_AVX512 vec vmin(vec a, vec b) { return _mm512_min_epi64(a, b); }
+    static CHUNKED_VEC_INLINE CHUNKED_VEC_TARGET_AVX512 vec vmax(vec a, vec b) { return _mm512_max_epi64(a, b); }
+    static CHUNKED_VEC_INLINE CHUNKED_VEC_TARGET_AVX512 acc acc_zero() { return _mm512_setzero_si512(); }
+    static CHUNKED_VEC_INLINE CHUNKED_VEC_TARGET_AVX512 acc acc_add(acc sum, vec v) { return _mm512_add_epi64(sum, v); }
+    static CHUNKED_VEC_INLINE CHUNKED_VEC_TARGET_AVX512 void acc_store(int64_t* p, acc sum) { _mm512_storeu_si512(p, sum); }
+};
+
+template <> struct avx512_ops<uint8_t>
+{
+    static constexpr bool supported = true;
+    static constexpr bool has_minmax = true;
+    static constexpr bool has_dot = true;
+    using vec = __m512i;
+    using acc = __m512i;
+    static constexpr size_t lanes = 64;
+    static constexpr size_t acc_lanes = 8;
+
+    static CHUNKED_VEC_INLINE CHUNKED_VEC_TARGET_AVX512 vec load(const uint8_t* p) { return _mm512_loadu_si512(p); }
+    static CHUNKED_VEC_INLINE CHUNKED_VEC_TARGET_AVX512 void store(uint8_t* p, vec v) { _mm512_storeu_si512(p, v); }
+    static CHUNKED_VEC_INLINE CHUNKED_VEC_TARGET_AVX512 vec set1(uint8_t value) { return _mm512_set1_epi8(static_cast<char>(value)); }
+    static CHUNKED_VEC_INLINE CHUNKED_VEC_TARGET_AVX512 uint64_t eq_mask(vec a, vec b) { return _mm512_cmpeq_epi8_mask(a, b); }
+    static CHUNKED_VEC_INLINE CHUNKED_VEC_TARGET_AVX512 vec vmin(vec a, vec b) { return _mm512_min_epu8(a, b); }
+    static CHUNKED_VEC_INLINE CHUNKED_VEC_TARGET_AVX512 vec vmax(vec a, vec b) { return _mm512_max_epu8(a, b); }
+    static CHUNKED_VEC_INLINE CHUNKED_VEC_TARGET_AVX512 acc acc_zero() { return _mm512_setzero_si512(); }
+    static CHUNKED_VEC_INLINE CHUNKED_VEC_TARGET_AVX512 acc acc_add(acc sum, vec v) { return _mm512_add_epi64(sum, _mm512_sad_epu8(v, _mm512_setzero_si512())); }
+    static CHUNKED_VEC_INLINE CHUNKED_VEC_TARGET_AVX512 acc acc_dot(acc sum, vec a, vec b)
+    {
+        const __m512i zero = _mm512_setzero_si512();
+        const __m512i lo = _mm512_madd_epi16(_mm512_unpacklo_epi8(a, zero), _mm512_unpacklo_epi8(b, zero));
+        const __m512i hi = _mm512_madd_epi16(_mm512_unpackhi_epi8(a, zero), _mm512_unpackhi_epi8(b, zero));
+        const __m512i pairs = _mm512_add_epi32(lo, hi);
+        sum = _mm512_add_epi64(sum, _mm512_unpacklo_epi32(pairs, zero));
+        return _mm512_add_epi64(sum, _mm512_unpackhi_epi32(pairs, zero));
+    }
+    static CHUNKED_VEC_INLINE CHUNKED_VEC_TARGET_AVX512 void acc_store(uint64_t* p, acc sum) { _mm512_storeu_si512(p, sum); }
+};
+
+// Kernel bodies shared by every instruction set; OPS names the operations template and TARGET its target attribute.
+// Full vectors are processed first and the remaining (count % lanes) elements of a partial page run through the
+// scalar tail. min/max instead finish with one overlapping vector, which is harmless for idempotent reductions.
+#define CHUNKED_VEC_SIMD_KERNELS(OPS, TARGET)                                                                                              \
+    template <typename T> static TARGET size_t find(const T* data, size_t count, T value)                                                  \
+    {                                                                                                                                      \
+        using O = OPS<T>;                                                                                                                  \
+        const typename O::vec needle = O::set1(value);                                                                                     \
+        size_t i = 0;                                                                                                                      \
+        for (; i + O::lanes <= count; i += O::lanes)                                                                                       \
+        {                                                                                                                                  \
+            const uint64_t mask = O::eq_mask(O::load(data + i), needle);                                                                   \
+            if (mask != 0)                                                                                                                 \
+            {                                                                                                                              \
+                return i + dod::detail::lowest_set_bit(mask);                                                                              \
+            }                                                                                                                              \
+        }                                                                                                                                  \
+        return i + scalar_kernels::find(data + i, count - i, value);                                                                       \
+    }                                                                                                                                      \
+                                                                                                                                           \
+    template <typename T> static TARGET size_t count(const T* data, size_t count, T value)                                                 \
+    {                                                                                                                                      \
+        using O = OPS<T>;                                                                                                                  \
+        const typename O::vec needle = O::set1(value);                                                                                     \
+        size_t matches = 0;                                                                                                                \
+        size_t i = 0;                                                                                                                      \
+        for (; i + O::lanes <= count; i += O::lanes)                                                                                       \
+        {                                                                                                                                  \
+            matches += popcount(O::eq_mask(O::load(data + i), needle));                                                                    \
+        }                                                                                                                                  \
+        return matches + scalar_kernels::count(data + i, count - i, value);                                                                \
+    }                                                                                                                                      \
+                                                                                                                                           \
+    template <typename T> static TARGET T min_value(const T* data, size_t count)                                                           \
+    {                                                                                                                                      \
+        using O = OPS<T>;                                                                                                                  \
+        if constexpr (O::has_minmax)                                                                                                       \
+        {                                                                                                                                  \
+            if (count >= O::lanes)                                                                                                         \
+            {                                                                                                                              \
+                typename O::vec best = O::load(data + count - O::lanes);                                                                   \
+                for (size_t i = 0; i + O::lanes <= count; i += O::lanes)                                                                   \
+                {                                                                                                                          \
+                    best = O::vmin(best, O::load(data + i));                                                                               \
+                }                                                                                                                          \
+                alignas(64) T lanes[O::lanes];                                                                                             \
+                O::store(lanes, best);                                                                                                     \
+                return scalar_kernels::min_value(lanes, O::lanes);                                                                         \
+            }                                                                                                                              \
+        }                                                                                                                                  \
+        return scalar_kernels::min_value(data, count);                                                                                     \
+    }                                                                                                                                      \
+                                                                                                                                           \
+    template <typename T> static TARGET T max_value(const T* data, size_t count)                                                           \
+    {                                                                                                                                      \
+        using O = OPS<T>;                                                                                                                  \
+        if constexpr (O::has_minmax)                                                                                                       \
+        {                                                                                                                                  \
+            if (count >= O::lanes)                                                                                                         \
+            {                                                                                                                              \
+                typename O::vec best = O::load(data + count - O::lanes);                                                                   \
+                for (size_t i = 0; i + O::lanes <= count; i += O::lanes)                                                                   \
+                {                                                                                                                          \
+                    best = O::vmax(best, O::load(data + i));                                                                               \
+                }                                                                                                                          \
+                alignas(64) T lanes[O::lanes];                                                                                             \
+                O::store(lanes, best);                                                                                                     \
+                return scalar_kernels::max_value(lanes, O::lanes);                                                                         \
+            }                                                                                                                              \
+        }                                                                                                                                  \
+        return scalar_kernels::max_value(data, count);                                                                                     \
+    }                                                                                                                                      \
+                                                                                                                                           \
+    template <typename T> static TARGET sum_result_t<T> sum(const T* data, size_t count)                                                   \
+    {                                                                                                                                      \
+        using O = OPS<T>;                                                                                                                  \
+        typename O::acc total = O::acc_zero();                                                                                             \
+        size_t i = 0;                                                                                                                      \
+        for (; i + O::lanes <= count; i += O::lanes)                                                                                       \
+        {                                                                                                                                  \
+            total = O::acc_add(total, O::load(data + i));                                                                                  \
+        }                                                                                                                                  \
+        alignas(64) sum_result_t<T> parts[O::acc_lanes];                                                                                   \
+        O::acc_store(parts, total);                                                                                                        \
+        return scalar_kernels::sum(parts, O::acc_lanes) + scalar_kernels::sum(data + i, count - i);                                        \
+    }                                                                                                                                      \
+                                                                                                                                           \
+    template <typename T> static TARGET sum_result_t<T> dot(const T* a, const T* b, size_t count)                                          \
+    {                                                                                                                                      \
+        using O = OPS<T>;                                                                                                                  \
+        if constexpr (O::has_dot)                                                                                                          \
+        {                                                                                                                                  \
+            typename O::acc total = O::acc_zero();                                                                                         \
+            size_t i = 0;                                                                                                                  \
+            for (; i + O::lanes <= count; i += O::lanes)                                                                                   \
+            {                                                                                                                              \
+                total = O::acc_dot(total, O::load(a + i), O::load(b + i));                                                                 \
+            }                                                                                                                              \
+            alignas(64) sum_result_t<T> parts[O::acc_lanes];                                                                               \
+            O::acc_store(parts, total);                                                                                                    \
+            return scalar_kernels::sum(parts, O::acc_lanes) + scalar_kernels::dot(a + i, b + i, count - i);                                \
+        }                                                                                                                                  \
+        else                                                                                                                               \
+        {                                                                                                                                  \
+            return scalar_kernels::dot(a, b, count);                                                                                       \
+        }                                                                                                                                  \
+    }
+
+struct sse2_kernels
+{
+    CHUNKED_VEC_SIMD_KERNELS(sse2_ops, )
+};
+
+struct avx2_kernels
+{
+    CHUNKED_VEC_SIMD_KERNELS(avx2_ops, CHUNKED_VEC_TARGET_AVX2)
+};
+
+struct avx512_kernels
+{
+    CHUNKED_VEC_SIMD_KERNELS(avx512_ops, CHUNKED_VEC_TARGET_AVX512)
+};
+
+#undef CHUNKED_VEC_SIMD_KERNELS
+
+#endif // CHUNKED_VEC_SIMD_X86
+
+/// @brief Call fn with the kernel set for lvl, or the scalar kernels when T has no vector implementation
+template <typename T, typename Fn> CHUNKED_VEC_INLINE auto dispatch(level lvl, Fn&& fn)
+{
+#if CHUNKED_VEC_SIMD_X86
+    if constexpr (sse2_ops<T>::supported)
+    {
+        switch (lvl)
+        {
+        case level::avx512:
+            return fn(avx512_kernels{});
+        case level::avx2:
+            return fn(avx2_kernels{});
+        case level::sse2:
+            return fn(sse2_kernels{});
+        default:
+            break;
+        }
+    }
+#else
+    CHUNKED_VEC_MAYBE_UNUSED(lvl);
+#endif
+    return fn(scalar_kernels{});
+}
+
+} // namespace detail
+
+/// @brief Widest instruction set supported by the CPU (and the OS)
+[[nodiscard]] inline level detected_level() noexcept
+{
+    static const level detected = detail::detect_level();
+    return detected;
+}
+
+/// @brief Instruction set the kernels currently use: the detected level, capped by set_level_limit()
+[[nodiscard]] inline level active_level() noexcept
+{
+    const level limit = detail::level_limit().load(std::memory_order_relaxed);
+    return limit < detected_level() ? limit : detected_level();
+}
+
+/// @brief Cap the instruction set used by the kernels (for testing and benchmarking)
+/// @return The previous limit
+inline level set_level_limit(level limit) noexcept { return detail::level_limit().exchange(limit); }
+
+/// @brief Index of the first element equal to value, or vec.size()
+template <typename T, size_t PAGE_SIZE, size_t MIN_FIRST_PAGE_SIZE, size_t INLINE_CAPACITY, typename SizeType>
+[[nodiscard]] size_t find(const chunked_vector<T, PAGE_SIZE, MIN_FIRST_PAGE_SIZE, INLINE_CAPACITY, SizeType>& vec,
+                          const dod::detail::type_identity_t<T>& value)
+{
+    const level lvl = active_level();
+    const size_t segments = vec.segment_count();
+    for (size_t segment_idx = 0; segment_idx < segments; ++segment_idx)
+    {
+        const page_segment<const T> page = vec.segment(segment_idx);
+        const size_t offset = detail::dispatch<T>(lvl, [&](auto kernels) { return decltype(kernels)::find(page.data, page.size, value); });
+        if (offset != page.size)
+        {
+            return segment_idx * PAGE_SIZE + offset;
+        }
+    }
+    return vec.size();
+}
+
+/// @brief Number of elements equal to value
+template <typename T, size_t PAGE_SIZE, size_t MIN_FIRST_PAGE_SIZE, size_t INLINE_CAPACITY, typename SizeType>
+[[nodiscard]] size_t count(const chunked_vector<T, PAGE_SIZE, MIN_FIRST_PAGE_SIZE, INLINE_CAPACITY, SizeType>& vec,
+                           const dod::detail::type_identity_t<T>& value)
+{
+    const level lvl = active_level();
+    size_t matches = 0;
+    const size_t segments = vec.segment_count();
+    for (size_t segment_idx = 0; segment_idx < segments; ++segment_idx)
+    {
+        const page_segment<const T> page = vec.segment(segment_idx);
+        matches += detail::dispatch<T>(lvl, [&](auto kernels) { return decltype(kernels)::count(page.data, page.size, value); });
+    }
+    return matches;
+}
+
+/// @brief Index of the first smallest element, or vec.size() when empty
+/// @note Floating-point inputs must not contain NaNs
+template <typename T, size_t PAGE_SIZE, size_t MIN_FIRST_PAGE_SIZE, size_t INLINE_CAPACITY, typename SizeType>
+[[nodiscard]] size_t min_element(const chunked_vector<T, PAGE_SIZE, MIN_FIRST_PAGE_SIZE, INLINE_CAPACITY, SizeType>& vec)
+{
+    const level lvl = active_level();
+    const size_t segments = vec.segment_count();
+    size_t best_segment = segments;
+    T best{};
+    for (size_t segment_idx = 0; segment_idx < segments; ++segment_idx)
+    {
+        const page_segment<const T> page = vec.segment(segment_idx);
+        const T page_min = detail::dispatch<T>(lvl, [&](auto kernels) { return decltype(kernels)::min_value(page.data, page.size); });
+        if (best_segment == segments || page_min < best)
+        {
+            best = page_min;
+            best_segment = segment_idx;
+        }
+    }
+    if (best_segment == segments)
+    {
+        return vec.size();
+    }
+    const page_segment<const T> page = vec.segment(best_segment);
+    return best_segment * PAGE_SIZE + detail::dispatch<T>(lvl, [&](auto kernels) { return decltype(kernels)::find(page.data, page.size, best); });
+}
+
+/// @brief Index of the first largest element, or vec.size() when empty
+/// @note Floating-point inputs must not contain NaNs
+template <typename T, size_t PAGE_SIZE, size_t MIN_FIRST_PAGE_SIZE, size_t INLINE_CAPACITY, typename SizeType>
+[[nodiscard]] size_t max_element(const chunked_vector<T, PAGE_SIZE, MIN_FIRST_PAGE_SIZE, INLINE_CAPACITY, SizeType>& vec)
+{
+    const level lvl = active_level();
+    const size_t segments = vec.segment_count();
+    size_t best_segment = segments;
+    T best{};
+    for (size_t segment_idx = 0; segment_idx < segments; ++segment_idx)
+    {
+        const page_segment<const T> page = vec.segment(segment_idx);
+        const T page_max = detail::dispatch<T>(lvl, [&](auto kernels) { return decltype(kernels)::max_value(page.data, page.size); });
+        if (best_segment == segments || best < page_max)
+        {
+            best = page_max;
+            best_segment = segment_idx;
+        }
+    }
+    if (best_segment == segments)
+    {
+        return vec.size();
+    }
+    const page_segment<const T> page = vec.segment(best_segment);
+    return best_segment * PAGE_SIZE + detail::dispatch<T>(lvl, [&](auto kernels) { return decltype(kernels)::find(page.data, page.size, best); });
+}
+
+/// @brief Sum of all elements (integers accumulate in 64 bits)
+/// @note Floating-point sums are accumulated lane-wise, so rounding differs from a sequential loop
+template <typename T, size_t PAGE_SIZE, size_t MIN_FIRST_PAGE_SIZE, size_t INLINE_CAPACITY, typename SizeType>
+[[nodiscard]] sum_result_t<T> sum(const chunked_vector<T, PAGE_SIZE, MIN_FIRST_PAGE_SIZE, INLINE_CAPACITY, SizeType>& vec)
+{
+    const level lvl = active_level();
+    sum_result_t<T> total = 0;
+    const size_t segments = vec.segment_count();
+    for (size_t segment_idx = 0; segment_idx < segments; ++segment_idx)
+    {
+        const page_segment<const T> page = vec.segment(segment_idx);
+        total += detail::dispatch<T>(lvl, [&](auto kernels) { return decltype(kernels)::sum(page.data, page.size); });
+    }
+    return total;
+}
+
+/// @brief Dot product of two vectors of the same size (pages line up because the page size is shared)
+template <typename T, size_t PAGE_SIZE, size_t MIN_FIRST_PAGE_SIZE, size_t INLINE_CAPACITY, typename SizeType>
+[[nodiscard]] sum_result_t<T> dot(const chunked_vector<T, PAGE_SIZE, MIN_FIRST_PAGE_SIZE, INLINE_CAPACITY, SizeType>& a,
+                                  const chunked_vector<T, PAGE_SIZE, MIN_FIRST_PAGE_SIZE, INLINE_CAPACITY, SizeType>& b)
+{
+    CHUNKED_VEC_ASSERT(a.size() == b.size() && "dot requires vectors of the same size");
+    const level lvl = active_level();
+    sum_result_t<T> total = 0;
+    const size_t segments = a.segment_count();
+    for (size_t segment_idx = 0; segment_idx < segments; ++segment_idx)
+    {
+        const page_segment<const T> page_a = a.segment(segment_idx);
+        const page_segment<const T> page_b = b.segment(segment_idx);
+        total += detail::dispatch<T>(lvl, [&](auto kernels) { return decltype(kernels)::dot(page_a.data, page_b.data, page_a.size); });
+    }
+    return total;
+}
+
+/// @brief Count of every byte value
+/// @details Byte histograms do not vectorize (scatter increments conflict), so this spreads consecutive
+/// elements over four sub-histograms to break the store-to-load dependency on repeated values.
+template <size_t PAGE_SIZE, size_t MIN_FIRST_PAGE_SIZE, size_t INLINE_CAPACITY, typename SizeType>
+[[nodiscard]] std::array<uint64_t, 256>
+histogram(const chunked_vector<uint8_t, PAGE_SIZE, MIN_FIRST_PAGE_SIZE, INLINE_CAPACITY, SizeType>& vec)
+{
+    // Flush the 32-bit sub-counters into the 64-bit bins before they can overflow
+    constexpr size_t flush_interval = PAGE_SIZE < std::numeric_limits<uint32_t>::max() ? std::numeric_limits<uint32_t>::max() / PAGE_SIZE : 1;
+    uint32_t partial[4][256] = {};
+    std::array<uint64_t, 256> bins{};
+    const size_t segments = vec.segment_count();
+    for (size_t segment_idx = 0; segment_idx < segments; ++segment_idx)
+    {
+        const page_segment<const uint8_t> page = vec.segment(segment_idx);
+        size_t i = 0;
+        for (; i + 4 <= page.size; i += 4)
+        {
+            ++partial[0][page.data[i]];
+            ++partial[1][page.data[i + 1]];
+            ++partial[2][page.data[i + 2]];
+            ++partial[3][page.data[i + 3]];
+        }
+        for (; i < page.size; ++i)
+        {
+            ++partial[0][page.data[i]];
+        }
+
+        if ((segment_idx + 1) % flush_interval == 0 || segment_idx + 1 == segments)
+        {
+            for (size_t value = 0; value < 256; ++value)
+            {
+                bins[value] += uint64_t(partial[0][value]) + partial[1][value] + partial[2][value] + partial[3][value];
+                partial[0][value] = partial[1][value] = partial[2][value] = partial[3][value] = 0;
+            }
+        }
+    }
+    return bins;
+}
+
+} // namespace simd
+} // namespace dod
@@ -0,0 +1,663 @@
+#pragma once
+
+#include "chunked_vector.h"
+
+#include <cstdint>
+
+namespace dod
+{
+
+/// @brief An unordered container with stable element addresses and generation-checked handles
+/// @details Elements live in fixed-size pages allocated the same way as chunked_vector pages, so
+/// they never move. insert() returns a 64-bit handle (32-bit slot index + 32-bit generation).
+/// erase() destroys the element in place, bumps the slot generation so outstanding handles become
+/// stale, and puts the slot on its page's free list for reuse. Pages that have free slots form an
+/// intrusive list, so insert and erase are O(1) without moving any live element.
+///
+/// Iteration visits live elements page by page and skips holes using per-page occupancy bitmasks.
+///
+/// @tparam T The type of elements stored in the map
+/// @tparam PAGE_SIZE The number of slots per page (default: 1024)
+template <typename T, size_t PAGE_SIZE = 1024> class chunked_slot_map
+{
+    static_assert(PAGE_SIZE > 0, "PAGE_SIZE must be greater than 0");
+    static_assert(PAGE_SIZE <= (size_t(1) << 31), "PAGE_SIZE must fit into a 32-bit slot index");
+
+  public:
+    using value_type = T;
+    using reference = T&;
+    using const_reference = const T&;
+    using pointer = T*;
+    using const_pointer = const T*;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+
+    template <typename ValueType> class basic_iterator;
+    using iterator = basic_iterator<T>;
+    using const_iterator = basic_iterator<const T>;
+
+    /// @brief Generation-checked reference to an element. A default-constructed handle is null.
+    class handle
+    {
+      public:
+        constexpr handle() noexcept
+            : m_value(0)
+        {
+        }
+
+        constexpr explicit handle(uint64_t value) noexcept
+            : m_value(value)
+        {
+        }
+
+        constexpr handle(uint32_t index, uint32_t generation) noexcept
+            : m_value((uint64_t(generation) << 32) | index)
+        {
+        }
+
+        /// @brief Packed 64-bit representation (generation in the high half, slot index in the low half)
+        [[nodiscard]] constexpr uint64_t value() const noexcept { return m_value; }
+        [[nodiscard]] constexpr uint32_t index() const noexcept { return static_cast<uint32_t>(m_value); }
+        [[nodiscard]] constexpr uint32_t generation() const noexcept { return static_cast<uint32_t>(m_value >> 32); }
+
+        // Live slots never have generation 0
+        [[nodiscard]] constexpr bool is_null() const noexcept { return generation() == 0; }
+
+        constexpr bool operator==(const handle& other) const noexcept { return m_value == other.m_value; }
+        constexpr bool operator!=(const handle& other) const noexcept { return m_value != other.m_value; }
+
+      private:
+        uint64_t m_value;
+    };
+
+    /// @brief Returns the page size used by this container
+    [[nodiscard]] static constexpr size_t page_size() { return PAGE_SIZE; }
+
+    chunked_slot_map() noexcept
+        : m_pages(nullptr)
+        , m_page_count(0)
+        , m_page_capacity(0)
+        , m_size(0)
+        , m_free_page_head(NO_PAGE)
+    {
+    }
+
+    /// @brief Copy constructor - the copy keeps the slot layout, so handles are valid in both maps
+    chunked_slot_map(const chunked_slot_map& other)
+        : chunked_slot_map()
+    {
+        copy_from(other);
+    }
+
+    chunked_slot_map(chunked_slot_map&& other) noexcept
+        : m_pages(other.m_pages)
+        , m_page_count(other.m_page_count)
+        , m_page_capacity(other.m_page_capacity)
+        , m_size(other.m_size)
+        , m_free_page_head(other.m_free_page_head)
+    {
+        other.m_pages = nullptr;
+        other.m_page_count = 0;
+        other.m_page_capacity = 0;
+        other.m_size = 0;
+        other.m_free_page_head = NO_PAGE;
+    }
+
+    ~chunked_slot_map() { free_pages(); }
+
+    chunked_slot_map& operator=(const chunked_slot_map& other)
+    {
+        if (this != &other)
+        {
+            free_pages();
+            copy_from(other);
+        }
+        return *this;
+    }
+
+    chunked_slot_map& operator=(chunked_slot_map&& other) noexcept
+    {
+        if (this != &other)
+        {
+            free_pages();
+
+            m_pages = other.m_pages;
+            m_page_count = other.m_page_count;
+            m_page_capacity = other.m_page_capacity;
+            m_size = other.m_size;
+            m_free_page_head = other.m_free_page_head;
+
+            other.m_pages = nullptr;
+            other.m_page_count = 0;
+            other.m_page_capacity = 0;
+            other.m_size = 0;
+            other.m_free_page_head = NO_PAGE;
+        }
+        return *this;
+    }
+
+    /// @brief Insert a copy of value
+    /// @return Handle to the new element
+    /// @note Time complexity: O(1). Never moves existing elements.
+    handle insert(const T& value) { return emplace(value); }
+    handle insert(T&& value) { return emplace(std::move(value)); }
+
+    /// @brief Construct an element in a free slot (reusing erased slots first)
+    /// @return Handle to the new element
+    template <typename... Args> handle emplace(Args&&... args)
+    {
+        if (m_free_page_head == NO_PAGE)
+        {
+            reserve(m_page_count * PAGE_SIZE + 1);
+        }
+
+        const size_type page_idx = m_free_page_head;
+        page* p = m_pages[page_idx];
+
+        uint32_t slot;
+        if (p->free_head != NO_SLOT)
+        {
+            slot = p->free_head;
+            p->free_head = p->next_free[slot];
+        }
+        else
+        {
+            // Never used slot: its generation starts at 1
+            CHUNKED_VEC_ASSERT(p->high_water < PAGE_SIZE && "Page on the free list has no free slot");
+            slot = p->high_water++;
+            p->generations[slot] = 1;
+        }
+
+        dod::construct<T>(&p->elements()[slot], std::forward<Args>(args)...);
+        p->occupancy[slot / 64] |= uint64_t(1) << (slot % 64);
+        ++m_size;
+
+        if (!page_has_free_slot(p))
+        {
+            // The head of the free page list just became full
+            m_free_page_head = p->next_free_page;
+            p->next_free_page = NO_PAGE;
+            p->in_free_list = false;
+        }
+
+        return handle(static_cast<uint32_t>(page_idx * PAGE_SIZE + slot), p->generations[slot]);
+    }
+
+    /// @brief Erase the element referred to by h
+    /// @return false if h is null or stale
+    /// @note Time complexity: O(1). Never moves other elements.
+    bool erase(handle h) noexcept
+    {
+        if (!contains(h))
+        {
+            return false;
+        }
+
+        auto [page_idx, slot] = split_index(h.index());
+        page* p = m_pages[page_idx];
+
+        dod::destruct(&p->elements()[slot]);
+        p->occupancy[slot / 64] &= ~(uint64_t(1) << (slot % 64));
+        bump_generation(p, slot);
+        p->next_free[slot] = p->free_head;
+        p->free_head = slot;
+        --m_size;
+
+        push_free_page(page_idx);
+        return true;
+    }
+
+    /// @brief Erase the element at it
+    /// @return Iterator to the next live element
+    iterator erase(const_iterator it)
+    {
+        CHUNKED_VEC_ASSERT(it.m_container == this && "Iterator does not belong to this container");
+        iterator next(this, it.m_page_idx, it.m_word_idx, it.m_bits);
+        ++next;
+        erase(it.get_handle());
+        return next;
+    }
+
+    /// @brief Returns true if h refers to a live element
+    [[nodiscard]] CHUNKED_VEC_INLINE bool contains(handle h) const noexcept
+    {
+        auto [page_idx, slot] = split_index(h.index());
+        if (h.is_null() || page_idx >= m_page_count)
+        {
+            return false;
+        }
+        const page* p = m_pages[page_idx];
+        return is_occupied(p, slot) && p->generations[slot] == h.generation();
+    }
+
+    /// @brief Returns a pointer to the element or nullptr if h is null or stale
+    [[nodiscard]] CHUNKED_VEC_INLINE T* get(handle h) noexcept
+    {
+        if (!contains(h))
+        {
+            return nullptr;
+        }
+        auto [page_idx, slot] = split_index(h.index());
+        return &m_pages[page_idx]->elements()[slot];
+    }
+
+    [[nodiscard]] CHUNKED_VEC_INLINE const T* get(handle h) const noexcept
+    {
+        if (!contains(h))
+        {
+            return nullptr;
+        }
+        auto [page_idx, slot] = split_index(h.index());
+        return &m_pages[page_idx]->elements()[slot];
+    }
+
+    [[nodiscard]] CHUNKED_VEC_INLINE reference operator[](handle h)
+    {
+        CHUNKED_VEC_ASSERT(contains(h) && "Stale or null handle");
+        auto [page_idx, slot] = split_index(h.index());
+        return m_pages[page_idx]->elements()[slot];
+    }
+
+    [[nodiscard]] CHUNKED_VEC_INLINE const_reference operator[](handle h) const
+    {
+        CHUNKED_VEC_ASSERT(contains(h) && "Stale or null handle");
+        auto [page_idx, slot] = split_index(h.index());
+        return m_pages[page_idx]->elements()[slot];
+    }
+
+    [[nodiscard]] reference at(handle h)
+    {
+        if (!contains(h))
+        {
+            throw std::out_of_range("chunked_slot_map::at: stale or null handle");
+        }
+        return (*this)[h];
+    }
+
+    [[nodiscard]] const_reference at(handle h) const
+    {
+        if (!contains(h))
+        {
+            throw std::out_of_range("chunked_slot_map::at: stale or null handle");
+        }
+        return (*this)[h];
+    }
+
+    [[nodiscard]] CHUNKED_VEC_INLINE iterator begin() noexcept { return iterator(this); }
+    [[nodiscard]] CHUNKED_VEC_INLINE const_iterator begin() const noexcept { return const_iterator(this); }
+    [[nodiscard]] CHUNKED_VEC_INLINE const_iterator cbegin() const noexcept { return const_iterator(this); }
+
+    [[nodiscard]] CHUNKED_VEC_INLINE iterator end() noexcept { return iterator(this, m_page_count, 0, 0); }
+    [[nodiscard]] CHUNKED_VEC_INLINE const_iterator end() const noexcept { return const_iterator(this, m_page_count, 0, 0); }
+    [[nodiscard]] CHUNKED_VEC_INLINE const_iterator cend() const noexcept { return const_iterator(this, m_page_count, 0, 0); }
+
+    [[nodiscard]] CHUNKED_VEC_INLINE bool empty() const noexcept { return m_size == 0; }
+    [[nodiscard]] CHUNKED_VEC_INLINE size_type size() const noexcept { return m_size; }
+    [[nodiscard]] CHUNKED_VEC_INLINE size_type capacity() const noexcept { return m_page_count * PAGE_SIZE; }
+
+    /// @brief Make sure at least new_capacity slots exist
+    void reserve(size_type new_capacity)
+    {
+        if (new_capacity <= capacity())
+        {
+            return;
+        }
+
+        const size_type pages_needed = layout::pages_needed(new_capacity);
+        CHUNKED_VEC_ASSERT(pages_needed * PAGE_SIZE <= (size_type(1) << 32) && "Slot indices must fit into 32 bits");
+        ensure_page_capacity(pages_needed);
+
+        const size_type first_new_page = m_page_count;
+        while (m_page_count < pages_needed)
+        {
+            m_pages[m_page_count++] = allocate_page();
+        }
+        // Link new pages so that the lowest page index is filled first
+        for (size_type page_idx = m_page_count; page_idx-- > first_new_page;)
+        {
+            push_free_page(page_idx);
+        }
+    }
+
+    /// @brief Destroy all elements; every outstanding handle becomes stale
+    /// @note Pages are kept and their slots reused
+    void clear() noexcept
+    {
+        for (size_type page_idx = 0; page_idx < m_page_count; ++page_idx)
+        {
+            page* p = m_pages[page_idx];
+            for (size_type word_idx = 0; word_idx < OCCUPANCY_WORDS; ++word_idx)
+            {
+                uint64_t bits = p->occupancy[word_idx];
+                while (bits != 0)
+                {
+                    const uint32_t slot = static_cast<uint32_t>(word_idx * 64) + detail::lowest_set_bit_unchecked(bits);
+                    bits &= bits - 1;
+
+                    dod::destruct(&p->elements()[slot]);
+                    bump_generation(p, slot);
+                    p->next_free[slot] = p->free_head;
+                    p->free_head = slot;
+                }
+                p->occupancy[word_idx] = 0;
+            }
+        }
+
+        // Every page that has ever been touched now has free slots
+        for (size_type page_idx = m_page_count; page_idx-- > 0;)
+        {
+            push_free_page(page_idx);
+        }
+        m_size = 0;
+    }
+
+    /// @brief Handle of the element an iterator points to
+    [[nodiscard]] handle handle_of(const_iterator it) const
+    {
+        CHUNKED_VEC_ASSERT(it.m_container == this && "Iterator does not belong to this container");
+        return it.get_handle();
+    }
+
+  private:
+    using layout = detail::page_layout<PAGE_SIZE>;
+
+    static constexpr size_type OCCUPANCY_WORDS = (PAGE_SIZE + 63) / 64;
+    static constexpr uint32_t NO_SLOT = ~uint32_t(0);
+    static constexpr size_type NO_PAGE = ~size_type(0);
+
+    /// @brief Slot metadata and element storage of one page, allocated as a single block
+    struct page
+    {
+        uint64_t occupancy[OCCUPANCY_WORDS];
+        uint32_t generations[PAGE_SIZE];
+        // Per-page free list of erased slots, linked through next_free
+        uint32_t next_free[PAGE_SIZE];
+        uint32_t free_head;
+        // Slots [high_water, PAGE_SIZE) have never been used
+        uint32_t high_water;
+        // Intrusive list of pages that have at least one free slot
+        size_type next_free_page;
+        bool in_free_list;
+        alignas(T) unsigned char storage[PAGE_SIZE * sizeof(T)];
+
+        CHUNKED_VEC_INLINE T* elements() noexcept { return reinterpret_cast<T*>(storage); }
+        CHUNKED_VEC_INLINE const T* elements() const noexcept { return reinterpret_cast<const T*>(storage); }
+    };
+
+    static constexpr size_type PAGE_ALIGNMENT = alignof(page) < safe_alignment_of<T> ? safe_alignment_of<T> : alignof(page);
+
+    page** m_pages;
+    size_type m_page_count;
+    size_type m_page_capacity;
+    size_type m_size;
+    size_type m_free_page_head;
+
+    [[nodiscard]] static CHUNKED_VEC_INLINE std::pair<size_type, uint32_t> split_index(uint32_t index) noexcept
+    {
+        auto [page_idx, slot] = layout::split(static_cast<size_type>(index));
+        return {page_idx, static_cast<uint32_t>(slot)};
+    }
+
+    [[nodiscard]] static CHUNKED_VEC_INLINE bool is_occupied(const page* p, uint32_t slot) noexcept
+    {
+        return (p->occupancy[slot / 64] >> (slot % 64)) & 1;
+    }
+
+    [[nodiscard]] static CHUNKED_VEC_INLINE bool page_has_free_slot(const page* p) noexcept
+    {
+        return p->free_head != NO_SLOT || p->high_water < PAGE_SIZE;
+    }
+
+    static CHUNKED_VEC_INLINE void bump_generation(page* p, uint32_t slot) noexcept
+    {
+        // Skip 0 on wrap-around so that no live element ever matches a null handle
+        if (++p->generations[slot] == 0)
+        {
+            p->generations[slot] = 1;
+        }
+    }
+
+    void push_free_page(size_type page_idx) noexcept
+    {
+        page* p = m_pages[page_idx];
+        if (!p->in_free_list)
+        {
+            p->next_free_page = m_free_page_head;
+            p->in_free_list = true;
+            m_free_page_head = page_idx;
+        }
+    }
+
+    [[nodiscard]] static page* allocate_page()
+    {
+        // Default-initialize: only the bookkeeping below is set up, element storage stays untouched
+        page* p = new (CHUNKED_VEC_ALLOC(sizeof(page), PAGE_ALIGNMENT)) page;
+        std::fill(p->occupancy, p->occupancy + OCCUPANCY_WORDS, uint64_t(0));
+        p->free_head = NO_SLOT;
+        p->high_water = 0;
+        p->next_free_page = NO_PAGE;
+        p->in_free_list = false;
+        return p;
+    }
+
+    void copy_from(const chunked_slot_map& other)
+    {
+        CHUNKED_VEC_ASSERT(m_page_count == 0 && "copy_from expects a map without pages");
+        ensure_page_capacity(other.m_page_count);
+        for (size_type page_idx = 0; page_idx < other.m_page_count; ++page_idx)
+        {
+            const page* src = other.m_pages[page_idx];
+            page* dst = allocate_page();
+            m_pages[m_page_count++] = dst;
+
+            // Metadata is copied verbatim so that every handle stays valid in the copy
+            std::memcpy(dst->generations, src->generations, sizeof(src->generations));
+            std::memcpy(dst->next_free, src->next_free, sizeof(src->next_free));
+            dst->free_head = src->free_head;
+            dst->high_water = src->high_water;
+            dst->next_free_page = src->next_free_page;
+            dst->in_free_list = src->in_free_list;
+
+            if constexpr (std::is_trivially_copyable_v<T>)
+            {
+                std::memcpy(dst->occupancy, src->occupancy, sizeof(src->occupancy));
+                std::memcpy(dst->storage, src->storage, src->high_water * sizeof(T));
+            }
+            else
+            {
+                for (size_type word_idx = 0; word_idx < OCCUPANCY_WORDS; ++word_idx)
+                {
+                    uint64_t bits = src->occupancy[word_idx];
+                    while (bits != 0)
+                    {
+                        const uint32_t slot = static_cast<uint32_t>(word_idx * 64) + detail::lowest_set_bit(bits);
+                        bits &= bits - 1;
+                        dod::construct<T>(&dst->elements()[slot], src->elements()[slot]);
+                        // Publish the bit only once the element exists so a throwing copy leaves a consistent page
+                        dst->occupancy[word_idx] |= uint64_t(1) << (slot % 64);
+                    }
+                }
+            }
+        }
+        m_size = other.m_size;
+        m_free_page_head = other.m_free_page_head;
+    }
+
+    void free_pages() noexcept
+    {
+        for (size_type page_idx = 0; page_idx < m_page_count; ++page_idx)
+        {
+            page* p = m_pages[page_idx];
+            if constexpr (!std::is_trivially_destructible_v<T>)
+            {
+                for (size_type word_idx = 0; word_idx < OCCUPANCY_WORDS; ++word_idx)
+                {
+                    uint64_t bits = p->occupancy[word_idx];
+                    while (bits != 0)
+                    {
+                        const uint32_t slot = static_cast<uint32_t>(word_idx * 64) + detail::lowest_set_bit_unchecked(bits);
+                        bits &= bits - 1;
+                        dod::destruct(&p->elements()[slot]);
+                    }
+                }
+            }
+            dod::destruct(p);
+            CHUNKED_VEC_FREE(p);
+        }
+        if (m_pages)
+        {
+            CHUNKED_VEC_FREE(m_pages);
+        }
+        m_pages = nullptr;
+        m_page_count = 0;
+        m_page_capacity = 0;
+        m_size = 0;
+        m_free_page_head = NO_PAGE;
+    }
+
+    void ensure_page_capacity(size_type pages_needed)
+    {
+        if (pages_needed <= m_page_capacity)
+        {
+            return;
+        }
+
+        detail::grow_page_table(m_pages, m_page_capacity, m_page_count, pages_needed);
+        std::fill(m_pages + m_page_count, m_pages + m_page_capacity, nullptr);
+    }
+
+  public:
+    /// @brief Forward iterator over live elements; skips holes 64 slots at a time
+    template <typename ValueType> class basic_iterator
+    {
+      public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = std::remove_cv_t<ValueType>;
+        using difference_type = std::ptrdiff_t;
+        using pointer = ValueType*;
+        using reference = ValueType&;
+
+        template <typename> friend class basic_iterator;
+        friend class chunked_slot_map;
+
+        using container_pointer = std::conditional_t<std::is_const_v<ValueType>, const chunked_slot_map*, chunked_slot_map*>;
+
+        basic_iterator() noexcept
+            : m_container(nullptr)
+            , m_page_idx(0)
+            , m_word_idx(0)
+            , m_bits(0)
+        {
+        }
+
+        template <typename U, typename = std::enable_if_t<std::is_const_v<ValueType> && !std::is_const_v<U>>>
+        basic_iterator(const basic_iterator<U>& other) noexcept
+            : m_container(other.m_container)
+            , m_page_idx(other.m_page_idx)
+            , m_word_idx(other.m_word_idx)
+            , m_bits(other.m_bits)
+        {
+        }
+
+        reference operator*() const
+        {
+            CHUNKED_VEC_ASSERT(m_bits != 0 && "Dereferencing end iterator");
+            return m_container->m_pages[m_page_idx]->elements()[current_slot()];
+        }
+
+        pointer operator->() const { return &**this; }
+
+        CHUNKED_VEC_INLINE basic_iterator& operator++() noexcept
+        {
+            m_bits &= m_bits - 1;
+            if (m_bits == 0)
+            {
+                advance_word();
+            }
+            return *this;
+        }
+
+        CHUNKED_VEC_INLINE basic_iterator operator++(int) noexcept
+        {
+            basic_iterator temp = *this;
+            ++(*this);
+            return temp;
+        }
+
+        /// @brief Handle of the current element
+        [[nodiscard]] handle get_handle() const
+        {
+            const uint32_t slot = current_slot();
+            return handle(static_cast<uint32_t>(m_page_idx * PAGE_SIZE + slot), m_container->m_pages[m_page_idx]->generations[slot]);
+        }
+
+        bool operator==(const basic_iterator& other) const noexcept
+        {
+            return m_page_idx == other.m_page_idx && m_word_idx == other.m_word_idx && m_bits == other.m_bits;
+        }
+        bool operator!=(const basic_iterator& other) const noexcept { return !(*this == other); }
+
+      private:
+        container_pointer m_container;
+        size_type m_page_idx;
+        size_type m_word_idx;
+        // Occupancy bits of the current word that have not been visited yet; the lowest one is the current element
+        uint64_t m_bits;
+
+        explicit basic_iterator(container_pointer container) noexcept
+            : m_container(container)
+            , m_page_idx(0)
+            , m_word_idx(0)
+            , m_bits(0)
+        {
+            if (m_container->m_page_count == 0)
+            {
+                return;
+            }
+            m_bits = m_container->m_pages[0]->occupancy[0];
+            if (m_bits == 0)
+            {
+                advance_word();
+            }
+        }
+
+        basic_iterator(container_pointer container, size_type page_idx, size_type word_idx, uint64_t bits) noexcept
+            : m_container(container)
+            , m_page_idx(page_idx)
+            , m_word_idx(word_idx)
+            , m_bits(bits)
+        {
+        }
+
+        [[nodiscard]] CHUNKED_VEC_INLINE uint32_t current_slot() const
+        {
+            return static_cast<uint32_t>(m_word_idx * 64) + detail::lowest_set_bit(m_bits);
+        }
+
+        void advance_word() noexcept
+        {
+            while (m_page_idx < m_container->m_page_count)
+            {
+                if (++m_word_idx == OCCUPANCY_WORDS)
+                {
+                    m_word_idx = 0;
+                    if (++m_page_idx == m_container->m_page_count)
+                    {
+                        break;
+                    }
+                }
+                m_bits = m_container->m_pages[m_page_idx]->occupancy[m_word_idx];
+                if (m_bits != 0)
+                {
+                    return;
+                }
+            }
+            // End position
+            m_page_idx = m_container->m_page_count;
+            m_word_idx = 0;
+            m_bits = 0;
+        }
+    };
+};
+
+} // namespace dod
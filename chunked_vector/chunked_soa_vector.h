@@ -0,0 +1,500 @@
+#pragma once
+
+#include "chunked_vector.h"
+
+#include <array>
+#include <tuple>
+
+namespace dod
+{
+
+/// @brief A contiguous run of one column inside a single page
+/// @tparam T Column element type (const-qualified for read-only segments)
+template <typename T> using column_segment = page_segment<T>;
+
+namespace detail
+{
+
+/// @brief Byte layout of a structure-of-arrays page: PAGE_SIZE elements of every column, back to back
+template <size_t PAGE_SIZE, typename... Ts> struct soa_page_layout
+{
+    static constexpr size_t COLUMN_COUNT = sizeof...(Ts);
+
+    // Every column starts on a cache line, which also satisfies aligned SIMD loads up to 512 bits
+    static constexpr size_t COLUMN_ALIGNMENT = 64;
+
+    static constexpr size_t PAGE_ALIGNMENT = std::max({COLUMN_ALIGNMENT, alignof(Ts)...});
+
+    static constexpr std::array<size_t, COLUMN_COUNT + 1> compute_offsets()
+    {
+        constexpr std::array<size_t, COLUMN_COUNT> column_bytes = {PAGE_SIZE * sizeof(Ts)...};
+        constexpr std::array<size_t, COLUMN_COUNT> column_alignments = {std::max(COLUMN_ALIGNMENT, alignof(Ts))...};
+
+        std::array<size_t, COLUMN_COUNT + 1> offsets = {};
+        size_t offset = 0;
+        for (size_t column = 0; column < COLUMN_COUNT; ++column)
+        {
+            offset = (offset + column_alignments[column] - 1) / column_alignments[column] * column_alignments[column];
+            offsets[column] = offset;
+            offset += column_bytes[column];
+        }
+        // The last entry is the total page size in bytes
+        offsets[COLUMN_COUNT] = offset;
+        return offsets;
+    }
+
+    static constexpr std::array<size_t, COLUMN_COUNT + 1> OFFSETS = compute_offsets();
+    static constexpr size_t PAGE_BYTES = OFFSETS[COLUMN_COUNT];
+};
+
+} // namespace detail
+
+/// @brief A structure-of-arrays chunked container
+/// @details Keeps the chunked_vector page design (stable addresses, no reallocation of elements,
+/// O(1) worst-case push_back), but each page is a single allocation holding PAGE_SIZE elements of
+/// every column back to back. Passes that touch one or two fields only pull those columns into cache.
+///
+/// Elements are accessed either as a tuple of references (operator[]) or per column (get<I>()).
+/// For bulk processing use segment_count() / segment<I>(segment_idx), which return contiguous
+/// per-page spans of a single column.
+///
+/// @tparam PAGE_SIZE The number of elements per page
+/// @tparam Ts Column types
+template <size_t PAGE_SIZE, typename... Ts> class basic_chunked_soa_vector
+{
+    static_assert(sizeof...(Ts) > 0, "chunked_soa_vector needs at least one column");
+
+  public:
+    using value_type = std::tuple<Ts...>;
+    using reference = std::tuple<Ts&...>;
+    using const_reference = std::tuple<const Ts&...>;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+
+    template <size_t I> using column_type = std::tuple_element_t<I, value_type>;
+
+    /// @brief Returns the page size used by this container
+    [[nodiscard]] static constexpr size_t page_size() { return PAGE_SIZE; }
+
+    /// @brief Returns the number of columns
+    [[nodiscard]] static constexpr size_t column_count() { return sizeof...(Ts); }
+
+    basic_chunked_soa_vector() noexcept
+        : m_pages(nullptr)
+        , m_page_count(0)
+        , m_page_capacity(0)
+        , m_size(0)
+    {
+    }
+
+    explicit basic_chunked_soa_vector(size_type count)
+        : basic_chunked_soa_vector()
+    {
+        resize(count);
+    }
+
+    basic_chunked_soa_vector(size_type count, const value_type& value)
+        : basic_chunked_soa_vector()
+    {
+        resize(count, value);
+    }
+
+    basic_chunked_soa_vector(std::initializer_list<value_type> init)
+        : basic_chunked_soa_vector()
+    {
+        reserve(init.size());
+        for (const auto& item : init)
+        {
+            push_back(item);
+        }
+    }
+
+    basic_chunked_soa_vector(const basic_chunked_soa_vector& other)
+        : basic_chunked_soa_vector()
+    {
+        copy_from(other);
+    }
+
+    basic_chunked_soa_vector(basic_chunked_soa_vector&& other) noexcept
+        : m_pages(other.m_pages)
+        , m_page_count(other.m_page_count)
+        , m_page_capacity(other.m_page_capacity)
+        , m_size(other.m_size)
+    {
+        other.m_pages = nullptr;
+        other.m_page_count = 0;
+        other.m_page_capacity = 0;
+        other.m_size = 0;
+    }
+
+    ~basic_chunked_soa_vector() { free_pages(); }
+
+    /// @brief Copy assignment - reuses already allocated pages
+    basic_chunked_soa_vector& operator=(const basic_chunked_soa_vector& other)
+    {
+        if (this != &other)
+        {
+            clear();
+            copy_from(other);
+        }
+        return *this;
+    }
+
+    basic_chunked_soa_vector& operator=(basic_chunked_soa_vector&& other) noexcept
+    {
+        if (this != &other)
+        {
+            free_pages();
+
+            m_pages = other.m_pages;
+            m_page_count = other.m_page_count;
+            m_page_capacity = other.m_page_capacity;
+            m_size = other.m_size;
+
+            other.m_pages = nullptr;
+            other.m_page_count = 0;
+            other.m_page_capacity = 0;
+            other.m_size = 0;
+        }
+        return *this;
+    }
+
+    /// @brief Access all columns of an element as a tuple of references
+    [[nodiscard]] CHUNKED_VEC_INLINE reference operator[](size_type pos)
+    {
+        CHUNKED_VEC_ASSERT(pos < m_size && "Index out of range");
+        auto [page_idx, elem_idx] = layout::split(pos);
+        return element_refs<reference>(m_pages[page_idx], elem_idx, std::index_sequence_for<Ts...>{});
+    }
+
+    [[nodiscard]] CHUNKED_VEC_INLINE const_reference operator[](size_type pos) const
+    {
+        CHUNKED_VEC_ASSERT(pos < m_size && "Index out of range");
+        auto [page_idx, elem_idx] = layout::split(pos);
+        return element_refs<const_reference>(m_pages[page_idx], elem_idx, std::index_sequence_for<Ts...>{});
+    }
+
+    [[nodiscard]] CHUNKED_VEC_INLINE reference at(size_type pos)
+    {
+        if (pos >= m_size)
+        {
+            throw std::out_of_range("chunked_soa_vector::at: index out of range");
+        }
+        return (*this)[pos];
+    }
+
+    [[nodiscard]] CHUNKED_VEC_INLINE const_reference at(size_type pos) const
+    {
+        if (pos >= m_size)
+        {
+            throw std::out_of_range("chunked_soa_vector::at: index out of range");
+        }
+        return (*this)[pos];
+    }
+
+    /// @brief Access a single column of an element
+    template <size_t I> [[nodiscard]] CHUNKED_VEC_INLINE column_type<I>& get(size_type pos)
+    {
+        CHUNKED_VEC_ASSERT(pos < m_size && "Index out of range");
+        auto [page_idx, elem_idx] = layout::split(pos);
+        return column_data<I>(m_pages[page_idx])[elem_idx];
+    }
+
+    template <size_t I> [[nodiscard]] CHUNKED_VEC_INLINE const column_type<I>& get(size_type pos) const
+    {
+        CHUNKED_VEC_ASSERT(pos < m_size && "Index out of range");
+        auto [page_idx, elem_idx] = layout::split(pos);
+        return column_data<I>(m_pages[page_idx])[elem_idx];
+    }
+
+    /// @brief Number of contiguous segments (live pages) per column
+    [[nodiscard]] CHUNKED_VEC_INLINE size_type segment_count() const noexcept { return layout::pages_needed(m_size); }
+
+    /// @brief Contiguous elements of column I stored in page segment_idx
+    /// @note Every segment holds PAGE_SIZE elements except possibly the last one
+    template <size_t I> [[nodiscard]] CHUNKED_VEC_INLINE column_segment<column_type<I>> segment(size_type segment_idx)
+    {
+        CHUNKED_VEC_ASSERT(segment_idx < segment_count() && "Segment index out of range");
+        return {column_data<I>(m_pages[segment_idx]), elements_in_page(segment_idx)};
+    }
+
+    template <size_t I> [[nodiscard]] CHUNKED_VEC_INLINE column_segment<const column_type<I>> segment(size_type segment_idx) const
+    {
+        CHUNKED_VEC_ASSERT(segment_idx < segment_count() && "Segment index out of range");
+        return {column_data<I>(m_pages[segment_idx]), elements_in_page(segment_idx)};
+    }
+
+    [[nodiscard]] CHUNKED_VEC_INLINE bool empty() const noexcept { return m_size == 0; }
+    [[nodiscard]] CHUNKED_VEC_INLINE size_type size() const noexcept { return m_size; }
+    [[nodiscard]] CHUNKED_VEC_INLINE size_type capacity() const noexcept { return m_page_count * PAGE_SIZE; }
+
+    void reserve(size_type new_capacity)
+    {
+        if (new_capacity <= capacity())
+        {
+            return;
+        }
+
+        const size_type pages_needed = layout::pages_needed(new_capacity);
+        ensure_page_capacity(pages_needed);
+        while (m_page_count < pages_needed)
+        {
+            m_pages[m_page_count++] = allocate_page();
+        }
+    }
+
+    /// @brief Destroy all elements, keeping the pages as spare capacity
+    void clear() noexcept
+    {
+        destroy_range(0, m_size);
+        m_size = 0;
+    }
+
+    /// @brief Append an element, writing every column after a single capacity check
+    void push_back(const value_type& value) { construct_at_back(value); }
+    void push_back(value_type&& value) { construct_at_back(std::move(value)); }
+
+    /// @brief Append an element constructing each column from the matching argument
+    template <typename... Args> void emplace_back(Args&&... args)
+    {
+        static_assert(sizeof...(Args) == sizeof...(Ts), "emplace_back takes exactly one argument per column");
+        construct_at_back(std::forward_as_tuple(std::forward<Args>(args)...));
+    }
+
+    void pop_back()
+    {
+        CHUNKED_VEC_ASSERT(m_size > 0 && "Cannot pop from empty chunked_soa_vector");
+        destroy_range(m_size - 1, m_size);
+        --m_size;
+    }
+
+    void resize(size_type count)
+    {
+        if (count < m_size)
+        {
+            destroy_range(count, m_size);
+            m_size = count;
+            return;
+        }
+
+        reserve(count);
+        for_each_page_range(m_size, count,
+                            [](char* page, size_type first, size_type last)
+                            {
+                                for_each_column(
+                                    [&](auto column)
+                                    {
+                                        constexpr size_t I = decltype(column)::value;
+                                        column_type<I>* data = column_data<I>(page);
+                                        for (size_type elem_idx = first; elem_idx < last; ++elem_idx)
+                                        {
+                                            dod::construct<column_type<I>>(&data[elem_idx]);
+                                        }
+                                    });
+                            });
+        m_size = count;
+    }
+
+    void resize(size_type count, const value_type& value)
+    {
+        if (count < m_size)
+        {
+            destroy_range(count, m_size);
+            m_size = count;
+            return;
+        }
+
+        reserve(count);
+        for_each_page_range(m_size, count,
+                            [&value](char* page, size_type first, size_type last)
+                            {
+                                for_each_column(
+                                    [&](auto column)
+                                    {
+                                        constexpr size_t I = decltype(column)::value;
+                                        column_type<I>* data = column_data<I>(page);
+                                        for (size_type elem_idx = first; elem_idx < last; ++elem_idx)
+                                        {
+                                            dod::construct<column_type<I>>(&data[elem_idx], std::get<I>(value));
+                                        }
+                                    });
+                            });
+        m_size = count;
+    }
+
+  private:
+    using layout = detail::page_layout<PAGE_SIZE>;
+    using soa_layout = detail::soa_page_layout<PAGE_SIZE, Ts...>;
+
+    // m_pages[0, m_page_count) are allocated, the rest of the page table is nullptr
+    char** m_pages;
+    size_type m_page_count;
+    size_type m_page_capacity;
+    size_type m_size;
+
+    template <size_t I> [[nodiscard]] static CHUNKED_VEC_INLINE column_type<I>* column_data(char* page) noexcept
+    {
+        return reinterpret_cast<column_type<I>*>(page + soa_layout::OFFSETS[I]);
+    }
+
+    template <size_t I> [[nodiscard]] static CHUNKED_VEC_INLINE const column_type<I>* column_data(const char* page) noexcept
+    {
+        return reinterpret_cast<const column_type<I>*>(page + soa_layout::OFFSETS[I]);
+    }
+
+    template <typename Fn, size_t... Is> static CHUNKED_VEC_INLINE void for_each_column(Fn&& fn, std::index_sequence<Is...>)
+    {
+        (fn(std::integral_constant<size_t, Is>{}), ...);
+    }
+
+    /// @brief Calls fn(std::integral_constant<size_t, I>) for every column index
+    template <typename Fn> static CHUNKED_VEC_INLINE void for_each_column(Fn&& fn)
+    {
+        for_each_column(std::forward<Fn>(fn), std::index_sequence_for<Ts...>{});
+    }
+
+    template <typename Tuple, typename Page, size_t... Is>
+    [[nodiscard]] static CHUNKED_VEC_INLINE Tuple element_refs(Page* page, size_type elem_idx, std::index_sequence<Is...>) noexcept
+    {
+        return Tuple(column_data<Is>(page)[elem_idx]...);
+    }
+
+    [[nodiscard]] CHUNKED_VEC_INLINE size_type elements_in_page(size_type page_idx) const noexcept
+    {
+        const size_type page_start = page_idx * PAGE_SIZE;
+        return std::min(m_size - page_start, PAGE_SIZE);
+    }
+
+    /// @brief Calls fn(page, first_elem, last_elem) for every page touched by [start, end)
+    template <typename Fn> void for_each_page_range(size_type start, size_type end, Fn&& fn) const
+    {
+        size_type current_idx = start;
+        while (current_idx < end)
+        {
+            auto [page_idx, start_elem_idx] = layout::split(current_idx);
+            const size_type elements_in_range = std::min(end - current_idx, PAGE_SIZE - start_elem_idx);
+            fn(m_pages[page_idx], start_elem_idx, start_elem_idx + elements_in_range);
+            current_idx += elements_in_range;
+        }
+    }
+
+    void destroy_range(size_type start, size_type end) noexcept
+    {
+        if constexpr (!(std::is_trivially_destructible_v<Ts> && ...))
+        {
+            for_each_page_range(start, end,
+                                [](char* page, size_type first, size_type last)
+                                {
+                                    for_each_column(
+                                        [&](auto column)
+                                        {
+                                            constexpr size_t I = decltype(column)::value;
+                                            if constexpr (!std::is_trivially_destructible_v<column_type<I>>)
+                                            {
+                                                column_type<I>* data = column_data<I>(page);
+                                                for (size_type elem_idx = first; elem_idx < last; ++elem_idx)
+                                                {
+                                                    dod::destruct(&data[elem_idx]);
+                                                }
+                                            }
+                                        });
+                                });
+        }
+        else
+        {
+            CHUNKED_VEC_MAYBE_UNUSED(start);
+            CHUNKED_VEC_MAYBE_UNUSED(end);
+        }
+    }
+
+    template <typename Tuple> CHUNKED_VEC_INLINE void construct_at_back(Tuple&& values)
+    {
+        auto [page_idx, elem_idx] = layout::split(m_size);
+        if (page_idx >= m_page_count)
+        {
+            ensure_page_capacity(page_idx + 1);
+            m_pages[m_page_count++] = allocate_page();
+        }
+
+        char* page = m_pages[page_idx];
+        for_each_column(
+            [&](auto column)
+            {
+                constexpr size_t I = decltype(column)::value;
+                dod::construct<column_type<I>>(&column_data<I>(page)[elem_idx], std::get<I>(std::forward<Tuple>(values)));
+            });
+        ++m_size;
+    }
+
+    /// @brief Copy other's elements into this (empty) container column by column, page by page
+    void copy_from(const basic_chunked_soa_vector& other)
+    {
+        CHUNKED_VEC_ASSERT(m_size == 0 && "copy_from expects an empty container");
+        reserve(other.m_size);
+
+        const size_type live_pages = other.segment_count();
+        for (size_type page_idx = 0; page_idx < live_pages; ++page_idx)
+        {
+            char* dst_page = m_pages[page_idx];
+            const char* src_page = other.m_pages[page_idx];
+            const size_type elements = other.elements_in_page(page_idx);
+            for_each_column(
+                [&](auto column)
+                {
+                    constexpr size_t I = decltype(column)::value;
+                    using U = column_type<I>;
+                    if constexpr (std::is_trivially_copyable_v<U>)
+                    {
+                        std::memcpy(column_data<I>(dst_page), column_data<I>(src_page), elements * sizeof(U));
+                    }
+                    else
+                    {
+                        U* dst = column_data<I>(dst_page);
+                        const U* src = column_data<I>(src_page);
+                        for (size_type elem_idx = 0; elem_idx < elements; ++elem_idx)
+                        {
+                            dod::construct<U>(&dst[elem_idx], src[elem_idx]);
+                        }
+                    }
+                });
+        }
+        m_size = other.m_size;
+    }
+
+    [[nodiscard]] static char* allocate_page()
+    {
+        return static_cast<char*>(CHUNKED_VEC_ALLOC(soa_layout::PAGE_BYTES, soa_layout::PAGE_ALIGNMENT));
+    }
+
+    void free_pages() noexcept
+    {
+        clear();
+        for (size_type page_idx = 0; page_idx < m_page_count; ++page_idx)
+        {
+            CHUNKED_VEC_FREE(m_pages[page_idx]);
+        }
+        if (m_pages)
+        {
+            CHUNKED_VEC_FREE(m_pages);
+        }
+        m_pages = nullptr;
+        m_page_count = 0;
+        m_page_capacity = 0;
+    }
+
+    void ensure_page_capacity(size_type pages_needed)
+    {
+        if (pages_needed <= m_page_capacity)
+        {
+            return;
+        }
+
+        detail::grow_page_table(m_pages, m_page_capacity, m_page_count, pages_needed);
+        std::fill(m_pages + m_page_count, m_pages + m_page_capacity, nullptr);
+    }
+};
+
+/// @brief Structure-of-arrays chunked container with the default page size
+template <typename... Ts> using chunked_soa_vector = basic_chunked_soa_vector<1024, Ts...>;
+
+} // namespace dod
@@ -0,0 +1,672 @@
+#pragma once
+
+#include "chunked_vector.h"
+#include <functional>
+
+namespace dod
+{
+
+/// @brief A sorted set of unique keys stored in partially filled pages
+/// @details Pages behave like B+-tree leaves: each page holds a sorted run of up to PAGE_SIZE keys,
+/// a full page is split in two on insert and an underfull page is merged with a neighbour on erase.
+/// The first key of every page is kept in a separate compact fence array, so a lookup is a binary
+/// search over the fences (one cache-friendly array) followed by a binary search inside one page.
+///
+/// Insert and erase cost O(log(page count) + PAGE_SIZE) since only one page is shifted. Keys are
+/// never modified in place (iterators are const), and the fence array requires T to be copyable.
+///
+/// @tparam T The key type
+/// @tparam Compare Strict weak ordering used to sort the keys (default: std::less<T>)
+/// @tparam PAGE_SIZE The maximum number of keys per page (default: 1024)
+template <typename T, typename Compare = std::less<T>, size_t PAGE_SIZE = 1024> class chunked_sorted_set
+{
+    static_assert(PAGE_SIZE >= 4, "PAGE_SIZE must be at least 4 to allow page splits and merges");
+
+  public:
+    using key_type = T;
+    using value_type = T;
+    using key_compare = Compare;
+    using reference = const T&;
+    using const_reference = const T&;
+    using pointer = const T*;
+    using const_pointer = const T*;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+
+    class const_iterator;
+    using iterator = const_iterator;
+
+    /// @brief Returns the page size used by this container
+    [[nodiscard]] static constexpr size_t page_size() { return PAGE_SIZE; }
+
+    chunked_sorted_set() noexcept(std::is_nothrow_default_constructible_v<Compare>)
+        : m_pages(nullptr)
+        , m_fences(nullptr)
+        , m_page_count(0)
+        , m_allocated_pages(0)
+        , m_page_capacity(0)
+        , m_size(0)
+        , m_compare()
+    {
+    }
+
+    explicit chunked_sorted_set(const Compare& compare)
+        : m_pages(nullptr)
+        , m_fences(nullptr)
+        , m_page_count(0)
+        , m_allocated_pages(0)
+        , m_page_capacity(0)
+        , m_size(0)
+        , m_compare(compare)
+    {
+    }
+
+    chunked_sorted_set(std::initializer_list<T> init, const Compare& compare = Compare())
+        : chunked_sorted_set(compare)
+    {
+        for (const auto& item : init)
+        {
+            insert(item);
+        }
+    }
+
+    chunked_sorted_set(const chunked_sorted_set& other)
+        : chunked_sorted_set(other.m_compare)
+    {
+        copy_from(other);
+    }
+
+    chunked_sorted_set(chunked_sorted_set&& other) noexcept
+        : m_pages(other.m_pages)
+        , m_fences(other.m_fences)
+        , m_page_count(other.m_page_count)
+        , m_allocated_pages(other.m_allocated_pages)
+        , m_page_capacity(other.m_page_capacity)
+        , m_size(other.m_size)
+        , m_compare(std::move(other.m_compare))
+    {
+        other.m_pages = nullptr;
+        other.m_fences = nullptr;
+        other.m_page_count = 0;
+        other.m_allocated_pages = 0;
+        other.m_page_capacity = 0;
+        other.m_size = 0;
+    }
+
+    ~chunked_sorted_set() { free_pages(); }
+
+    chunked_sorted_set& operator=(const chunked_sorted_set& other)
+    {
+        if (this != &other)
+        {
+            clear();
+            m_compare = other.m_compare;
+            copy_from(other);
+        }
+        return *this;
+    }
+
+    chunked_sorted_set& operator=(chunked_sorted_set&& other) noexcept
+    {
+        if (this != &other)
+        {
+            free_pages();
+
+            m_pages = other.m_pages;
+            m_fences = other.m_fences;
+            m_page_count = other.m_page_count;
+            m_allocated_pages = other.m_allocated_pages;
+            m_page_capacity = other.m_page_capacity;
+            m_size = other.m_size;
+            m_compare = std::move(other.m_compare);
+
+            other.m_pages = nullptr;
+            other.m_fences = nullptr;
+            other.m_page_count = 0;
+            other.m_allocated_pages = 0;
+            other.m_page_capacity = 0;
+            other.m_size = 0;
+        }
+        return *this;
+    }
+
+    [[nodiscard]] CHUNKED_VEC_INLINE const_iterator begin() const noexcept { return const_iterator(this, 0, 0); }
+    [[nodiscard]] CHUNKED_VEC_INLINE const_iterator cbegin() const noexcept { return begin(); }
+    [[nodiscard]] CHUNKED_VEC_INLINE const_iterator end() const noexcept { return const_iterator(this, m_page_count, 0); }
+    [[nodiscard]] CHUNKED_VEC_INLINE const_iterator cend() const noexcept { return end(); }
+
+    [[nodiscard]] CHUNKED_VEC_INLINE bool empty() const noexcept { return m_size == 0; }
+    [[nodiscard]] CHUNKED_VEC_INLINE size_type size() const noexcept { return m_size; }
+
+    /// @brief Number of pages currently holding keys
+    [[nodiscard]] CHUNKED_VEC_INLINE size_type page_count() const noexcept { return m_page_count; }
+
+    [[nodiscard]] key_compare key_comp() const { return m_compare; }
+
+    /// @brief Smallest key
+    [[nodiscard]] CHUNKED_VEC_INLINE const_reference front() const
+    {
+        CHUNKED_VEC_ASSERT(m_size > 0 && "Cannot access front of empty chunked_sorted_set");
+        return m_pages[0].data[0];
+    }
+
+    /// @brief Largest key
+    [[nodiscard]] CHUNKED_VEC_INLINE const_reference back() const
+    {
+        CHUNKED_VEC_ASSERT(m_size > 0 && "Cannot access back of empty chunked_sorted_set");
+        const page_entry& page = m_pages[m_page_count - 1];
+        return page.data[page.count - 1];
+    }
+
+    /// @brief First key that is not less than key
+    [[nodiscard]] const_iterator lower_bound(const T& key) const
+    {
+        if (m_page_count == 0)
+        {
+            return end();
+        }
+        const size_type page_idx = find_page(key);
+        const page_entry& page = m_pages[page_idx];
+        const size_type elem_idx = static_cast<size_type>(std::lower_bound(page.data, page.data + page.count, key, m_compare) - page.data);
+        return make_iterator(page_idx, elem_idx);
+    }
+
+    /// @brief First key that is greater than key
+    [[nodiscard]] const_iterator upper_bound(const T& key) const
+    {
+        if (m_page_count == 0)
+        {
+            return end();
+        }
+        const size_type page_idx = find_page(key);
+        const page_entry& page = m_pages[page_idx];
+        const size_type elem_idx = static_cast<size_type>(std::upper_bound(page.data, page.data + page.count, key, m_compare) - page.data);
+        return make_iterator(page_idx, elem_idx);
+    }
+
+    [[nodiscard]] const_iterator find(const T& key) const
+    {
+        const_iterator it = lower_bound(key);
+        if (it != end() && !m_compare(key, *it))
+        {
+            return it;
+        }
+        return end();
+    }
+
+    [[nodiscard]] bool contains(const T& key) const { return find(key) != end(); }
+    [[nodiscard]] size_type count(const T& key) const { return contains(key) ? 1 : 0; }
+
+    /// @brief Insert key if it is not already present
+    /// @return Iterator to the key in the set and whether the insertion took place
+    /// @note Time complexity: O(log(page count) + PAGE_SIZE)
+    std::pair<const_iterator, bool> insert(const T& key) { return insert_impl(key); }
+    std::pair<const_iterator, bool> insert(T&& key) { return insert_impl(std::move(key)); }
+
+    /// @brief Erase key if present
+    /// @return Number of erased keys (0 or 1)
+    size_type erase(const T& key)
+    {
+        const_iterator it = find(key);
+        if (it == end())
+        {
+            return 0;
+        }
+        erase(it);
+        return 1;
+    }
+
+    /// @brief Erase the key at pos
+    /// @return Iterator to the key that followed the erased one
+    const_iterator erase(const_iterator pos)
+    {
+        CHUNKED_VEC_ASSERT(pos.m_container == this && pos != end() && "Invalid iterator");
+        size_type page_idx = pos.m_page_idx;
+        size_type elem_idx = pos.m_elem_idx;
+        page_entry& page = m_pages[page_idx];
+
+        dod::destruct(page.data + elem_idx);
+        relocate_elements(page.data + elem_idx, page.data + elem_idx + 1, page.count - elem_idx - 1);
+        --page.count;
+        --m_size;
+
+        if (page.count == 0)
+        {
+            remove_page(page_idx);
+            return make_iterator(page_idx, 0);
+        }
+        if (elem_idx == 0)
+        {
+            dod::reconstruct(m_fences + page_idx, page.data[0]);
+        }
+
+        if (page.count < MERGE_THRESHOLD)
+        {
+            // Merge into the left neighbour when possible so the successor keeps a stable position relative to it
+            if (page_idx > 0 && m_pages[page_idx - 1].count + page.count <= MERGED_PAGE_LIMIT)
+            {
+                elem_idx += m_pages[page_idx - 1].count;
+                merge_pages(page_idx - 1);
+                --page_idx;
+            }
+            else if (page_idx + 1 < m_page_count && page.count + m_pages[page_idx + 1].count <= MERGED_PAGE_LIMIT)
+            {
+                merge_pages(page_idx);
+            }
+        }
+        return make_iterator(page_idx, elem_idx);
+    }
+
+    /// @brief Replace the contents with a strictly increasing range of keys
+    /// @details Pages are filled completely, one page at a time. Trivially copyable keys coming from a
+    /// pointer range are copied with one memcpy per page.
+    template <typename InputIt> void assign_sorted(InputIt first, InputIt last)
+    {
+        clear();
+        page_entry* page = nullptr;
+        for (; first != last;)
+        {
+            if (page == nullptr || page->count == PAGE_SIZE)
+            {
+                // add_page may reallocate the page table
+                const size_type page_idx = add_page(m_page_count);
+                page = &m_pages[page_idx];
+            }
+
+            if constexpr (std::is_pointer_v<InputIt> && std::is_trivially_copyable_v<T>)
+            {
+                const size_type count = std::min(static_cast<size_type>(last - first), PAGE_SIZE);
+                std::memcpy(static_cast<void*>(page->data), first, count * sizeof(T));
+                page->count = count;
+                m_size += count;
+                first += count;
+            }
+            else
+            {
+                dod::construct<T>(page->data + page->count, *first);
+                ++page->count;
+                ++m_size;
+                ++first;
+            }
+
+            if (page->count == PAGE_SIZE || first == last)
+            {
+                CHUNKED_VEC_ASSERT(is_page_sorted(*page) && "assign_sorted requires strictly increasing keys");
+                const size_type page_idx = static_cast<size_type>(page - m_pages);
+                construct_fence(page_idx);
+                CHUNKED_VEC_ASSERT((page_idx == 0 || m_compare(back_of(page_idx - 1), page->data[0])) &&
+                                   "assign_sorted requires strictly increasing keys");
+            }
+        }
+    }
+
+    /// @brief Destroy all keys, keeping the pages as spare capacity
+    void clear() noexcept
+    {
+        for (size_type page_idx = 0; page_idx < m_page_count; ++page_idx)
+        {
+            page_entry& page = m_pages[page_idx];
+            if constexpr (!std::is_trivially_destructible_v<T>)
+            {
+                for (size_type elem_idx = 0; elem_idx < page.count; ++elem_idx)
+                {
+                    dod::destruct(page.data + elem_idx);
+                }
+                dod::destruct(m_fences + page_idx);
+            }
+            page.count = 0;
+        }
+        m_page_count = 0;
+        m_size = 0;
+    }
+
+  private:
+    /// @brief An underfull page is merged with a neighbour when it drops below a quarter of PAGE_SIZE
+    static constexpr size_type MERGE_THRESHOLD = PAGE_SIZE / 4;
+    /// @brief A merge must leave room for inserts, otherwise the next insert would split again
+    static constexpr size_type MERGED_PAGE_LIMIT = PAGE_SIZE - PAGE_SIZE / 4;
+
+    struct page_entry
+    {
+        T* data;
+        size_type count;
+    };
+
+    // m_pages[0, m_page_count) are live pages in key order, m_pages[m_page_count, m_allocated_pages) are spare pages.
+    // m_fences[i] is a copy of the first key of live page i.
+    page_entry* m_pages;
+    T* m_fences;
+    size_type m_page_count;
+    size_type m_allocated_pages;
+    size_type m_page_capacity;
+    size_type m_size;
+    Compare m_compare;
+
+    [[nodiscard]] const_iterator make_iterator(size_type page_idx, size_type elem_idx) const noexcept
+    {
+        // Normalize one-past-the-page positions to the start of the next page
+        if (page_idx < m_page_count && elem_idx == m_pages[page_idx].count)
+        {
+            ++page_idx;
+            elem_idx = 0;
+        }
+        return const_iterator(this, page_idx, elem_idx);
+    }
+
+    [[nodiscard]] const T& back_of(size_type page_idx) const noexcept { return m_pages[page_idx].data[m_pages[page_idx].count - 1]; }
+
+    /// @brief Index of the last page whose fence is not greater than key (0 when key precedes every page)
+    [[nodiscard]] size_type find_page(const T& key) const
+    {
+        const T* fence = std::upper_bound(m_fences + 1, m_fences + m_page_count, key, m_compare);
+        return static_cast<size_type>(fence - m_fences) - 1;
+    }
+
+    [[nodiscard]] bool is_page_sorted(const page_entry& page) const
+    {
+        for (size_type elem_idx = 1; elem_idx < page.count; ++elem_idx)
+        {
+            if (!m_compare(page.data[elem_idx - 1], page.data[elem_idx]))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    template <typename U> std::pair<const_iterator, bool> insert_impl(U&& key)
+    {
+        if (m_page_count == 0)
+        {
+            const size_type page_idx = add_page(0);
+            dod::construct<T>(m_pages[page_idx].data, std::forward<U>(key));
+            m_pages[page_idx].count = 1;
+            construct_fence(page_idx);
+            ++m_size;
+            return {const_iterator(this, 0, 0), true};
+        }
+
+        size_type page_idx = find_page(key);
+        size_type elem_idx;
+        {
+            const page_entry& page = m_pages[page_idx];
+            elem_idx = static_cast<size_type>(std::lower_bound(page.data, page.data + page.count, key, m_compare) - page.data);
+            if (elem_idx < page.count && !m_compare(key, page.data[elem_idx]))
+            {
+                return {const_iterator(this, page_idx, elem_idx), false};
+            }
+        }
+
+        if (m_pages[page_idx].count == PAGE_SIZE)
+        {
+            if (page_idx + 1 == m_page_count && elem_idx == PAGE_SIZE)
+            {
+                // Appending past the largest key: start a new page instead of leaving two half-full ones
+                page_idx = add_page(m_page_count);
+                elem_idx = 0;
+            }
+            else
+            {
+                split_page(page_idx);
+                const size_type left_count = m_pages[page_idx].count;
+                if (elem_idx > left_count)
+                {
+                    ++page_idx;
+                    elem_idx -= left_count;
+                }
+            }
+        }
+
+        page_entry& page = m_pages[page_idx];
+        relocate_elements_backward(page.data + elem_idx + 1, page.data + elem_idx, page.count - elem_idx);
+        dod::construct<T>(page.data + elem_idx, std::forward<U>(key));
+        ++page.count;
+        ++m_size;
+
+        if (elem_idx == 0)
+        {
+            if (page.count == 1)
+            {
+                construct_fence(page_idx);
+            }
+            else
+            {
+                dod::reconstruct(m_fences + page_idx, page.data[0]);
+            }
+        }
+        return {const_iterator(this, page_idx, elem_idx), true};
+    }
+
+    /// @brief Move the upper half of a full page into a new page that follows it
+    void split_page(size_type page_idx)
+    {
+        const size_type new_page_idx = add_page(page_idx + 1);
+        page_entry& left = m_pages[page_idx];
+        page_entry& right = m_pages[new_page_idx];
+
+        const size_type left_count = left.count / 2;
+        const size_type right_count = left.count - left_count;
+        relocate_elements(right.data, left.data + left_count, right_count);
+        left.count = left_count;
+        right.count = right_count;
+        construct_fence(new_page_idx);
+    }
+
+    /// @brief Append page page_idx + 1 to page page_idx and remove it
+    void merge_pages(size_type page_idx)
+    {
+        page_entry& left = m_pages[page_idx];
+        page_entry& right = m_pages[page_idx + 1];
+        CHUNKED_VEC_ASSERT(left.count + right.count <= PAGE_SIZE && "Merged page would overflow");
+
+        relocate_elements(left.data + left.count, right.data, right.count);
+        left.count += right.count;
+        right.count = 0;
+        remove_page(page_idx + 1);
+    }
+
+    void construct_fence(size_type page_idx) { dod::construct<T>(m_fences + page_idx, m_pages[page_idx].data[0]); }
+
+    /// @brief Insert an empty page at page_idx, reusing a spare page if there is one
+    /// @note The caller must fill the page and construct its fence
+    size_type add_page(size_type page_idx)
+    {
+        CHUNKED_VEC_ASSERT(page_idx <= m_page_count && "Page index out of range");
+        if (m_page_count == m_allocated_pages)
+        {
+            ensure_page_capacity(m_allocated_pages + 1);
+            m_pages[m_allocated_pages++] = page_entry{allocate_page(), 0};
+        }
+
+        // The first spare page moves into position page_idx
+        const page_entry spare = m_pages[m_page_count];
+        std::memmove(static_cast<void*>(m_pages + page_idx + 1), m_pages + page_idx, (m_page_count - page_idx) * sizeof(page_entry));
+        relocate_elements_backward(m_fences + page_idx + 1, m_fences + page_idx, m_page_count - page_idx);
+        m_pages[page_idx] = spare;
+        ++m_page_count;
+        return page_idx;
+    }
+
+    /// @brief Remove the empty page at page_idx, keeping its memory as a spare page
+    void remove_page(size_type page_idx)
+    {
+        CHUNKED_VEC_ASSERT(m_pages[page_idx].count == 0 && "Only empty pages can be removed");
+        const page_entry removed = m_pages[page_idx];
+        dod::destruct(m_fences + page_idx);
+        relocate_elements(m_fences + page_idx, m_fences + page_idx + 1, m_page_count - page_idx - 1);
+        std::memmove(static_cast<void*>(m_pages + page_idx), m_pages + page_idx + 1, (m_page_count - page_idx - 1) * sizeof(page_entry));
+        --m_page_count;
+        m_pages[m_page_count] = removed;
+    }
+
+    /// @brief Relocate count contiguous elements from src to dst (dst <= src when the ranges overlap)
+    static void relocate_elements(T* dst, T* src, size_type count) noexcept
+    {
+        if constexpr (is_trivially_relocatable_v<T>)
+        {
+            std::memmove(static_cast<void*>(dst), static_cast<const void*>(src), count * sizeof(T));
+        }
+        else
+        {
+            for (size_type i = 0; i < count; ++i)
+            {
+                dod::construct<T>(dst + i, std::move(src[i]));
+                dod::destruct(src + i);
+            }
+        }
+    }
+
+    /// @brief Relocate count contiguous elements from src to dst (dst >= src when the ranges overlap)
+    static void relocate_elements_backward(T* dst, T* src, size_type count) noexcept
+    {
+        if constexpr (is_trivially_relocatable_v<T>)
+        {
+            std::memmove(static_cast<void*>(dst), static_cast<const void*>(src), count * sizeof(T));
+        }
+        else
+        {
+            for (size_type i = count; i > 0; --i)
+            {
+                dod::construct<T>(dst + i - 1, std::move(src[i - 1]));
+                dod::destruct(src + i - 1);
+            }
+        }
+    }
+
+    [[nodiscard]] static T* allocate_page() { return static_cast<T*>(CHUNKED_VEC_ALLOC(PAGE_SIZE * sizeof(T), safe_alignment_of<T>)); }
+
+    void copy_from(const chunked_sorted_set& other)
+    {
+        CHUNKED_VEC_ASSERT(m_size == 0 && "copy_from expects an empty container");
+        for (size_type page_idx = 0; page_idx < other.m_page_count; ++page_idx)
+        {
+            const page_entry& src = other.m_pages[page_idx];
+            add_page(page_idx);
+            page_entry& dst = m_pages[page_idx];
+            if constexpr (std::is_trivially_copyable_v<T>)
+            {
+                std::memcpy(static_cast<void*>(dst.data), src.data, src.count * sizeof(T));
+                dst.count = src.count;
+            }
+            else
+            {
+                for (; dst.count < src.count; ++dst.count)
+                {
+                    dod::construct<T>(dst.data + dst.count, src.data[dst.count]);
+                }
+            }
+            construct_fence(page_idx);
+            m_size += src.count;
+        }
+    }
+
+    void free_pages() noexcept
+    {
+        clear();
+        for (size_type page_idx = 0; page_idx < m_allocated_pages; ++page_idx)
+        {
+            CHUNKED_VEC_FREE(m_pages[page_idx].data);
+        }
+        if (m_pages)
+        {
+            CHUNKED_VEC_FREE(m_pages);
+            CHUNKED_VEC_FREE(m_fences);
+        }
+        m_pages = nullptr;
+        m_fences = nullptr;
+        m_allocated_pages = 0;
+        m_page_capacity = 0;
+    }
+
+    void ensure_page_capacity(size_type pages_needed)
+    {
+        if (pages_needed <= m_page_capacity)
+        {
+            return;
+        }
+
+        // The fence keys grow in step with the page table, so both must fit
+        constexpr size_type MAX_CAPACITY =
+            std::min(detail::max_page_table_entries<page_entry, size_type>(), detail::max_page_table_entries<T, size_type>());
+        const size_type new_page_capacity = detail::grow_page_capacity(m_page_capacity, pages_needed, MAX_CAPACITY);
+
+        auto* new_pages = static_cast<page_entry*>(CHUNKED_VEC_ALLOC(new_page_capacity * sizeof(page_entry), safe_alignment_of<page_entry>));
+        auto* new_fences = static_cast<T*>(CHUNKED_VEC_ALLOC(new_page_capacity * sizeof(T), safe_alignment_of<T>));
+        if (m_pages)
+        {
+            std::memcpy(static_cast<void*>(new_pages), m_pages, m_allocated_pages * sizeof(page_entry));
+            relocate_elements(new_fences, m_fences, m_page_count);
+            CHUNKED_VEC_FREE(m_pages);
+            CHUNKED_VEC_FREE(m_fences);
+        }
+        m_pages = new_pages;
+        m_fences = new_fences;
+        m_page_capacity = new_page_capacity;
+    }
+
+  public:
+    /// @brief Forward iterator over the keys in ascending order
+    class const_iterator
+    {
+      public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const T*;
+        using reference = const T&;
+
+        friend class chunked_sorted_set;
+
+        const_iterator() noexcept
+            : m_container(nullptr)
+            , m_page_idx(0)
+            , m_elem_idx(0)
+        {
+        }
+
+        reference operator*() const
+        {
+            CHUNKED_VEC_ASSERT(m_container && m_page_idx < m_container->m_page_count && "Iterator out of range");
+            return m_container->m_pages[m_page_idx].data[m_elem_idx];
+        }
+
+        pointer operator->() const { return &**this; }
+
+        CHUNKED_VEC_INLINE const_iterator& operator++() noexcept
+        {
+            if (++m_elem_idx == m_container->m_pages[m_page_idx].count)
+            {
+                ++m_page_idx;
+                m_elem_idx = 0;
+            }
+            return *this;
+        }
+
+        CHUNKED_VEC_INLINE const_iterator operator++(int) noexcept
+        {
+            const_iterator temp = *this;
+            ++(*this);
+            return temp;
+        }
+
+        bool operator==(const const_iterator& other) const noexcept
+        {
+            return m_container == other.m_container && m_page_idx == other.m_page_idx && m_elem_idx == other.m_elem_idx;
+        }
+        bool operator!=(const const_iterator& other) const noexcept { return !(*this == other); }
+
+      private:
+        const chunked_sorted_set* m_container;
+        size_type m_page_idx;
+        size_type m_elem_idx;
+
+        const_iterator(const chunked_sorted_set* container, size_type page_idx, size_type elem_idx) noexcept
+            : m_container(container)
+            , m_page_idx(page_idx)
+            , m_elem_idx(elem_idx)
+        {
+        }
+    };
+};
+
+} // namespace dod
@@ -3,15 +3,21 @@
 #include <algorithm>
 #include <cassert>
 #include <cstddef>
+#include <cstdint>
 #include <cstring>
 #include <initializer_list>
 #include <iterator>
 #include <limits>
+#include <memory>
 #include <new>
 #include <stdexcept>
 #include <type_traits>
 #include <utility>
 
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
 #define CHUNKED_VEC_INLINE inline
 
 // TODO (detailed desc): you could override memory allocator by defining CHUNKED_VEC_ALLOC/CHUNKED_VEC_FREE macroses
@@ -48,6 +54,51 @@ inline size_t round_up_to_alignment(size_t size, size_t alignment) noexcept { re
 #define CHUNKED_VEC_MAYBE_UNUSED(x) (void)(x)
 #endif
 
+// Prefetch hint for data that is about to be read; users can override CHUNKED_VEC_PREFETCH
+#if !defined(CHUNKED_VEC_PREFETCH)
+#if defined(__GNUC__) || defined(__clang__)
+#define CHUNKED_VEC_PREFETCH(ptr) __builtin_prefetch(ptr)
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <xmmintrin.h>
+#define CHUNKED_VEC_PREFETCH(ptr) _mm_prefetch(reinterpret_cast<const char*>(ptr), _MM_HINT_T0)
+#else
+#define CHUNKED_VEC_PREFETCH(ptr) ((void)0)
+#endif
+#endif
+
+// Opt-in iterator prefetching: when operator++ is this many elements before the end of a page it prefetches the
+// first cache lines of the next page and the page table entry after it; 0 (the default) disables it
+#if !defined(CHUNKED_VEC_ITERATOR_PREFETCH_DISTANCE)
+#define CHUNKED_VEC_ITERATOR_PREFETCH_DISTANCE 0
+#endif
+
+// Number of indices gather()/scatter() prefetch elements ahead of the current one (page table entries are
+// prefetched twice as far ahead); users can override CHUNKED_VEC_GATHER_PREFETCH_DISTANCE
+#if !defined(CHUNKED_VEC_GATHER_PREFETCH_DISTANCE)
+#define CHUNKED_VEC_GATHER_PREFETCH_DISTANCE 16
+#endif
+
+// Bulk fills and copies of trivially copyable elements that write at least this many bytes use non-temporal
+// (streaming) stores, so initializing or copying a huge vector does not evict everyone else's data from the cache.
+// Users can override CHUNKED_VEC_STREAMING_STORE_THRESHOLD; 0 disables streaming stores
+#if !defined(CHUNKED_VEC_STREAMING_STORE_THRESHOLD)
+#define CHUNKED_VEC_STREAMING_STORE_THRESHOLD (32u * 1024u * 1024u)
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define CHUNKED_VEC_HAS_STREAMING_STORES 1
+#else
+#define CHUNKED_VEC_HAS_STREAMING_STORES 0
+#endif
+
+// 64x64 -> 128-bit multiply used to divide by non-power-of-two page sizes with a reciprocal
+#if defined(__SIZEOF_INT128__) || (defined(_MSC_VER) && (defined(_M_X64) || defined(_M_ARM64)))
+#define CHUNKED_VEC_HAS_MUL_HIGH 1
+#else
+#define CHUNKED_VEC_HAS_MUL_HIGH 0
+#endif
+
 // Iterator debugging support similar to Microsoft STL
 // Users can override CHUNKED_VEC_ITERATOR_DEBUG_LEVEL to control iterator debugging
 #if !defined(CHUNKED_VEC_ITERATOR_DEBUG_LEVEL)
@@ -70,7 +121,7 @@ inline size_t round_up_to_alignment(size_t size, size_t alignment) noexcept { re
         CHUNKED_VEC_VERIFY_ITERATOR(first);                                                                                                \
         CHUNKED_VEC_VERIFY_ITERATOR(last);                                                                                                 \
         CHUNKED_VEC_ASSERT((first).m_container == (last).m_container && "Iterators from different containers");                            \
-        CHUNKED_VEC_ASSERT((first).m_index <= (last).m_index && "Invalid iterator range");                                                 \
+        CHUNKED_VEC_ASSERT((first).position() <= (last).position() && "Invalid iterator range");                                           \
     } while (0)
 #else
 #define CHUNKED_VEC_VERIFY_ITERATOR(iter) ((void)0)
@@ -100,6 +151,430 @@ template <typename U, typename... Args> static U* reconstruct(U* ptr, Args&&...
 // For types with larger natural alignment, we still use their natural alignment.
 template <typename T> inline constexpr size_t safe_alignment_of = alignof(T) < alignof(void*) ? alignof(void*) : alignof(T);
 
+/// @brief Opt-in trait for types that can be relocated with memcpy/memmove
+/// @details Relocation means "move-construct at the destination, then destroy the source".
+/// For a trivially relocatable type this pair of operations is equivalent to copying the
+/// object representation, so the container may shift such elements with memmove.
+/// Every trivially copyable type qualifies. Specialize this trait for other types that do
+/// not hold pointers into themselves (handles, std::unique_ptr wrappers, etc.):
+/// @code
+/// template <> struct dod::is_trivially_relocatable<MyHandle> : std::true_type {};
+/// @endcode
+template <typename T> struct is_trivially_relocatable : std::bool_constant<std::is_trivially_copyable_v<T>>
+{
+};
+
+// std::unique_ptr with the default deleter is a single owning pointer
+template <typename T> struct is_trivially_relocatable<std::unique_ptr<T, std::default_delete<T>>> : std::true_type
+{
+};
+
+template <typename T> inline constexpr bool is_trivially_relocatable_v = is_trivially_relocatable<T>::value;
+
+namespace detail
+{
+
+/// @brief std::type_identity (C++20): keeps a function parameter out of template argument deduction
+template <typename T> struct type_identity
+{
+    using type = T;
+};
+template <typename T> using type_identity_t = typename type_identity<T>::type;
+
+/// @brief Helper function to count trailing zeros (C++17 compatible)
+/// @param value The value to count trailing zeros for
+/// @return Number of trailing zeros, or 0 if value is 0
+[[nodiscard]] constexpr size_t count_trailing_zeros(size_t value) noexcept
+{
+    if (value == 0)
+    {
+        return 0;
+    }
+
+    size_t count = 0;
+    while ((value & 1) == 0)
+    {
+        value >>= 1;
+        ++count;
+    }
+    return count;
+}
+
+/// @brief Index of the lowest set bit without checking the precondition, for noexcept callers that loop while bits != 0
+/// @note The result is undefined for zero
+[[nodiscard]] CHUNKED_VEC_INLINE uint32_t lowest_set_bit_unchecked(uint64_t bits) noexcept
+{
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward64(&index, bits);
+    return static_cast<uint32_t>(index);
+#else
+    return static_cast<uint32_t>(__builtin_ctzll(bits));
+#endif
+}
+
+/// @brief Index of the lowest set bit (bits must not be zero)
+[[nodiscard]] CHUNKED_VEC_INLINE uint32_t lowest_set_bit(uint64_t bits)
+{
+    CHUNKED_VEC_ASSERT(bits != 0 && "lowest_set_bit requires a non-zero value");
+    return lowest_set_bit_unchecked(bits);
+}
+
+/// @brief Smallest l such that 2^l >= value
+[[nodiscard]] constexpr uint32_t ceil_log2(uint64_t value) noexcept
+{
+    uint32_t bits = 0;
+    while (bits < 64 && (uint64_t(1) << bits) < value)
+    {
+        ++bits;
+    }
+    return bits;
+}
+
+/// @brief ceil(2^exponent / divisor) by long division, for quotients that fit in 64 bits (divisor must be in [2, 2^63))
+[[nodiscard]] constexpr uint64_t ceil_pow2_div(uint32_t exponent, uint64_t divisor) noexcept
+{
+    uint64_t quotient = 0;
+    uint64_t remainder = 1;
+    for (uint32_t bit = 0; bit < exponent; ++bit)
+    {
+        remainder <<= 1;
+        quotient <<= 1;
+        if (remainder >= divisor)
+        {
+            remainder -= divisor;
+            quotient |= 1;
+        }
+    }
+    return quotient + (remainder != 0 ? 1 : 0);
+}
+
+#if CHUNKED_VEC_HAS_MUL_HIGH
+
+/// @brief High 64 bits of the 128-bit product a * b
+[[nodiscard]] CHUNKED_VEC_INLINE uint64_t mul_high(uint64_t a, uint64_t b) noexcept
+{
+#if defined(__SIZEOF_INT128__)
+    __extension__ typedef unsigned __int128 uint128; // __extension__ keeps -Wpedantic quiet
+    return static_cast<uint64_t>((static_cast<uint128>(a) * b) >> 64);
+#else
+    return __umulh(a, b);
+#endif
+}
+
+/// @brief Division by a constant that is not a power of two as one multiply-high and one shift
+/// @details Round-up method (Granlund & Montgomery): with l = ceil(log2(DIVISOR)) and m = ceil(2^(63 + l) / DIVISOR),
+/// floor(n / DIVISOR) == mul_high(n, m) >> (l - 1) for every n < 2^63. Restricting the numerator to 63 bits keeps m
+/// within 64 bits, so none of the pre-shift or add-back fix-ups compilers emit for a full 64-bit range are needed.
+/// Containers keep every element index below 2^63 (max_size() fits difference_type), so divide() does not check it;
+/// a larger numerator yields a wrong quotient rather than undefined behavior.
+template <uint64_t DIVISOR> struct reciprocal
+{
+    static_assert(DIVISOR > 1 && (DIVISOR & (DIVISOR - 1)) != 0, "Use a shift for powers of two");
+    static_assert(DIVISOR < (uint64_t(1) << 62), "Divisor is too large");
+
+    static constexpr uint32_t LOG2_CEIL = ceil_log2(DIVISOR);
+    static constexpr uint32_t SHIFT = LOG2_CEIL - 1;
+    static constexpr uint64_t MULTIPLIER = ceil_pow2_div(63 + LOG2_CEIL, DIVISOR);
+
+    [[nodiscard]] static CHUNKED_VEC_INLINE uint64_t divide(uint64_t n) noexcept
+    {
+        return mul_high(n, MULTIPLIER) >> SHIFT;
+    }
+};
+
+#endif
+
+/// @brief True if a bulk operation writing this many bytes should bypass the cache
+[[nodiscard]] CHUNKED_VEC_INLINE bool use_streaming_stores(size_t bytes) noexcept
+{
+#if CHUNKED_VEC_HAS_STREAMING_STORES
+    constexpr size_t threshold = CHUNKED_VEC_STREAMING_STORE_THRESHOLD;
+    return threshold != 0 && bytes >= threshold;
+#else
+    CHUNKED_VEC_MAYBE_UNUSED(bytes);
+    return false;
+#endif
+}
+
+#if CHUNKED_VEC_HAS_STREAMING_STORES
+
+/// @brief Bytes from dst up to the next 16-byte boundary, capped at bytes
+[[nodiscard]] CHUNKED_VEC_INLINE size_t bytes_to_stream_boundary(const void* dst, size_t bytes) noexcept
+{
+    const size_t misalignment = reinterpret_cast<uintptr_t>(dst) & 15;
+    return std::min(bytes, misalignment == 0 ? size_t(0) : 16 - misalignment);
+}
+
+/// @brief memcpy that writes the 16-byte aligned middle of dst with non-temporal stores
+/// @note Call streaming_fence() after the last streaming store of a bulk operation
+inline void stream_copy(void* dst, const void* src, size_t bytes) noexcept
+{
+    unsigned char* out = static_cast<unsigned char*>(dst);
+    const unsigned char* in = static_cast<const unsigned char*>(src);
+    const size_t head = bytes_to_stream_boundary(out, bytes);
+    std::memcpy(out, in, head);
+    out += head;
+    in += head;
+    bytes -= head;
+
+    // One cache line per iteration so the write-combining buffers are flushed as full lines
+    for (; bytes >= 64; bytes -= 64, out += 64, in += 64)
+    {
+        const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in));
+        const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + 16));
+        const __m128i c = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + 32));
+        const __m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + 48));
+        _mm_stream_si128(reinterpret_cast<__m128i*>(out), a);
+        _mm_stream_si128(reinterpret_cast<__m128i*>(out + 16), b);
+        _mm_stream_si128(reinterpret_cast<__m128i*>(out + 32), c);
+        _mm_stream_si128(reinterpret_cast<__m128i*>(out + 48), d);
+    }
+    for (; bytes >= 16; bytes -= 16, out += 16, in += 16)
+    {
+        _mm_stream_si128(reinterpret_cast<__m128i*>(out), _mm_loadu_si128(reinterpret_cast<const __m128i*>(in)));
+    }
+    std::memcpy(out, in, bytes);
+}
+
+/// @brief Fill count objects of element_size bytes with copies of element using non-temporal stores
+/// @note element_size must divide 16, so every aligned 16-byte block holds the same byte pattern
+inline void stream_fill(void* dst, const void* element, size_t element_size, size_t count)
+{
+    CHUNKED_VEC_ASSERT(element_size != 0 && 16 % element_size == 0 && "Element size must divide 16");
+    // Two blocks of the repeating pattern, so a block starting at any element offset can be read from it
+    alignas(16) unsigned char pattern[32];
+    for (size_t i = 0; i < sizeof(pattern); ++i)
+    {
+        pattern[i] = static_cast<const unsigned char*>(element)[i % element_size];
+    }
+
+    unsigned char* out = static_cast<unsigned char*>(dst);
+    size_t bytes = element_size * count;
+    const size_t head = bytes_to_stream_boundary(out, bytes);
+    std::memcpy(out, pattern, head);
+    out += head;
+    bytes -= head;
+
+    // Aligned blocks start head bytes into the pattern (modulo the element size)
+    const size_t phase = head % element_size;
+    const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pattern + phase));
+    for (; bytes >= 64; bytes -= 64, out += 64)
+    {
+        _mm_stream_si128(reinterpret_cast<__m128i*>(out), block);
+        _mm_stream_si128(reinterpret_cast<__m128i*>(out + 16), block);
+        _mm_stream_si128(reinterpret_cast<__m128i*>(out + 32), block);
+        _mm_stream_si128(reinterpret_cast<__m128i*>(out + 48), block);
+    }
+    for (; bytes >= 16; bytes -= 16, out += 16)
+    {
+        _mm_stream_si128(reinterpret_cast<__m128i*>(out), block);
+    }
+    std::memcpy(out, pattern + phase, bytes);
+}
+
+/// @brief Order the preceding non-temporal stores before any later store
+CHUNKED_VEC_INLINE void streaming_fence() noexcept { _mm_sfence(); }
+
+#else
+
+inline void stream_copy(void* dst, const void* src, size_t bytes) noexcept { std::memcpy(dst, src, bytes); }
+
+inline void stream_fill(void* dst, const void* element, size_t element_size, size_t count)
+{
+    unsigned char* out = static_cast<unsigned char*>(dst);
+    for (size_t i = 0; i < count; ++i, out += element_size)
+    {
+        std::memcpy(out, element, element_size);
+    }
+}
+
+CHUNKED_VEC_INLINE void streaming_fence() noexcept {}
+
+#endif
+
+/// @brief Page geometry shared by all chunked containers
+/// @tparam PAGE_SIZE The number of elements per page
+template <size_t PAGE_SIZE> struct page_layout
+{
+    static_assert(PAGE_SIZE > 0, "PAGE_SIZE must be greater than 0");
+
+    static constexpr bool IS_POWER_OF_TWO = (PAGE_SIZE & (PAGE_SIZE - 1)) == 0;
+
+    // Compile-time computed page size bits for power-of-2 optimization
+    static constexpr size_t PAGE_SIZE_BITS = count_trailing_zeros(PAGE_SIZE);
+
+    /// @brief Calculate page and element indices from linear position
+    /// @param pos Linear position in the container
+    /// @return Pair of (page_index, element_index_within_page)
+    template <typename SizeType> [[nodiscard]] static CHUNKED_VEC_INLINE std::pair<SizeType, SizeType> split(SizeType pos) noexcept
+    {
+        // Optimize for power-of-2 page sizes using bit operations
+        if constexpr (IS_POWER_OF_TWO)
+        {
+            // PAGE_SIZE is a power of 2, use fast bit operations
+            return {static_cast<SizeType>(pos >> PAGE_SIZE_BITS), static_cast<SizeType>(pos & (PAGE_SIZE - 1))};
+        }
+#if CHUNKED_VEC_HAS_MUL_HIGH
+        else if constexpr (sizeof(SizeType) == sizeof(uint64_t))
+        {
+            // Multiply by the reciprocal; no element index comes anywhere near 2^63
+            const SizeType page_idx = static_cast<SizeType>(reciprocal<PAGE_SIZE>::divide(static_cast<uint64_t>(pos)));
+            return {page_idx, static_cast<SizeType>(pos - page_idx * PAGE_SIZE)};
+        }
+#endif
+        else
+        {
+            // Use regular division and modulo for non-power-of-2 sizes
+            return {static_cast<SizeType>(pos / PAGE_SIZE), static_cast<SizeType>(pos % PAGE_SIZE)};
+        }
+    }
+
+    /// @brief Calculate the number of pages needed for a given element count
+    template <typename SizeType> [[nodiscard]] static CHUNKED_VEC_INLINE SizeType pages_needed(SizeType element_count) noexcept
+    {
+        if (element_count == 0)
+        {
+            return 0;
+        }
+        return static_cast<SizeType>((element_count + PAGE_SIZE - 1) / PAGE_SIZE);
+    }
+};
+
+/// @brief Largest page table, in entries, that a container can allocate and index with SizeType
+template <typename Entry, typename SizeType> [[nodiscard]] constexpr SizeType max_page_table_entries() noexcept
+{
+    // Largest valid object size divided by entry size, leaving room for allocation headers and alignment
+    constexpr size_t SAFETY_MARGIN = 16;
+    constexpr size_t MAX_ENTRIES = static_cast<size_t>(std::numeric_limits<std::ptrdiff_t>::max()) / sizeof(Entry);
+    constexpr size_t MAX_TABLE_ENTRIES = MAX_ENTRIES > SAFETY_MARGIN ? MAX_ENTRIES - SAFETY_MARGIN : MAX_ENTRIES;
+    return static_cast<SizeType>(std::min<size_t>(MAX_TABLE_ENTRIES, std::numeric_limits<SizeType>::max()));
+}
+
+/// @brief Calculate geometric growth similar to std::vector, but for page tables
+/// @param old_capacity Current page table capacity
+/// @param pages_needed Minimum number of entries required
+/// @param max_capacity Largest capacity the container supports
+/// @return New page table capacity using geometric growth (1.5x), clamped to max_capacity
+template <typename SizeType>
+[[nodiscard]] CHUNKED_VEC_INLINE SizeType grow_page_capacity(SizeType old_capacity, SizeType pages_needed, SizeType max_capacity)
+{
+    CHUNKED_VEC_ASSERT(pages_needed <= max_capacity && "Page table would exceed its maximum size");
+
+    // Handle overflow case: if old_capacity > max - old_capacity/2
+    if (old_capacity > max_capacity - old_capacity / 2)
+    {
+        return max_capacity; // geometric growth would overflow
+    }
+
+    // Calculate geometric growth: old_capacity * 1.5 (3/2 growth factor)
+    const SizeType geometric = old_capacity + old_capacity / 2;
+    return geometric < pages_needed ? pages_needed : geometric;
+}
+
+/// @brief Move a page table into a new allocation that holds at least pages_needed entries
+/// @details The first used entries are copied over; entries past them are left for the caller to initialize.
+/// Does nothing when the table is already large enough.
+template <typename Entry, typename SizeType>
+CHUNKED_VEC_INLINE void grow_page_table(Entry*& table, SizeType& capacity, SizeType used, SizeType pages_needed,
+                                        SizeType max_capacity = max_page_table_entries<Entry, SizeType>())
+{
+    if (pages_needed <= capacity)
+    {
+        return;
+    }
+
+    const SizeType new_capacity = grow_page_capacity(capacity, pages_needed, max_capacity);
+    Entry* new_table = static_cast<Entry*>(CHUNKED_VEC_ALLOC(static_cast<size_t>(new_capacity) * sizeof(Entry), safe_alignment_of<Entry>));
+    if (used > 0)
+    {
+        std::memcpy(static_cast<void*>(new_table), static_cast<const void*>(table), static_cast<size_t>(used) * sizeof(Entry));
+    }
+    if (table)
+    {
+        CHUNKED_VEC_FREE(table);
+    }
+    table = new_table;
+    capacity = new_capacity;
+}
+
+/// @brief Storage a container keeps inside itself: a one-entry page table and a page of INLINE_CAPACITY elements
+template <typename T, size_t INLINE_CAPACITY> struct inline_page_storage
+{
+    T* page_table[1];
+    alignas(safe_alignment_of<T>) unsigned char elements[INLINE_CAPACITY * sizeof(T)];
+};
+
+/// @brief No inline storage; the container derives from this empty base so it costs no space
+template <typename T> struct inline_page_storage<T, 0>
+{
+};
+
+/// @brief Capacity of page 0, kept only by containers whose first page can be smaller than PAGE_SIZE
+template <typename SizeType, size_t PAGE_SIZE, bool SMALL_FIRST_PAGE> struct first_page_capacity_storage
+{
+    SizeType m_first_page_capacity = static_cast<SizeType>(PAGE_SIZE); // Below PAGE_SIZE only while page 0 is a small first page
+};
+
+/// @brief Page 0 is always a full page; the capacity is PAGE_SIZE and costs no space
+template <typename SizeType, size_t PAGE_SIZE> struct first_page_capacity_storage<SizeType, PAGE_SIZE, false>
+{
+};
+
+} // namespace detail
+
+/// @brief Controls what assign() does with allocated pages that are not needed for the new contents
+enum class page_release_policy
+{
+    keep,          ///< Keep every allocated page for later reuse (std::vector-like behavior)
+    release_excess ///< Free pages beyond those needed to hold the new contents
+};
+
+/// @brief Order in which gather() and scatter() visit a batch of indices
+enum class batch_order
+{
+    as_given,     ///< Visit indices in batch order, prefetching page table entries and elements ahead
+    group_by_page ///< Bucket the batch by page first (stable O(n + pages) counting sort), then visit page by page
+};
+
+/// @brief A contiguous run of elements inside a single page
+/// @details Segments never cross page boundaries, so data[0, size) can be handed directly to SIMD kernels.
+/// @tparam T Element type (const-qualified for read-only segments)
+template <typename T> struct page_segment
+{
+    T* data;
+    size_t size;
+
+    [[nodiscard]] CHUNKED_VEC_INLINE T* begin() const noexcept { return data; }
+    [[nodiscard]] CHUNKED_VEC_INLINE T* end() const noexcept { return data + size; }
+    [[nodiscard]] CHUNKED_VEC_INLINE bool empty() const noexcept { return size == 0; }
+    [[nodiscard]] CHUNKED_VEC_INLINE T& operator[](size_t idx) const
+    {
+        CHUNKED_VEC_ASSERT(idx < size && "Index out of range");
+        return data[idx];
+    }
+};
+
+/// @brief Number of elements per page for pages of at most page_bytes bytes
+/// @details Rounds down to a power of two, which indexes with a shift and a mask, unless that would leave more than
+/// an eighth of the byte budget unused (e.g. 48-byte records in 64 KB: 1024 elements fill only 75%). Then the exact
+/// fit is used and indexing divides by a compile-time reciprocal. Elements larger than the budget get one per page.
+template <typename T> [[nodiscard]] constexpr size_t page_size_for_bytes(size_t page_bytes) noexcept
+{
+    const size_t fit = page_bytes / sizeof(T);
+    if (fit <= 1)
+    {
+        return 1;
+    }
+
+    size_t power_of_two = 1;
+    while (power_of_two <= fit / 2)
+    {
+        power_of_two *= 2;
+    }
+    return power_of_two * 8 >= fit * 7 ? power_of_two : fit;
+}
+
 } // namespace dod
 
 namespace dod
@@ -119,6 +594,16 @@ namespace dod
 ///
 /// @tparam T The type of elements stored in the vector
 /// @tparam PAGE_SIZE The number of elements per page (default: 1024)
+/// @tparam MIN_FIRST_PAGE_SIZE Initial capacity of the first page (default: PAGE_SIZE). When smaller than PAGE_SIZE,
+/// the first page starts at this many elements and doubles until it is promoted to a full page, so a vector holding
+/// a handful of elements costs tens of bytes instead of a whole page. Growing the small first page moves its
+/// elements (like std::vector); once it is full-sized the container behaves exactly as with the default.
+/// @tparam INLINE_CAPACITY Number of elements stored inside the container object itself (default: 0). A non-zero
+/// value makes the first page an inline buffer with a one-entry inline page table, so a vector that never exceeds
+/// INLINE_CAPACITY elements performs no heap allocation. Past that the first page moves to the heap and grows like a
+/// small first page; indexing is the same paged lookup either way. Moving such a vector moves its inline elements.
+/// @tparam SizeType Unsigned type of sizes, indices and page counts (default: size_t). uint32_t shrinks the container
+/// and its iterators; max_size() is then capped so that every element index fits.
 ///
 /// Key features:
 /// - O(1) random access via operator[] and at()
@@ -127,7 +612,10 @@ namespace dod
 /// - Iterator debugging support (similar to MSVC STL)
 /// - Optimized operations for trivial types
 /// - Custom allocator support via macros
-template <typename T, size_t PAGE_SIZE = 1024> class chunked_vector
+template <typename T, size_t PAGE_SIZE = 1024, size_t MIN_FIRST_PAGE_SIZE = PAGE_SIZE, size_t INLINE_CAPACITY = 0,
+          typename SizeType = std::size_t>
+class chunked_vector : private detail::inline_page_storage<T, INLINE_CAPACITY>,
+                       private detail::first_page_capacity_storage<SizeType, PAGE_SIZE, (MIN_FIRST_PAGE_SIZE < PAGE_SIZE || INLINE_CAPACITY > 0)>
 {
   public:
     using value_type = T;
@@ -135,10 +623,14 @@ template <typename T, size_t PAGE_SIZE = 1024> class chunked_vector
     using const_reference = const T&;
     using pointer = T*;
     using const_pointer = const T*;
-    using size_type = std::size_t;
+    using size_type = SizeType;
     using difference_type = std::ptrdiff_t;
 
     static_assert(PAGE_SIZE > 0, "PAGE_SIZE must be greater than 0");
+    static_assert(std::is_unsigned_v<SizeType>, "SizeType must be an unsigned integer type");
+    static_assert(PAGE_SIZE <= std::numeric_limits<SizeType>::max(), "PAGE_SIZE must be representable in SizeType");
+    static_assert(MIN_FIRST_PAGE_SIZE > 0 && MIN_FIRST_PAGE_SIZE <= PAGE_SIZE, "MIN_FIRST_PAGE_SIZE must be in [1, PAGE_SIZE]");
+    static_assert(INLINE_CAPACITY < PAGE_SIZE, "INLINE_CAPACITY must be smaller than PAGE_SIZE");
 
     template <typename ValueType> class basic_iterator;
     using iterator = basic_iterator<T>;
@@ -219,6 +711,8 @@ template <typename T, size_t PAGE_SIZE = 1024> class chunked_vector
         , m_iterator_list(nullptr)
 #endif
     {
+        set_first_page_capacity(other.first_page_capacity());
+        adopt_inline_storage(other);
         other.m_pages = nullptr;
         other.m_page_count = 0;
         other.m_page_capacity = 0;
@@ -239,13 +733,23 @@ template <typename T, size_t PAGE_SIZE = 1024> class chunked_vector
     }
 
     chunked_vector& operator=(const chunked_vector& other)
+    {
+        assign(other, page_release_policy::keep);
+        return *this;
+    }
+
+    /// @brief Replace the contents with a copy of another container, reusing already allocated pages
+    /// @param other Container to copy from
+    /// @param policy What to do with pages that are not needed to hold the copied elements
+    /// @note Live elements are copy-assigned in place, the remainder is copy-constructed page by page
+    ///       into reserved pages, so no per-element capacity checks are performed
+    void assign(const chunked_vector& other, page_release_policy policy)
     {
         if (this == &other)
         {
-            return *this;
+            return;
         }
 
-        clear();
 #if CHUNKED_VEC_ITERATOR_DEBUG_LEVEL > 0
         _invalidate_all_iterators();
 #endif
@@ -258,22 +762,40 @@ template <typename T, size_t PAGE_SIZE = 1024> class chunked_vector
         }
         else
         {
-            // For non-trivial types, use page-by-page copy to avoid redundant index calculations
-            size_type remaining_elements = other.m_size;
-            for (size_type page_idx = 0; page_idx < other.m_page_count && remaining_elements > 0; ++page_idx)
+            // Copy-assign over the elements that are alive in both containers
+            const size_type common_size = std::min(m_size, other.m_size);
+            size_type remaining_elements = common_size;
+            for (size_type page_idx = 0; remaining_elements > 0; ++page_idx)
             {
-                size_type elements_in_this_page = std::min(remaining_elements, PAGE_SIZE);
+                size_type elements_in_this_page = std::min<size_type>(remaining_elements, PAGE_SIZE);
+                T* dst_page = m_pages[page_idx];
                 const T* src_page = other.m_pages[page_idx];
 
                 for (size_type elem_idx = 0; elem_idx < elements_in_this_page; ++elem_idx)
                 {
-                    push_back(src_page[elem_idx]);
+                    dst_page[elem_idx] = src_page[elem_idx];
                 }
 
                 remaining_elements -= elements_in_this_page;
             }
+
+            if (m_size > other.m_size)
+            {
+                // Destroy the surplus tail
+                shrink_to_size(other.m_size);
+                m_size = other.m_size;
+            }
+            else
+            {
+                // Copy-construct the rest into already reserved pages
+                bulk_copy_construct_from(other, m_size, other.m_size);
+            }
+        }
+
+        if (policy == page_release_policy::release_excess)
+        {
+            shrink_to_fit();
         }
-        return *this;
     }
 
     chunked_vector& operator=(chunked_vector&& other) noexcept
@@ -293,6 +815,8 @@ template <typename T, size_t PAGE_SIZE = 1024> class chunked_vector
         m_page_count = other.m_page_count;
         m_page_capacity = other.m_page_capacity;
         m_size = other.m_size;
+        set_first_page_capacity(other.first_page_capacity());
+        adopt_inline_storage(other);
 
         other.m_pages = nullptr;
         other.m_page_count = 0;
@@ -387,18 +911,80 @@ template <typename T, size_t PAGE_SIZE = 1024> class chunked_vector
     [[nodiscard]] CHUNKED_VEC_INLINE const_iterator end() const noexcept { return const_iterator(this, m_size); }
     [[nodiscard]] CHUNKED_VEC_INLINE const_iterator cend() const noexcept { return const_iterator(this, m_size); }
 
+    /// @brief Index of the element an iterator points to (size() for end())
+    /// @note Time complexity: O(1), computed from the iterator alone
+    [[nodiscard]] CHUNKED_VEC_INLINE size_type index_of(const_iterator pos) const
+    {
+        CHUNKED_VEC_ASSERT((!pos.m_container || pos.m_container == this) && "Iterator from different container");
+        return pos.position();
+    }
+
     [[nodiscard]] CHUNKED_VEC_INLINE bool empty() const noexcept { return m_size == 0; }
     [[nodiscard]] CHUNKED_VEC_INLINE size_type size() const noexcept { return m_size; }
-    [[nodiscard]] CHUNKED_VEC_INLINE size_type capacity() const noexcept { return m_page_count * PAGE_SIZE; }
-    [[nodiscard]] CHUNKED_VEC_INLINE size_type max_size() const noexcept { return max_page_capacity() * PAGE_SIZE; }
+    [[nodiscard]] CHUNKED_VEC_INLINE size_type capacity() const noexcept
+    {
+        return m_page_count == 0 ? 0 : (m_page_count - 1) * PAGE_SIZE + first_page_capacity();
+    }
+    /// @note Capped so that neither the page table size nor any element index overflows size_type
+    [[nodiscard]] CHUNKED_VEC_INLINE size_type max_size() const noexcept { return static_cast<size_type>(max_page_capacity() * PAGE_SIZE); }
+
+    /// @brief Number of pages that hold elements
+    [[nodiscard]] CHUNKED_VEC_INLINE size_type segment_count() const noexcept { return calculate_pages_needed(m_size); }
+
+    /// @brief Contiguous elements stored in page segment_idx
+    /// @note Every segment holds PAGE_SIZE elements except possibly the last one
+    [[nodiscard]] CHUNKED_VEC_INLINE page_segment<T> segment(size_type segment_idx)
+    {
+        CHUNKED_VEC_ASSERT(segment_idx < segment_count() && "Segment index out of range");
+        return {m_pages[segment_idx], elements_in_segment(segment_idx)};
+    }
+
+    [[nodiscard]] CHUNKED_VEC_INLINE page_segment<const T> segment(size_type segment_idx) const
+    {
+        CHUNKED_VEC_ASSERT(segment_idx < segment_count() && "Segment index out of range");
+        return {m_pages[segment_idx], elements_in_segment(segment_idx)};
+    }
+
+    /// @brief Copy the elements at indices[0, count) to out[0, count)
+    /// @details A random operator[] pays two dependent cache misses: the page table entry, then the element.
+    /// The batch prefetches page table entries 2 * CHUNKED_VEC_GATHER_PREFETCH_DISTANCE indices ahead and
+    /// elements CHUNKED_VEC_GATHER_PREFETCH_DISTANCE indices ahead, so the misses of many lookups overlap.
+    /// @param order batch_order::group_by_page trades a counting sort for page-local access on large batches
+    template <typename IndexType>
+    void gather(const IndexType* indices, size_type count, T* out, batch_order order = batch_order::as_given) const
+    {
+        for_each_in_batch(indices, count, order, [out](size_type batch_pos, const T& element) { out[batch_pos] = element; });
+    }
+
+    /// @brief Assign values[i] to the element at indices[i] for every i in [0, count)
+    /// @note With duplicate indices the value that comes last in the batch wins, in either order
+    template <typename IndexType>
+    void scatter(const IndexType* indices, size_type count, const T* values, batch_order order = batch_order::as_given)
+    {
+        for_each_in_batch(indices, count, order, [values](size_type batch_pos, T& element) { element = values[batch_pos]; });
+    }
 
     CHUNKED_VEC_INLINE void reserve(size_type new_capacity)
     {
+        CHUNKED_VEC_ASSERT(new_capacity <= max_size() && "Requested capacity exceeds max_size()");
         if (new_capacity <= capacity())
         {
             return;
         }
 
+        if constexpr (SMALL_FIRST_PAGE)
+        {
+            if (m_page_count <= 1)
+            {
+                // Grow the first page while it can still hold everything, otherwise promote it to a full page
+                grow_first_page(std::min<size_type>(new_capacity, PAGE_SIZE));
+                if (new_capacity <= PAGE_SIZE)
+                {
+                    return;
+                }
+            }
+        }
+
         size_type pages_needed = calculate_pages_needed(new_capacity);
         ensure_page_capacity(pages_needed);
 
@@ -417,6 +1003,14 @@ template <typename T, size_t PAGE_SIZE = 1024> class chunked_vector
             deallocate_page(i);
         }
         m_page_count = pages_needed;
+
+        if constexpr (SMALL_FIRST_PAGE)
+        {
+            if (m_page_count == 1 && small_page_capacity_for(m_size) < first_page_capacity())
+            {
+                resize_first_page(small_page_capacity_for(m_size));
+            }
+        }
     }
 
     CHUNKED_VEC_INLINE void clear() noexcept
@@ -428,7 +1022,7 @@ template <typename T, size_t PAGE_SIZE = 1024> class chunked_vector
             size_type remaining_elements = m_size;
             for (size_type page_idx = 0; page_idx < m_page_count && remaining_elements > 0; ++page_idx)
             {
-                size_type elements_in_this_page = std::min(remaining_elements, PAGE_SIZE);
+                size_type elements_in_this_page = std::min<size_type>(remaining_elements, PAGE_SIZE);
                 T* page = m_pages[page_idx];
 
                 for (size_type elem_idx = 0; elem_idx < elements_in_this_page; ++elem_idx)
@@ -466,6 +1060,13 @@ template <typename T, size_t PAGE_SIZE = 1024> class chunked_vector
     /// @note May allocate a new page if current page is full
     template <typename... Args> CHUNKED_VEC_INLINE reference emplace_back(Args&&... args)
     {
+        if constexpr (SMALL_FIRST_PAGE)
+        {
+            if (m_size < PAGE_SIZE && (m_page_count == 0 || m_size == first_page_capacity()))
+            {
+                return emplace_back_growing_first_page(std::forward<Args>(args)...);
+            }
+        }
         ensure_capacity_for_one_more();
 
         auto [page_idx, elem_idx] = get_page_and_element_indices(m_size);
@@ -530,42 +1131,16 @@ template <typename T, size_t PAGE_SIZE = 1024> class chunked_vector
     {
         CHUNKED_VEC_VERIFY_ITERATOR(pos);
         CHUNKED_VEC_ASSERT(pos.m_container == this && "Iterator from different container");
-        CHUNKED_VEC_ASSERT(pos.m_index < m_size && "Iterator out of range");
+        CHUNKED_VEC_ASSERT(pos.position() < m_size && "Iterator out of range");
 
-        size_type erase_idx = pos.m_index;
+        size_type erase_idx = pos.position();
 
         // Destroy the element at the erase position
         auto [page_idx, elem_idx] = get_page_and_element_indices(erase_idx);
         dod::destruct(&m_pages[page_idx][elem_idx]);
 
-        // Move all elements after the erase position one position forward using page-by-page iteration
-        size_type elements_to_move = m_size - 1 - erase_idx;
-        size_type src_idx = erase_idx + 1;
-        size_type dst_idx = erase_idx;
-
-        while (elements_to_move > 0)
-        {
-            auto [src_page, src_elem] = get_page_and_element_indices(src_idx);
-            auto [dst_page, dst_elem] = get_page_and_element_indices(dst_idx);
-
-            size_type src_elements_in_page = PAGE_SIZE - src_elem;
-            size_type dst_elements_in_page = PAGE_SIZE - dst_elem;
-            size_type elements_to_move_in_batch = std::min({elements_to_move, src_elements_in_page, dst_elements_in_page});
-
-            T* src_page_ptr = m_pages[src_page];
-            T* dst_page_ptr = m_pages[dst_page];
-
-            for (size_type i = 0; i < elements_to_move_in_batch; ++i)
-            {
-                // Move construct at destination and destruct source
-                dod::construct<T>(&dst_page_ptr[dst_elem + i], std::move(src_page_ptr[src_elem + i]));
-                dod::destruct(&src_page_ptr[src_elem + i]);
-            }
-
-            src_idx += elements_to_move_in_batch;
-            dst_idx += elements_to_move_in_batch;
-            elements_to_move -= elements_to_move_in_batch;
-        }
+        // Move all elements after the erase position one position forward
+        relocate_range_backward(erase_idx + 1, erase_idx, m_size - 1 - erase_idx);
 
         --m_size;
 #if CHUNKED_VEC_ITERATOR_DEBUG_LEVEL > 0
@@ -577,15 +1152,15 @@ template <typename T, size_t PAGE_SIZE = 1024> class chunked_vector
     iterator erase(const_iterator first, const_iterator last)
     {
         CHUNKED_VEC_VERIFY_ITERATOR_RANGE(first, last);
-        CHUNKED_VEC_ASSERT(last.m_index <= m_size && "Iterator out of range");
+        CHUNKED_VEC_ASSERT(last.position() <= m_size && "Iterator out of range");
 
         if (first == last)
         {
-            return iterator(this, first.m_index);
+            return iterator(this, first.position());
         }
 
-        size_type first_idx = first.m_index;
-        size_type last_idx = last.m_index;
+        size_type first_idx = first.position();
+        size_type last_idx = last.position();
         size_type erase_count = last_idx - first_idx;
 
         // Destroy elements in the range [first, last) using page-by-page iteration
@@ -608,34 +1183,8 @@ template <typename T, size_t PAGE_SIZE = 1024> class chunked_vector
             elements_to_destroy -= elements_to_destroy_in_page;
         }
 
-        // Move elements after last to fill the gap using page-by-page iteration
-        size_type elements_to_move = m_size - last_idx;
-        size_type src_idx = last_idx;
-        size_type dst_idx = first_idx;
-
-        while (elements_to_move > 0)
-        {
-            auto [src_page, src_elem] = get_page_and_element_indices(src_idx);
-            auto [dst_page, dst_elem] = get_page_and_element_indices(dst_idx);
-
-            size_type src_elements_in_page = PAGE_SIZE - src_elem;
-            size_type dst_elements_in_page = PAGE_SIZE - dst_elem;
-            size_type elements_to_move_in_batch = std::min({elements_to_move, src_elements_in_page, dst_elements_in_page});
-
-            T* src_page_ptr = m_pages[src_page];
-            T* dst_page_ptr = m_pages[dst_page];
-
-            for (size_type i = 0; i < elements_to_move_in_batch; ++i)
-            {
-                // Move construct at destination and destruct source
-                dod::construct<T>(&dst_page_ptr[dst_elem + i], std::move(src_page_ptr[src_elem + i]));
-                dod::destruct(&src_page_ptr[src_elem + i]);
-            }
-
-            src_idx += elements_to_move_in_batch;
-            dst_idx += elements_to_move_in_batch;
-            elements_to_move -= elements_to_move_in_batch;
-        }
+        // Move elements after last to fill the gap
+        relocate_range_backward(last_idx, first_idx, m_size - last_idx);
 
         m_size -= erase_count;
 #if CHUNKED_VEC_ITERATOR_DEBUG_LEVEL > 0
@@ -648,9 +1197,9 @@ template <typename T, size_t PAGE_SIZE = 1024> class chunked_vector
     {
         CHUNKED_VEC_VERIFY_ITERATOR(pos);
         CHUNKED_VEC_ASSERT(pos.m_container == this && "Iterator from different container");
-        CHUNKED_VEC_ASSERT(pos.m_index < m_size && "Iterator out of range");
+        CHUNKED_VEC_ASSERT(pos.position() < m_size && "Iterator out of range");
 
-        size_type erase_idx = pos.m_index;
+        size_type erase_idx = pos.position();
 
         if (erase_idx == m_size - 1)
         {
@@ -666,11 +1215,19 @@ template <typename T, size_t PAGE_SIZE = 1024> class chunked_vector
         // Destroy the element to be erased
         dod::destruct(&m_pages[erase_page][erase_elem]);
 
-        // Move the last element to the erased position
-        dod::construct<T>(&m_pages[erase_page][erase_elem], std::move(m_pages[last_page][last_elem]));
+        if constexpr (is_trivially_relocatable_v<T>)
+        {
+            // Relocate the last element into the hole with a plain byte copy
+            std::memcpy(static_cast<void*>(&m_pages[erase_page][erase_elem]), &m_pages[last_page][last_elem], sizeof(T));
+        }
+        else
+        {
+            // Move the last element to the erased position
+            dod::construct<T>(&m_pages[erase_page][erase_elem], std::move(m_pages[last_page][last_elem]));
 
-        // Destroy the last element (which was moved)
-        dod::destruct(&m_pages[last_page][last_elem]);
+            // Destroy the last element (which was moved)
+            dod::destruct(&m_pages[last_page][last_elem]);
+        }
 
         --m_size;
 #if CHUNKED_VEC_ITERATOR_DEBUG_LEVEL > 0
@@ -679,38 +1236,122 @@ template <typename T, size_t PAGE_SIZE = 1024> class chunked_vector
         return iterator(this, erase_idx);
     }
 
-  private:
-    T** m_pages;
-    size_type m_page_count;
-    size_type m_page_capacity;
-    size_type m_size;
+    /// @brief Move all elements of another container to the end of this one
+    /// @param other Container to take elements from; left empty (its spare pages stay with it)
+    /// @note Time complexity: O(pages) when size() is a multiple of PAGE_SIZE - whole pages are handed
+    ///       over by pointer and no element is touched. Otherwise every element of other lands at a
+    ///       different page offset, so elements are relocated page segment by page segment.
+    /// @note Never invalidates iterators to existing elements of this container
+    void append(chunked_vector&& other)
+    {
+        CHUNKED_VEC_ASSERT(this != &other && "Cannot append a container to itself");
+        if (other.m_size == 0)
+        {
+            return;
+        }
 
-    // Constants for better readability
-    static constexpr size_type SAFETY_MARGIN = 16;
-    static constexpr size_type GROWTH_FACTOR_NUMERATOR = 3;
-    static constexpr size_type GROWTH_FACTOR_DENOMINATOR = 2;
+#if CHUNKED_VEC_ITERATOR_DEBUG_LEVEL > 0
+        _invalidate_iterators_at_or_after(m_size);
+        other._invalidate_all_iterators();
+#endif
+
+        auto [live_pages, seam_elem] = get_page_and_element_indices(m_size);
+        const size_type other_live_pages = other.calculate_pages_needed(other.m_size);
+
+        if (seam_elem == 0 && !has_small_first_page() && !other.has_small_first_page())
+        {
+            // Page-aligned seam: splice other's live pages in front of our spare pages
+            const size_type spare_pages = m_page_count - live_pages;
+            ensure_page_capacity(m_page_count + other_live_pages);
+            std::memmove(m_pages + live_pages + other_live_pages, m_pages + live_pages, spare_pages * sizeof(T*));
+            std::memcpy(m_pages + live_pages, other.m_pages, other_live_pages * sizeof(T*));
+            m_page_count += other_live_pages;
+            m_size += other.m_size;
+            set_first_page_capacity(PAGE_SIZE);
+
+            other.detach_leading_pages(other_live_pages);
+            other.m_size = 0;
+        }
+        else
+        {
+            reserve(m_size + other.m_size);
 
-    /// @brief Helper function to count trailing zeros (C++17 compatible)
-    /// @param value The value to count trailing zeros for
-    /// @return Number of trailing zeros, or 0 if value is 0
-    [[nodiscard]] static constexpr size_type count_trailing_zeros(size_type value) noexcept
+            size_type remaining_elements = other.m_size;
+            for (size_type page_idx = 0; page_idx < other_live_pages; ++page_idx)
+            {
+                size_type elements_in_this_page = std::min<size_type>(remaining_elements, PAGE_SIZE);
+                relocate_to_back(other.m_pages[page_idx], elements_in_this_page);
+                remaining_elements -= elements_in_this_page;
+            }
+            other.m_size = 0;
+        }
+    }
+
+    /// @brief Split the container in two at the given position
+    /// @param pos Index of the first element to move out
+    /// @return A container holding elements [pos, size()); this container keeps [0, pos)
+    /// @note Time complexity: O(pages) when pos is a multiple of PAGE_SIZE - the tail pages are handed
+    ///       over by pointer. Otherwise tail elements are relocated into newly allocated pages.
+    [[nodiscard]] chunked_vector split_off(size_type pos)
     {
-        if (value == 0)
+        CHUNKED_VEC_ASSERT(pos <= m_size && "Split position out of range");
+
+        chunked_vector tail;
+        if (pos == m_size)
         {
-            return 0;
+            return tail;
         }
 
-        size_type count = 0;
-        while ((value & 1) == 0)
+#if CHUNKED_VEC_ITERATOR_DEBUG_LEVEL > 0
+        _invalidate_iterators_at_or_after(pos);
+#endif
+
+        auto [first_page, first_elem] = get_page_and_element_indices(pos);
+        const size_type live_pages = calculate_pages_needed(m_size);
+
+        if (first_elem == 0 && !has_small_first_page())
+        {
+            // Page-aligned split: hand whole pages over to the new container
+            const size_type moved_pages = live_pages - first_page;
+            tail.ensure_page_capacity(moved_pages);
+            std::memcpy(tail.m_pages, m_pages + first_page, moved_pages * sizeof(T*));
+            tail.m_page_count = moved_pages;
+            tail.m_size = m_size - pos;
+
+            // Keep our spare pages right after the remaining live pages
+            const size_type spare_pages = m_page_count - live_pages;
+            std::memmove(m_pages + first_page, m_pages + live_pages, spare_pages * sizeof(T*));
+            std::fill(m_pages + first_page + spare_pages, m_pages + m_page_count, nullptr);
+            m_page_count -= moved_pages;
+        }
+        else
         {
-            value >>= 1;
-            ++count;
+            tail.reserve(m_size - pos);
+
+            size_type current_idx = pos;
+            while (current_idx < m_size)
+            {
+                auto [page_idx, start_elem_idx] = get_page_and_element_indices(current_idx);
+                size_type elements_to_move = std::min<size_type>(m_size - current_idx, PAGE_SIZE - start_elem_idx);
+                tail.relocate_to_back(&m_pages[page_idx][start_elem_idx], elements_to_move);
+                current_idx += elements_to_move;
+            }
         }
-        return count;
+
+        m_size = pos;
+        return tail;
     }
 
-    // Compile-time computed page size bits for power-of-2 optimization
-    enum : size_type { PAGE_SIZE_BITS = count_trailing_zeros(PAGE_SIZE) };
+  private:
+    T** m_pages;
+    size_type m_page_count;
+    size_type m_page_capacity;
+    size_type m_size;
+
+    // Constants for better readability
+    static constexpr bool SMALL_FIRST_PAGE = MIN_FIRST_PAGE_SIZE < PAGE_SIZE || INLINE_CAPACITY > 0;
+
+    using layout = detail::page_layout<PAGE_SIZE>;
 
 #if CHUNKED_VEC_ITERATOR_DEBUG_LEVEL > 0
     // Forward declaration for iterator debugging
@@ -792,11 +1433,7 @@ template <typename T, size_t PAGE_SIZE = 1024> class chunked_vector
     /// @return Number of pages needed
     [[nodiscard]] CHUNKED_VEC_INLINE size_type calculate_pages_needed(size_type element_count) const noexcept
     {
-        if (element_count == 0)
-        {
-            return 0;
-        }
-        return (element_count + PAGE_SIZE - 1) / PAGE_SIZE;
+        return layout::pages_needed(element_count);
     }
 
     /// @brief Calculate page and element indices from linear position
@@ -804,55 +1441,340 @@ template <typename T, size_t PAGE_SIZE = 1024> class chunked_vector
     /// @return Pair of (page_index, element_index_within_page)
     [[nodiscard]] CHUNKED_VEC_INLINE std::pair<size_type, size_type> get_page_and_element_indices(size_type pos) const noexcept
     {
-        // Optimize for power-of-2 page sizes using bit operations
-        if constexpr ((PAGE_SIZE & (PAGE_SIZE - 1)) == 0)
+        return layout::split(pos);
+    }
+
+    /// @brief Number of elements page 0 can hold
+    [[nodiscard]] CHUNKED_VEC_INLINE size_type first_page_capacity() const noexcept
+    {
+        if constexpr (SMALL_FIRST_PAGE)
         {
-            // PAGE_SIZE is a power of 2, use fast bit operations
-            return {pos >> PAGE_SIZE_BITS, pos & (PAGE_SIZE - 1)};
+            return this->m_first_page_capacity;
         }
         else
         {
-            // Use regular division and modulo for non-power-of-2 sizes
-            return {pos / PAGE_SIZE, pos % PAGE_SIZE};
+            return PAGE_SIZE;
         }
     }
 
-    /// @brief Get the maximum number of pages that can be allocated
-    [[nodiscard]] CHUNKED_VEC_INLINE size_type max_page_capacity() const noexcept
+    /// @brief Record the capacity of page 0; a no-op unless the first page can be small
+    CHUNKED_VEC_INLINE void set_first_page_capacity(size_type new_capacity) noexcept
+    {
+        if constexpr (SMALL_FIRST_PAGE)
+        {
+            this->m_first_page_capacity = new_capacity;
+        }
+        else
+        {
+            (void)new_capacity;
+        }
+    }
+
+    /// @brief Number of elements the given allocated page can hold
+    [[nodiscard]] CHUNKED_VEC_INLINE size_type page_capacity(size_type page_idx) const noexcept
+    {
+        return page_idx == 0 ? first_page_capacity() : PAGE_SIZE;
+    }
+
+    /// @brief True while page 0 is a small first page that has not been promoted to a full page yet
+    [[nodiscard]] CHUNKED_VEC_INLINE bool has_small_first_page() const noexcept
+    {
+        return SMALL_FIRST_PAGE && m_page_count > 0 && first_page_capacity() < PAGE_SIZE;
+    }
+
+    /// @brief Capacity a small first page needs for count elements: the inline buffer while count fits in it, otherwise
+    /// MIN_FIRST_PAGE_SIZE doubled as often as needed, capped at PAGE_SIZE
+    [[nodiscard]] static constexpr size_type small_page_capacity_for(size_type count) noexcept
+    {
+        if (count <= INLINE_CAPACITY)
+        {
+            return INLINE_CAPACITY;
+        }
+        size_type elements = MIN_FIRST_PAGE_SIZE;
+        while (elements < count)
+        {
+            elements = elements > PAGE_SIZE / 2 ? PAGE_SIZE : elements * 2;
+        }
+        return elements;
+    }
+
+    /// @brief Make page 0 hold at least required elements (required <= PAGE_SIZE)
+    /// @note Only valid while the container has at most one page
+    void grow_first_page(size_type required)
+    {
+        const size_type new_capacity = small_page_capacity_for(required);
+        if (m_page_count == 0 || new_capacity > first_page_capacity())
+        {
+            resize_first_page(new_capacity);
+        }
+    }
+
+    /// @brief Reallocate page 0 with room for new_capacity elements and relocate its elements
+    /// @note Moves the elements, so it invalidates pointers and iterators to them
+    void resize_first_page(size_type new_capacity) { replace_first_page(allocate_first_page(new_capacity), new_capacity); }
+
+    /// @brief Allocate storage for a new page 0: the inline buffer if new_capacity fits in it, otherwise the heap
+    [[nodiscard]] T* allocate_first_page(size_type new_capacity)
+    {
+        CHUNKED_VEC_ASSERT(m_page_count <= 1 && m_size <= new_capacity && "Only a lone first page can be resized");
+        ensure_page_capacity(1);
+        return new_capacity <= INLINE_CAPACITY ? inline_elements()
+                                               : static_cast<T*>(CHUNKED_VEC_ALLOC(new_capacity * sizeof(T), safe_alignment_of<T>));
+    }
+
+    /// @brief Relocate the elements of page 0 into new_page, free the old page and make new_page page 0
+    void replace_first_page(T* new_page, size_type new_capacity)
+    {
+        if (m_page_count == 1)
+        {
+            CHUNKED_VEC_ASSERT(new_page != m_pages[0] && "The inline page is never resized in place");
+            relocate_elements(new_page, m_pages[0], m_size);
+            free_page(m_pages[0]);
+        }
+        m_pages[0] = new_page;
+        m_page_count = 1;
+        set_first_page_capacity(new_capacity);
+#if CHUNKED_VEC_ITERATOR_DEBUG_LEVEL > 0
+        _invalidate_all_iterators();
+#endif
+    }
+
+    /// @brief emplace_back() into a full small first page (or into a container without pages)
+    /// @details Like std::vector reallocation, the new element is constructed in the grown page before the old elements
+    /// are relocated and the old page is freed, so args may refer to an element of this container
+    template <typename... Args> reference emplace_back_growing_first_page(Args&&... args)
+    {
+        const size_type new_capacity = small_page_capacity_for(m_size + 1);
+        T* new_page = allocate_first_page(new_capacity);
+
+        // Give the new page back if the element's constructor throws
+        struct page_guard
+        {
+            chunked_vector* container;
+            T* page;
+            ~page_guard()
+            {
+                if (page)
+                {
+                    container->free_page(page);
+                }
+            }
+        } guard{this, new_page};
+        T* ptr = dod::construct<T>(new_page + m_size, std::forward<Args>(args)...);
+        guard.page = nullptr;
+
+        replace_first_page(new_page, new_capacity);
+        ++m_size;
+        return *ptr;
+    }
+
+    [[nodiscard]] CHUNKED_VEC_INLINE T** inline_page_table() noexcept
+    {
+        if constexpr (INLINE_CAPACITY > 0)
+        {
+            return this->page_table;
+        }
+        else
+        {
+            return nullptr;
+        }
+    }
+
+    [[nodiscard]] CHUNKED_VEC_INLINE T* inline_elements() noexcept
+    {
+        if constexpr (INLINE_CAPACITY > 0)
+        {
+            return std::launder(reinterpret_cast<T*>(this->elements));
+        }
+        else
+        {
+            return nullptr;
+        }
+    }
+
+    [[nodiscard]] CHUNKED_VEC_INLINE bool uses_inline_page_table() const noexcept
+    {
+        if constexpr (INLINE_CAPACITY > 0)
+        {
+            return m_pages == this->page_table;
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    /// @brief Free a page unless it is the inline buffer
+    void free_page(T* page) noexcept
+    {
+        if (INLINE_CAPACITY == 0 || page != inline_elements())
+        {
+            CHUNKED_VEC_FREE(page);
+        }
+    }
+
+    /// @brief Finish a member-wise move from other: anything other kept inline is moved into our own inline storage
+    void adopt_inline_storage(chunked_vector& other) noexcept
+    {
+        if constexpr (INLINE_CAPACITY > 0)
+        {
+            if (m_pages == other.inline_page_table())
+            {
+                m_pages = inline_page_table();
+                m_pages[0] = other.m_pages[0];
+            }
+            if (m_page_count > 0 && m_pages[0] == other.inline_elements())
+            {
+                relocate_elements(inline_elements(), m_pages[0], m_size);
+                m_pages[0] = inline_elements();
+            }
+        }
+    }
+
+    [[nodiscard]] CHUNKED_VEC_INLINE size_type elements_in_segment(size_type segment_idx) const noexcept
+    {
+        const size_type page_start = segment_idx * PAGE_SIZE;
+        return std::min<size_type>(m_size - page_start, PAGE_SIZE);
+    }
+
+    /// @brief Element index and its position in the gather/scatter batch
+    struct batch_entry
+    {
+        size_type index;
+        size_type batch_pos;
+    };
+
+    /// @brief Scratch array of a batch, freed on scope exit so an assert thrown mid-batch does not leak it
+    template <typename U> struct batch_buffer
+    {
+        U* ptr;
+
+        explicit batch_buffer(size_type count)
+            : ptr(static_cast<U*>(CHUNKED_VEC_ALLOC(count * sizeof(U), safe_alignment_of<U>)))
+        {
+        }
+        ~batch_buffer() { CHUNKED_VEC_FREE(ptr); }
+
+        batch_buffer(const batch_buffer&) = delete;
+        batch_buffer& operator=(const batch_buffer&) = delete;
+    };
+
+    /// @brief Read indices[batch_pos], checking it before anything reads the page table with it
+    template <typename IndexType>
+    [[nodiscard]] CHUNKED_VEC_INLINE size_type batch_index(const IndexType* indices, size_type batch_pos) const
+    {
+        const size_type index = static_cast<size_type>(indices[batch_pos]);
+        CHUNKED_VEC_ASSERT(index < m_size && "Index out of range");
+        return index;
+    }
+
+    /// @brief Call fn(batch_pos, element) for every index of the batch
+    template <typename IndexType, typename Fn> void for_each_in_batch(const IndexType* indices, size_type count, batch_order order, Fn&& fn)
+    {
+        for_each_in_batch_impl(*this, indices, count, order, fn);
+    }
+
+    template <typename IndexType, typename Fn>
+    void for_each_in_batch(const IndexType* indices, size_type count, batch_order order, Fn&& fn) const
     {
-        // Maximum size_type value divided by pointer size, with safety margin
-        constexpr size_type MAX_POINTERS = std::numeric_limits<size_type>::max() / sizeof(T*);
-        // Leave room for allocation headers and alignment
-        return MAX_POINTERS > SAFETY_MARGIN ? MAX_POINTERS - SAFETY_MARGIN : MAX_POINTERS;
+        for_each_in_batch_impl(*this, indices, count, order, fn);
     }
 
-    /// @brief Calculate geometric growth similar to std::vector, but for pages
-    /// @param pages_needed Minimum number of pages required
-    /// @return New page capacity using geometric growth (1.5x)
-    [[nodiscard]] CHUNKED_VEC_INLINE size_type calculate_page_growth(size_type pages_needed) const
+    /// @brief Shared body of both for_each_in_batch overloads; Self is const for the const overload so fn gets const elements
+    template <typename Self, typename IndexType, typename Fn>
+    static void for_each_in_batch_impl(Self& self, const IndexType* indices, size_type count, batch_order order, Fn& fn)
     {
-        const size_type old_capacity = m_page_capacity;
-        const size_type max_capacity = max_page_capacity();
+        using element_reference = std::conditional_t<std::is_const_v<Self>, const T&, T&>;
 
-        // Handle overflow case: if old_capacity > max - old_capacity/2
-        if (old_capacity > max_capacity - old_capacity / GROWTH_FACTOR_DENOMINATOR)
+        if (order == batch_order::as_given || count < 2)
         {
-            return max_capacity; // geometric growth would overflow
+            visit_batch(self, indices, count, fn);
+            return;
         }
 
-        // Calculate geometric growth: old_capacity * 1.5 (3/2 growth factor)
-        const size_type geometric = old_capacity + old_capacity / GROWTH_FACTOR_DENOMINATOR;
+        batch_buffer<batch_entry> entries(count);
+        {
+            // Stable counting sort by page: page_offsets[p] is where the entries of page p start
+            const size_type pages = self.segment_count();
+            batch_buffer<size_type> page_offsets(pages + 1);
+            std::fill(page_offsets.ptr, page_offsets.ptr + pages + 1, size_type(0));
+            for (size_type batch_pos = 0; batch_pos < count; ++batch_pos)
+            {
+                ++page_offsets.ptr[self.get_page_and_element_indices(self.batch_index(indices, batch_pos)).first + 1];
+            }
+            for (size_type page_idx = 0; page_idx < pages; ++page_idx)
+            {
+                page_offsets.ptr[page_idx + 1] += page_offsets.ptr[page_idx];
+            }
+            for (size_type batch_pos = 0; batch_pos < count; ++batch_pos)
+            {
+                const size_type index = static_cast<size_type>(indices[batch_pos]);
+                entries.ptr[page_offsets.ptr[self.get_page_and_element_indices(index).first]++] = batch_entry{index, batch_pos};
+            }
+        }
 
-        if (geometric < pages_needed)
+        // Entries of one page are adjacent, so the page table is walked in order and only elements need prefetching
+        constexpr size_type distance = CHUNKED_VEC_GATHER_PREFETCH_DISTANCE;
+        for (size_type i = 0; i < count; ++i)
         {
-            return pages_needed; // geometric growth would be insufficient
+            if (i + distance < count)
+            {
+                auto [page_idx, elem_idx] = self.get_page_and_element_indices(entries.ptr[i + distance].index);
+                CHUNKED_VEC_PREFETCH(self.m_pages[page_idx] + elem_idx);
+            }
+            auto [page_idx, elem_idx] = self.get_page_and_element_indices(entries.ptr[i].index);
+            fn(entries.ptr[i].batch_pos, static_cast<element_reference>(self.m_pages[page_idx][elem_idx]));
         }
+    }
 
-        return geometric; // geometric growth is sufficient
+    template <typename Self, typename IndexType, typename Fn>
+    static void visit_batch(Self& self, const IndexType* indices, size_type count, Fn& fn)
+    {
+        using element_reference = std::conditional_t<std::is_const_v<Self>, const T&, T&>;
+
+        // Every index is checked as it enters the prefetch window, before its page table entry is touched
+        constexpr size_type distance = CHUNKED_VEC_GATHER_PREFETCH_DISTANCE;
+        for (size_type batch_pos = 0; batch_pos < count; ++batch_pos)
+        {
+            // The page table entry fetched 2 * distance ago is cached by the time its element is prefetched
+            if (batch_pos + 2 * distance < count)
+            {
+                const size_type page_idx = self.get_page_and_element_indices(self.batch_index(indices, batch_pos + 2 * distance)).first;
+                CHUNKED_VEC_PREFETCH(self.m_pages + page_idx);
+            }
+            if (batch_pos + distance < count)
+            {
+                auto [page_idx, elem_idx] = self.get_page_and_element_indices(self.batch_index(indices, batch_pos + distance));
+                CHUNKED_VEC_PREFETCH(self.m_pages[page_idx] + elem_idx);
+            }
+            auto [page_idx, elem_idx] = self.get_page_and_element_indices(self.batch_index(indices, batch_pos));
+            fn(batch_pos, static_cast<element_reference>(self.m_pages[page_idx][elem_idx]));
+        }
+    }
+
+    /// @brief Get the maximum number of pages that can be allocated
+    [[nodiscard]] CHUNKED_VEC_INLINE size_type max_page_capacity() const noexcept
+    {
+        // Every element index of a full page table must be representable in size_type and difference_type
+        constexpr size_t MAX_INDEX = std::min<size_t>(std::numeric_limits<size_type>::max(), std::numeric_limits<difference_type>::max());
+        constexpr size_t MAX_INDEXED_PAGES = MAX_INDEX / PAGE_SIZE;
+        static_assert(MAX_INDEXED_PAGES * PAGE_SIZE <= static_cast<size_t>(std::numeric_limits<difference_type>::max()),
+                      "Element indices must stay within the domain of the page index reciprocal");
+        return static_cast<size_type>(std::min<size_t>(detail::max_page_table_entries<T*, size_type>(), MAX_INDEXED_PAGES));
     }
 
     CHUNKED_VEC_INLINE void ensure_capacity_for_one_more()
     {
+        CHUNKED_VEC_ASSERT(m_size < max_size() && "Container is at max_size()");
+        if constexpr (SMALL_FIRST_PAGE)
+        {
+            if (m_size < PAGE_SIZE)
+            {
+                // emplace_back() grows a full small first page itself, so there is room on page 0
+                return;
+            }
+        }
+
         size_type page_idx = m_size / PAGE_SIZE;
         if (page_idx >= m_page_count)
         {
@@ -872,28 +1794,35 @@ template <typename T, size_t PAGE_SIZE = 1024> class chunked_vector
 
         if (m_page_capacity == 0)
         {
+            if constexpr (INLINE_CAPACITY > 0)
+            {
+                if (pages_needed <= 1)
+                {
+                    // A single page is tracked by the inline page table
+                    m_pages = inline_page_table();
+                    m_pages[0] = nullptr;
+                    m_page_capacity = 1;
+                    return;
+                }
+            }
             // Start with exactly what's needed, but at least 1 page
             new_page_capacity = pages_needed > 0 ? pages_needed : 1;
         }
         else
         {
             // Use geometric growth calculation similar to std::vector
-            new_page_capacity = calculate_page_growth(pages_needed);
+            new_page_capacity = detail::grow_page_capacity(m_page_capacity, pages_needed, max_page_capacity());
         }
 
         T** new_pages = static_cast<T**>(CHUNKED_VEC_ALLOC(new_page_capacity * sizeof(T*), safe_alignment_of<T*>));
 
-        for (size_type i = 0; i < m_page_count; ++i)
-        {
-            new_pages[i] = m_pages[i];
-        }
-
-        for (size_type i = m_page_count; i < new_page_capacity; ++i)
+        if (m_page_count > 0)
         {
-            new_pages[i] = nullptr;
+            std::memcpy(new_pages, m_pages, m_page_count * sizeof(T*));
         }
+        std::fill(new_pages + m_page_count, new_pages + new_page_capacity, nullptr);
 
-        if (m_pages)
+        if (m_pages && !uses_inline_page_table())
         {
             CHUNKED_VEC_FREE(m_pages);
         }
@@ -923,7 +1852,7 @@ template <typename T, size_t PAGE_SIZE = 1024> class chunked_vector
         CHUNKED_VEC_ASSERT(page_idx < m_page_count && "Page index out of range");
         if (m_pages[page_idx])
         {
-            CHUNKED_VEC_FREE(m_pages[page_idx]);
+            free_page(m_pages[page_idx]);
             m_pages[page_idx] = nullptr;
         }
     }
@@ -936,10 +1865,13 @@ template <typename T, size_t PAGE_SIZE = 1024> class chunked_vector
             {
                 if (m_pages[i])
                 {
-                    CHUNKED_VEC_FREE(m_pages[i]);
+                    free_page(m_pages[i]);
                 }
             }
-            CHUNKED_VEC_FREE(m_pages);
+            if (!uses_inline_page_table())
+            {
+                CHUNKED_VEC_FREE(m_pages);
+            }
             m_pages = nullptr;
         }
         m_page_capacity = 0;
@@ -954,6 +1886,8 @@ template <typename T, size_t PAGE_SIZE = 1024> class chunked_vector
             return;
         }
 
+        constexpr bool can_stream = std::is_trivially_copyable_v<T> && std::is_trivially_constructible_v<T> && 16 % sizeof(T) == 0;
+        const bool streaming = can_stream && detail::use_streaming_stores((end_idx - start_idx) * sizeof(T));
         size_type current_idx = start_idx;
 
         while (current_idx < end_idx)
@@ -969,9 +1903,16 @@ template <typename T, size_t PAGE_SIZE = 1024> class chunked_vector
             if constexpr (std::is_trivially_copyable_v<T> && std::is_trivially_constructible_v<T>)
             {
                 // For trivial types, use optimized bulk operations
-                for (size_type i = 0; i < elements_to_construct; ++i)
+                if (streaming)
+                {
+                    detail::stream_fill(&page_ptr[start_elem_idx], &value, sizeof(T), elements_to_construct);
+                }
+                else
                 {
-                    page_ptr[start_elem_idx + i] = value;
+                    for (size_type i = 0; i < elements_to_construct; ++i)
+                    {
+                        page_ptr[start_elem_idx + i] = value;
+                    }
                 }
             }
             else
@@ -985,6 +1926,11 @@ template <typename T, size_t PAGE_SIZE = 1024> class chunked_vector
 
             current_idx += elements_to_construct;
         }
+
+        if (streaming)
+        {
+            detail::streaming_fence();
+        }
     }
 
     // Optimized bulk construction with default constructor
@@ -995,6 +1941,8 @@ template <typename T, size_t PAGE_SIZE = 1024> class chunked_vector
             return;
         }
 
+        constexpr bool can_stream = std::is_trivially_default_constructible_v<T> && std::is_trivially_copyable_v<T> && 16 % sizeof(T) == 0;
+        const bool streaming = can_stream && detail::use_streaming_stores((end_idx - start_idx) * sizeof(T));
         size_type current_idx = start_idx;
 
         while (current_idx < end_idx)
@@ -1009,8 +1957,13 @@ template <typename T, size_t PAGE_SIZE = 1024> class chunked_vector
 
             if constexpr (std::is_trivially_default_constructible_v<T> && std::is_trivially_copyable_v<T>)
             {
+                if (streaming)
+                {
+                    const T default_value{};
+                    detail::stream_fill(&page_ptr[start_elem_idx], &default_value, sizeof(T), elements_to_construct);
+                }
                 // For trivial types, use memset if default construction is zero-initialization
-                if constexpr (std::is_arithmetic_v<T> || std::is_pointer_v<T>)
+                else if constexpr (std::is_arithmetic_v<T> || std::is_pointer_v<T>)
                 {
                     std::memset(&page_ptr[start_elem_idx], 0, elements_to_construct * sizeof(T));
                 }
@@ -1035,6 +1988,11 @@ template <typename T, size_t PAGE_SIZE = 1024> class chunked_vector
 
             current_idx += elements_to_construct;
         }
+
+        if (streaming)
+        {
+            detail::streaming_fence();
+        }
     }
 
     // Optimized bulk copy from another chunked_vector (for trivial types)
@@ -1043,24 +2001,136 @@ template <typename T, size_t PAGE_SIZE = 1024> class chunked_vector
         static_assert(std::is_trivially_copyable_v<T>, "bulk_copy_from should only be called for trivial types");
 
         // Optimize by iterating over pages first, then elements within each page
+        const bool streaming = detail::use_streaming_stores(other.m_size * sizeof(T));
         size_type remaining_elements = other.m_size;
         size_type current_idx = 0;
 
         for (size_type page_idx = 0; page_idx < other.m_page_count && remaining_elements > 0; ++page_idx)
         {
-            size_type elements_in_this_page = std::min(remaining_elements, PAGE_SIZE);
+            size_type elements_in_this_page = std::min<size_type>(remaining_elements, PAGE_SIZE);
             T* dst_page = m_pages[page_idx];
             const T* src_page = other.m_pages[page_idx];
 
             // Copy elements within this page using memcpy for better performance
-            std::memcpy(dst_page, src_page, elements_in_this_page * sizeof(T));
+            if (streaming)
+            {
+                detail::stream_copy(dst_page, src_page, elements_in_this_page * sizeof(T));
+            }
+            else
+            {
+                std::memcpy(dst_page, src_page, elements_in_this_page * sizeof(T));
+            }
 
             remaining_elements -= elements_in_this_page;
             current_idx += elements_in_this_page;
         }
+        if (streaming)
+        {
+            detail::streaming_fence();
+        }
         m_size = other.m_size;
     }
 
+    /// @brief Relocate count contiguous elements from src to dst (dst <= src when the ranges overlap)
+    /// @note Source objects are left destroyed
+    static void relocate_elements(T* dst, T* src, size_type count)
+    {
+        if constexpr (is_trivially_relocatable_v<T>)
+        {
+            // Source and destination may overlap within the same page
+            std::memmove(static_cast<void*>(dst), src, count * sizeof(T));
+        }
+        else
+        {
+            for (size_type i = 0; i < count; ++i)
+            {
+                // Move construct at destination and destruct source
+                dod::construct<T>(&dst[i], std::move(src[i]));
+                dod::destruct(&src[i]);
+            }
+        }
+    }
+
+    /// @brief Relocate count contiguous elements from src to the end of this container
+    /// @note Capacity must already be reserved
+    void relocate_to_back(T* src, size_type count)
+    {
+        while (count > 0)
+        {
+            auto [page_idx, start_elem_idx] = get_page_and_element_indices(m_size);
+            size_type elements_to_move = std::min<size_type>(count, PAGE_SIZE - start_elem_idx);
+            relocate_elements(&m_pages[page_idx][start_elem_idx], src, elements_to_move);
+
+            src += elements_to_move;
+            count -= elements_to_move;
+            m_size += elements_to_move;
+        }
+    }
+
+    /// @brief Drop ownership of the first page_count pages without freeing them
+    /// @note Remaining pages are shifted to the front of the page array
+    void detach_leading_pages(size_type page_count)
+    {
+        CHUNKED_VEC_ASSERT(page_count <= m_page_count && "Cannot detach more pages than allocated");
+        const size_type kept_pages = m_page_count - page_count;
+        std::memmove(m_pages, m_pages + page_count, kept_pages * sizeof(T*));
+        std::fill(m_pages + kept_pages, m_pages + m_page_count, nullptr);
+        m_page_count = kept_pages;
+        set_first_page_capacity(PAGE_SIZE);
+    }
+
+    /// @brief Relocate [src_idx, src_idx + count) to [dst_idx, dst_idx + count) where dst_idx < src_idx
+    /// @details Source elements are left destroyed. Works page segment by page segment; trivially
+    /// relocatable types are shifted with one memmove per segment.
+    void relocate_range_backward(size_type src_idx, size_type dst_idx, size_type count)
+    {
+        CHUNKED_VEC_ASSERT(dst_idx <= src_idx && "Backward relocation requires dst_idx <= src_idx");
+
+        while (count > 0)
+        {
+            auto [src_page, src_elem] = get_page_and_element_indices(src_idx);
+            auto [dst_page, dst_elem] = get_page_and_element_indices(dst_idx);
+
+            size_type src_elements_in_page = PAGE_SIZE - src_elem;
+            size_type dst_elements_in_page = PAGE_SIZE - dst_elem;
+            size_type elements_to_move_in_batch = std::min({count, src_elements_in_page, dst_elements_in_page});
+
+            relocate_elements(&m_pages[dst_page][dst_elem], &m_pages[src_page][src_elem], elements_to_move_in_batch);
+
+            src_idx += elements_to_move_in_batch;
+            dst_idx += elements_to_move_in_batch;
+            count -= elements_to_move_in_batch;
+        }
+    }
+
+    /// @brief Copy-construct other[start_idx, end_idx) into the same positions of this container
+    /// @note Pages must already be reserved; m_size is advanced after each completed page segment
+    void bulk_copy_construct_from(const chunked_vector& other, size_type start_idx, size_type end_idx)
+    {
+        CHUNKED_VEC_ASSERT(start_idx == m_size && "Copy construction must start at the end of the container");
+
+        size_type current_idx = start_idx;
+
+        while (current_idx < end_idx)
+        {
+            auto [page_idx, start_elem_idx] = get_page_and_element_indices(current_idx);
+            size_type elements_remaining = end_idx - current_idx;
+            size_type elements_in_page = PAGE_SIZE - start_elem_idx;
+            size_type elements_to_construct = std::min(elements_remaining, elements_in_page);
+
+            T* dst_page = m_pages[page_idx];
+            const T* src_page = other.m_pages[page_idx];
+
+            for (size_type i = start_elem_idx; i < start_elem_idx + elements_to_construct; ++i)
+            {
+                dod::construct<T>(&dst_page[i], src_page[i]);
+            }
+
+            current_idx += elements_to_construct;
+            m_size = current_idx;
+        }
+    }
+
     // Helper function to shrink container to specified size
     void shrink_to_size(size_type new_size)
     {
@@ -1101,6 +2171,17 @@ template <typename T, size_t PAGE_SIZE = 1024> class chunked_vector
     // Helper function to expand container to specified size with given value
     void expand_to_size(size_type new_size, const T& value)
     {
+        if constexpr (SMALL_FIRST_PAGE)
+        {
+            if (new_size > capacity() && has_small_first_page())
+            {
+                // Growing moves the elements of page 0, and value may be one of them
+                const T value_copy(value);
+                reserve(new_size);
+                bulk_construct_with_value(m_size, new_size, value_copy);
+                return;
+            }
+        }
         reserve(new_size);
         bulk_construct_with_value(m_size, new_size, value);
     }
@@ -1125,24 +2206,28 @@ template <typename T, size_t PAGE_SIZE = 1024> class chunked_vector
         basic_iterator() noexcept
 #if CHUNKED_VEC_ITERATOR_DEBUG_LEVEL > 0
             : iterator_node()
-            , m_container(nullptr)
+            , m_current(nullptr)
 #else
-            : m_container(nullptr)
+            : m_current(nullptr)
 #endif
-            , m_index(0)
-            , m_current_page(nullptr)
-            , m_page_element_index(0)
+            , m_page_end(nullptr)
+            , m_container(nullptr)
+            , m_page_index(0)
         {
         }
 
+        /// @note index must be at most container->size(): every such index is backed by a page, except an end()
+        /// on a page boundary, which becomes the nullptr end sentinel
         basic_iterator(const chunked_vector* container, size_type index) noexcept
 #if CHUNKED_VEC_ITERATOR_DEBUG_LEVEL > 0
             : iterator_node()
-            , m_container(container)
+            , m_current(nullptr)
 #else
-            : m_container(container)
+            : m_current(nullptr)
 #endif
-            , m_index(index)
+            , m_page_end(nullptr)
+            , m_container(container)
+            , m_page_index(0)
         {
 #if CHUNKED_VEC_ITERATOR_DEBUG_LEVEL > 0
             this->index = index;
@@ -1151,17 +2236,27 @@ template <typename T, size_t PAGE_SIZE = 1024> class chunked_vector
                 container->_adopt_iterator(this);
             }
 #endif
-            update_page_cache();
+            if (container)
+            {
+                auto [page_idx, elem_idx] = layout::split(index);
+                enter_page(page_idx);
+                if (m_current)
+                {
+                    m_current += elem_idx;
+                }
+            }
         }
 
         basic_iterator(const basic_iterator& other) noexcept
 #if CHUNKED_VEC_ITERATOR_DEBUG_LEVEL > 0
             : iterator_node()
-            , m_container(other.m_container)
+            , m_current(other.m_current)
 #else
-            : m_container(other.m_container)
+            : m_current(other.m_current)
 #endif
-            , m_index(other.m_index)
+            , m_page_end(other.m_page_end)
+            , m_container(other.m_container)
+            , m_page_index(other.m_page_index)
         {
 #if CHUNKED_VEC_ITERATOR_DEBUG_LEVEL > 0
             this->index = other.index;
@@ -1170,18 +2265,19 @@ template <typename T, size_t PAGE_SIZE = 1024> class chunked_vector
                 m_container->_adopt_iterator(this);
             }
 #endif
-            update_page_cache();
         }
 
         template <typename U, typename = std::enable_if_t<std::is_const_v<ValueType> && !std::is_const_v<U>>>
         basic_iterator(const basic_iterator<U>& other) noexcept
 #if CHUNKED_VEC_ITERATOR_DEBUG_LEVEL > 0
             : iterator_node()
-            , m_container(other.m_container)
+            , m_current(other.m_current)
 #else
-            : m_container(other.m_container)
+            : m_current(other.m_current)
 #endif
-            , m_index(other.m_index)
+            , m_page_end(other.m_page_end)
+            , m_container(other.m_container)
+            , m_page_index(other.m_page_index)
         {
 #if CHUNKED_VEC_ITERATOR_DEBUG_LEVEL > 0
             this->index = other.index;
@@ -1190,17 +2286,18 @@ template <typename T, size_t PAGE_SIZE = 1024> class chunked_vector
                 m_container->_adopt_iterator(this);
             }
 #endif
-            update_page_cache();
         }
 
         basic_iterator(basic_iterator&& other) noexcept
 #if CHUNKED_VEC_ITERATOR_DEBUG_LEVEL > 0
             : iterator_node()
-            , m_container(other.m_container)
+            , m_current(other.m_current)
 #else
-            : m_container(other.m_container)
+            : m_current(other.m_current)
 #endif
-            , m_index(other.m_index)
+            , m_page_end(other.m_page_end)
+            , m_container(other.m_container)
+            , m_page_index(other.m_page_index)
         {
 #if CHUNKED_VEC_ITERATOR_DEBUG_LEVEL > 0
             this->index = other.index;
@@ -1211,9 +2308,7 @@ template <typename T, size_t PAGE_SIZE = 1024> class chunked_vector
                 m_container->_orphan_iterator(&other);
             }
 #endif
-            other.m_container = nullptr;
-            other.m_index = 0;
-            update_page_cache();
+            other.reset();
         }
 
         ~basic_iterator()
@@ -1236,8 +2331,10 @@ template <typename T, size_t PAGE_SIZE = 1024> class chunked_vector
                     m_container->_orphan_iterator(this);
                 }
 #endif
+                m_current = other.m_current;
+                m_page_end = other.m_page_end;
                 m_container = other.m_container;
-                m_index = other.m_index;
+                m_page_index = other.m_page_index;
 #if CHUNKED_VEC_ITERATOR_DEBUG_LEVEL > 0
                 this->index = other.index;
                 if (m_container)
@@ -1245,7 +2342,6 @@ template <typename T, size_t PAGE_SIZE = 1024> class chunked_vector
                     m_container->_adopt_iterator(this);
                 }
 #endif
-                update_page_cache();
             }
             return *this;
         }
@@ -1260,8 +2356,10 @@ template <typename T, size_t PAGE_SIZE = 1024> class chunked_vector
                     m_container->_orphan_iterator(this);
                 }
 #endif
+                m_current = other.m_current;
+                m_page_end = other.m_page_end;
                 m_container = other.m_container;
-                m_index = other.m_index;
+                m_page_index = other.m_page_index;
 #if CHUNKED_VEC_ITERATOR_DEBUG_LEVEL > 0
                 this->index = other.index;
                 if (m_container)
@@ -1271,9 +2369,7 @@ template <typename T, size_t PAGE_SIZE = 1024> class chunked_vector
                     m_container->_orphan_iterator(&other);
                 }
 #endif
-                other.m_container = nullptr;
-                other.m_index = 0;
-                update_page_cache();
+                other.reset();
             }
             return *this;
         }
@@ -1283,9 +2379,8 @@ template <typename T, size_t PAGE_SIZE = 1024> class chunked_vector
 #if CHUNKED_VEC_ITERATOR_DEBUG_LEVEL > 0
             _verify_valid(__FILE__, __LINE__);
 #endif
-            CHUNKED_VEC_ASSERT(m_container && m_index < m_container->size() && "Iterator out of range");
-            CHUNKED_VEC_ASSERT(m_current_page && "Invalid page cache");
-            return m_current_page[m_page_element_index];
+            CHUNKED_VEC_ASSERT(m_container && m_current && position() < m_container->size() && "Iterator out of range");
+            return *m_current;
         }
 
         pointer operator->() const
@@ -1293,33 +2388,32 @@ template <typename T, size_t PAGE_SIZE = 1024> class chunked_vector
 #if CHUNKED_VEC_ITERATOR_DEBUG_LEVEL > 0
             _verify_valid(__FILE__, __LINE__);
 #endif
-            CHUNKED_VEC_ASSERT(m_container && m_index < m_container->size() && "Iterator out of range");
-            CHUNKED_VEC_ASSERT(m_current_page && "Invalid page cache");
-            return &m_current_page[m_page_element_index];
+            CHUNKED_VEC_ASSERT(m_container && m_current && position() < m_container->size() && "Iterator out of range");
+            return m_current;
         }
 
         CHUNKED_VEC_INLINE basic_iterator& operator++()
         {
 #if CHUNKED_VEC_ITERATOR_DEBUG_LEVEL > 0
             _verify_valid(__FILE__, __LINE__);
+            ++this->index;
 #endif
-            ++m_index;
-            ++m_page_element_index;
+            CHUNKED_VEC_ASSERT(m_current && "Cannot increment past the end");
 
-#if CHUNKED_VEC_ITERATOR_DEBUG_LEVEL > 0
-            this->index = m_index;
-#endif
+            // Common case: a pointer bump and one compare, no loads from the container
+            ++m_current;
 
-            // Only update page cache if we've crossed a page boundary or reached the end
-            if (m_page_element_index >= PAGE_SIZE)
+            if constexpr (ITERATOR_PREFETCH_DISTANCE > 0 && ITERATOR_PREFETCH_DISTANCE < PAGE_SIZE)
             {
-                update_page_cache();
+                if (m_page_end - m_current == static_cast<difference_type>(ITERATOR_PREFETCH_DISTANCE))
+                {
+                    prefetch_next_page();
+                }
             }
-            else if (m_index >= m_container->size())
+
+            if (m_current == m_page_end)
             {
-                // Reached the end, invalidate cache
-                m_current_page = nullptr;
-                m_page_element_index = 0;
+                next_page();
             }
 
             return *this;
@@ -1332,15 +2426,93 @@ template <typename T, size_t PAGE_SIZE = 1024> class chunked_vector
             return temp;
         }
 
-        bool operator==(const basic_iterator& other) const noexcept { return m_container == other.m_container && m_index == other.m_index; }
+        /// @note Every position maps to a unique element address and end() is the only position without one,
+        /// so comparing the element pointers is enough
+        bool operator==(const basic_iterator& other) const noexcept { return m_current == other.m_current; }
 
         bool operator!=(const basic_iterator& other) const noexcept { return !(*this == other); }
 
       private:
+        static constexpr size_type ITERATOR_PREFETCH_DISTANCE = CHUNKED_VEC_ITERATOR_PREFETCH_DISTANCE;
+
+        // m_page_end is always the end of the whole page, even on the last partially filled one: iteration stops
+        // there by comparing equal to end(). The container and page index are only read when crossing into the
+        // next page, which keeps iterators valid when push_back() reallocates the page table.
+        ValueType* m_current;
+        ValueType* m_page_end;
         const chunked_vector* m_container;
-        size_type m_index;
-        ValueType* m_current_page;
-        size_type m_page_element_index;
+        size_type m_page_index;
+
+        /// @brief Index of the element the iterator points to
+        /// @details Derived from the cached page end; only a small first page makes it read the container
+        [[nodiscard]] CHUNKED_VEC_INLINE size_type position() const noexcept
+        {
+            if (!m_current)
+            {
+                return m_page_index * PAGE_SIZE;
+            }
+            const size_type page_begin_distance = m_container->page_capacity(m_page_index) - static_cast<size_type>(m_page_end - m_current);
+            return m_page_index * PAGE_SIZE + page_begin_distance;
+        }
+
+        /// @brief Point at the first element of the given page, or at the end sentinel (nullptr) if it is not allocated
+        CHUNKED_VEC_INLINE void enter_page(size_type page_idx) noexcept
+        {
+            m_page_index = page_idx;
+            ValueType* page = nullptr;
+            if (page_idx < m_container->m_page_count)
+            {
+                page = m_container->m_pages[page_idx];
+            }
+            m_current = page;
+            m_page_end = page ? page + m_container->page_capacity(page_idx) : nullptr;
+        }
+
+        CHUNKED_VEC_INLINE void next_page() noexcept
+        {
+            if constexpr (SMALL_FIRST_PAGE)
+            {
+                // Nothing follows a small first page: its end is end()
+                if (m_page_index == 0 && m_container->has_small_first_page())
+                {
+                    return;
+                }
+            }
+            enter_page(m_page_index + 1);
+        }
+
+        void reset() noexcept
+        {
+            m_current = nullptr;
+            m_page_end = nullptr;
+            m_container = nullptr;
+            m_page_index = 0;
+        }
+
+        /// @brief Prefetch the elements the next ITERATOR_PREFETCH_DISTANCE steps will read from the next page,
+        /// and the page table entry of the page after it so that the next boundary does not stall on it
+        CHUNKED_VEC_INLINE void prefetch_next_page() const noexcept
+        {
+            const size_type next_page = m_page_index + 1;
+            if (next_page >= m_container->m_page_count || !m_container->m_pages[next_page])
+            {
+                return;
+            }
+            if (next_page + 1 < m_container->m_page_count)
+            {
+                CHUNKED_VEC_PREFETCH(m_container->m_pages + next_page + 1);
+            }
+
+            constexpr size_type CACHE_LINE_SIZE = 64;
+            constexpr size_type MAX_LINES = 8;
+            constexpr size_type prefetch_bytes = ITERATOR_PREFETCH_DISTANCE * sizeof(T);
+            constexpr size_type lines = std::min((prefetch_bytes + CACHE_LINE_SIZE - 1) / CACHE_LINE_SIZE, MAX_LINES);
+            const char* first = reinterpret_cast<const char*>(m_container->m_pages[next_page]);
+            for (size_type line = 0; line < lines; ++line)
+            {
+                CHUNKED_VEC_PREFETCH(first + line * CACHE_LINE_SIZE);
+            }
+        }
 
 #if CHUNKED_VEC_ITERATOR_DEBUG_LEVEL > 0
         void _verify_valid(const char* file, int line) const
@@ -1357,7 +2529,7 @@ template <typename T, size_t PAGE_SIZE = 1024> class chunked_vector
                 return;
             }
 
-            if (m_index > m_container->size())
+            if (this->index > m_container->size())
             {
                 CHUNKED_VEC_ASSERT(false && "Iterator is out of range");
                 return;
@@ -1367,29 +2539,14 @@ template <typename T, size_t PAGE_SIZE = 1024> class chunked_vector
             CHUNKED_VEC_MAYBE_UNUSED(line);
         }
 #endif
-
-        CHUNKED_VEC_INLINE void update_page_cache()
-        {
-            if (!m_container || m_index >= m_container->size())
-            {
-                m_current_page = nullptr;
-                m_page_element_index = 0;
-                return;
-            }
-
-            auto [page_idx, elem_idx] = m_container->get_page_and_element_indices(m_index);
-            m_page_element_index = elem_idx;
-
-            if constexpr (std::is_const_v<ValueType>)
-            {
-                m_current_page = m_container->m_pages[page_idx];
-            }
-            else
-            {
-                m_current_page = const_cast<chunked_vector*>(m_container)->m_pages[page_idx];
-            }
-        }
     };
 };
 
+/// @brief chunked_vector whose page size is given in bytes instead of elements
+/// @details The default page size counts elements, so a large T gets multi-megabyte pages and a small T gets tiny
+/// pages with a high per-page overhead. Budgeting bytes keeps every page close to an allocator size class
+/// (64 KB by default) or a huge page (2 MB).
+/// @tparam PAGE_BYTES Target page size in bytes; see page_size_for_bytes() for the rounding
+template <typename T, size_t PAGE_BYTES = 64 * 1024> using chunked_vector_bytes = chunked_vector<T, page_size_for_bytes<T>(PAGE_BYTES)>;
+
 } // namespace dod
\ No newline at end of file
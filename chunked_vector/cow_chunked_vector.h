@@ -0,0 +1,772 @@
+#pragma once
+
+#include "chunked_vector.h"
+
+#include <atomic>
+
+namespace dod
+{
+
+/// @brief A copy-on-write flavour of chunked_vector for cheap snapshots.
+/// @details Every page carries an atomic reference count. snapshot() (and copy construction /
+/// copy assignment) copies only the page table and bumps the reference count of every live page,
+/// so it costs O(pages) and no element is copied. The first write into a page that is shared with
+/// another container clones just that page, so memory grows only with the pages that actually change.
+///
+/// Writes must go through the mutable access path: non-const operator[], at(), front(), back(),
+/// data access through iterator (not const_iterator), and all modifiers. Each of them makes the
+/// touched page private before handing out a reference. Use the const overloads, cbegin()/cend()
+/// or as_const() for read-only traversal to avoid cloning pages.
+///
+/// Thread-safety: containers that share pages may be used concurrently from different threads
+/// (e.g. a writer and background readers holding snapshots). A single container instance is not
+/// thread-safe.
+///
+/// Transactions: begin_transaction() starts journaling. The first write to a page inside a
+/// transaction (including pages dropped by pop_back/resize/clear) keeps the original page in a
+/// journal and continues on a private copy, while pages appended during the transaction are simply
+/// new pages. rollback() puts the journaled pages back and commit() releases them, so both cost
+/// O(pages touched) rather than O(size).
+///
+/// @note A write that clones a page invalidates references, pointers and iterators into that page.
+/// @note snapshot(), copy construction and copy assignment from a container invalidate its outstanding mutable
+/// references, pointers and iterators: they still point into pages that are now shared, so writing through them
+/// would silently change the snapshot too. Re-acquire them after taking the snapshot.
+///
+/// @tparam T The type of elements stored in the vector (must be copy constructible)
+/// @tparam PAGE_SIZE The number of elements per page (default: 1024)
+template <typename T, size_t PAGE_SIZE = 1024> class cow_chunked_vector
+{
+  public:
+    using value_type = T;
+    using reference = T&;
+    using const_reference = const T&;
+    using pointer = T*;
+    using const_pointer = const T*;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+
+    template <typename ValueType> class basic_iterator;
+    using iterator = basic_iterator<T>;
+    using const_iterator = basic_iterator<const T>;
+
+    /// @brief Returns the page size used by this container
+    [[nodiscard]] static constexpr size_t page_size() { return PAGE_SIZE; }
+
+    cow_chunked_vector() noexcept
+        : m_pages(nullptr)
+        , m_page_count(0)
+        , m_page_capacity(0)
+        , m_size(0)
+        , m_tx_id(0)
+        , m_tx_size(0)
+    {
+    }
+
+    explicit cow_chunked_vector(size_type count)
+        : cow_chunked_vector()
+    {
+        resize(count);
+    }
+
+    cow_chunked_vector(size_type count, const T& value)
+        : cow_chunked_vector()
+    {
+        resize(count, value);
+    }
+
+    cow_chunked_vector(std::initializer_list<T> init)
+        : cow_chunked_vector()
+    {
+        reserve(init.size());
+        for (const auto& item : init)
+        {
+            push_back(item);
+        }
+    }
+
+    /// @brief Copy constructor - shares all pages with other (O(pages))
+    cow_chunked_vector(const cow_chunked_vector& other)
+        : cow_chunked_vector()
+    {
+        share_pages_from(other);
+    }
+
+    cow_chunked_vector(cow_chunked_vector&& other) noexcept
+        : m_pages(other.m_pages)
+        , m_page_count(other.m_page_count)
+        , m_page_capacity(other.m_page_capacity)
+        , m_size(other.m_size)
+        , m_journal(std::move(other.m_journal))
+        , m_tx_id(other.m_tx_id)
+        , m_tx_size(other.m_tx_size)
+    {
+        other.m_pages = nullptr;
+        other.m_page_count = 0;
+        other.m_page_capacity = 0;
+        other.m_size = 0;
+        other.m_tx_id = 0;
+        other.m_tx_size = 0;
+    }
+
+    ~cow_chunked_vector() { release_all_pages(); }
+
+    /// @brief Copy assignment - shares all pages with other (O(pages))
+    /// @note A pending transaction on this container is committed first
+    cow_chunked_vector& operator=(const cow_chunked_vector& other)
+    {
+        if (this != &other)
+        {
+            release_all_pages();
+            share_pages_from(other);
+        }
+        return *this;
+    }
+
+    cow_chunked_vector& operator=(cow_chunked_vector&& other) noexcept
+    {
+        if (this != &other)
+        {
+            release_all_pages();
+
+            m_pages = other.m_pages;
+            m_page_count = other.m_page_count;
+            m_page_capacity = other.m_page_capacity;
+            m_size = other.m_size;
+            m_journal = std::move(other.m_journal);
+            m_tx_id = other.m_tx_id;
+            m_tx_size = other.m_tx_size;
+
+            other.m_pages = nullptr;
+            other.m_page_count = 0;
+            other.m_page_capacity = 0;
+            other.m_size = 0;
+            other.m_tx_id = 0;
+            other.m_tx_size = 0;
+        }
+        return *this;
+    }
+
+    /// @brief Take a read-only snapshot that shares every page with this container
+    /// @note Time complexity: O(pages) - no element is copied
+    /// @warning Invalidates mutable references, pointers and iterators into this container; writes must go through
+    /// references obtained after the snapshot, which clone the shared page first
+    [[nodiscard]] cow_chunked_vector snapshot() const { return cow_chunked_vector(*this); }
+
+    /// @brief Returns a const view of the container, handy for read-only range-based loops
+    [[nodiscard]] const cow_chunked_vector& as_const() const noexcept { return *this; }
+
+    /// @brief Mutable element access - clones the page first if it is shared
+    [[nodiscard]] CHUNKED_VEC_INLINE reference operator[](size_type pos)
+    {
+        CHUNKED_VEC_ASSERT(pos < m_size && "Index out of range");
+        auto [page_idx, elem_idx] = layout::split(pos);
+        return writable_page(page_idx)[elem_idx];
+    }
+
+    [[nodiscard]] CHUNKED_VEC_INLINE const_reference operator[](size_type pos) const
+    {
+        CHUNKED_VEC_ASSERT(pos < m_size && "Index out of range");
+        auto [page_idx, elem_idx] = layout::split(pos);
+        return m_pages[page_idx][elem_idx];
+    }
+
+    [[nodiscard]] CHUNKED_VEC_INLINE reference at(size_type pos)
+    {
+        if (pos >= m_size)
+        {
+            throw std::out_of_range("cow_chunked_vector::at: index out of range");
+        }
+        return (*this)[pos];
+    }
+
+    [[nodiscard]] CHUNKED_VEC_INLINE const_reference at(size_type pos) const
+    {
+        if (pos >= m_size)
+        {
+            throw std::out_of_range("cow_chunked_vector::at: index out of range");
+        }
+        return (*this)[pos];
+    }
+
+    [[nodiscard]] CHUNKED_VEC_INLINE reference front()
+    {
+        CHUNKED_VEC_ASSERT(m_size > 0 && "Cannot access front of empty cow_chunked_vector");
+        return writable_page(0)[0];
+    }
+
+    [[nodiscard]] CHUNKED_VEC_INLINE const_reference front() const
+    {
+        CHUNKED_VEC_ASSERT(m_size > 0 && "Cannot access front of empty cow_chunked_vector");
+        return m_pages[0][0];
+    }
+
+    [[nodiscard]] CHUNKED_VEC_INLINE reference back()
+    {
+        CHUNKED_VEC_ASSERT(m_size > 0 && "Cannot access back of empty cow_chunked_vector");
+        return (*this)[m_size - 1];
+    }
+
+    [[nodiscard]] CHUNKED_VEC_INLINE const_reference back() const
+    {
+        CHUNKED_VEC_ASSERT(m_size > 0 && "Cannot access back of empty cow_chunked_vector");
+        return (*this)[m_size - 1];
+    }
+
+    /// @brief Mutable iteration makes every page it enters private
+    [[nodiscard]] CHUNKED_VEC_INLINE iterator begin() { return iterator(this, 0); }
+    [[nodiscard]] CHUNKED_VEC_INLINE const_iterator begin() const { return const_iterator(this, 0); }
+    [[nodiscard]] CHUNKED_VEC_INLINE const_iterator cbegin() const { return const_iterator(this, 0); }
+
+    [[nodiscard]] CHUNKED_VEC_INLINE iterator end() { return iterator(this, m_size); }
+    [[nodiscard]] CHUNKED_VEC_INLINE const_iterator end() const { return const_iterator(this, m_size); }
+    [[nodiscard]] CHUNKED_VEC_INLINE const_iterator cend() const { return const_iterator(this, m_size); }
+
+    [[nodiscard]] CHUNKED_VEC_INLINE bool empty() const noexcept { return m_size == 0; }
+    [[nodiscard]] CHUNKED_VEC_INLINE size_type size() const noexcept { return m_size; }
+    [[nodiscard]] CHUNKED_VEC_INLINE size_type capacity() const noexcept { return m_page_count * PAGE_SIZE; }
+
+    /// @brief Returns true if the page holding element pos is shared with another container
+    [[nodiscard]] bool is_shared(size_type pos) const
+    {
+        CHUNKED_VEC_ASSERT(pos < m_size && "Index out of range");
+        return is_page_shared(m_pages[layout::split(pos).first]);
+    }
+
+    /// @brief Number of live pages that are currently shared with another container
+    [[nodiscard]] size_type shared_page_count() const noexcept
+    {
+        size_type shared_pages = 0;
+        const size_type live_pages = layout::pages_needed(m_size);
+        for (size_type page_idx = 0; page_idx < live_pages; ++page_idx)
+        {
+            shared_pages += is_page_shared(m_pages[page_idx]) ? 1 : 0;
+        }
+        return shared_pages;
+    }
+
+    /// @brief Start journaling page writes so that they can be rolled back
+    /// @note Time complexity: O(1). Transactions do not nest.
+    void begin_transaction()
+    {
+        CHUNKED_VEC_ASSERT(!in_transaction() && "Transaction already in progress");
+        m_tx_id = next_transaction_id();
+        m_tx_size = m_size;
+    }
+
+    /// @brief Keep every change made since begin_transaction()
+    /// @note Time complexity: O(pages touched) - releases the journaled original pages
+    void commit()
+    {
+        CHUNKED_VEC_ASSERT(in_transaction() && "No transaction in progress");
+        release_journal();
+    }
+
+    /// @brief Undo every change made since begin_transaction()
+    /// @note Time complexity: O(pages touched). Capacity gained during the transaction may be kept as spare pages.
+    void rollback()
+    {
+        CHUNKED_VEC_ASSERT(in_transaction() && "No transaction in progress");
+
+        const size_type tx_live_pages = layout::pages_needed(m_tx_size);
+        const size_type live_pages = layout::pages_needed(m_size);
+
+        // Pages past the original live range were all created or claimed during the transaction:
+        // destroy their elements and keep private ones as spare capacity (same as shrink_to_size)
+        for (size_type page_idx = live_pages; page_idx-- > tx_live_pages;)
+        {
+            T* page = m_pages[page_idx];
+            const size_type live_elements = live_elements_in_page(page_idx);
+            if (is_page_shared(page))
+            {
+                release_page(page, live_elements);
+                m_pages[page_idx] = m_pages[m_page_count - 1];
+                m_pages[m_page_count - 1] = nullptr;
+                --m_page_count;
+            }
+            else
+            {
+                destroy_elements(page, 0, live_elements);
+            }
+        }
+
+        // Put the original pages back in place of their transaction copies
+        for (const journal_entry& entry : m_journal)
+        {
+            if (entry.page_idx < m_page_count)
+            {
+                release_page(m_pages[entry.page_idx], live_elements_in_page(entry.page_idx));
+            }
+            m_pages[entry.page_idx] = entry.page;
+        }
+        // Every original page is either untouched or was journaled, so [0, tx_live_pages) is fully populated again
+        m_page_count = std::max(m_page_count, tx_live_pages);
+        m_size = m_tx_size;
+
+        m_journal.clear();
+        m_tx_id = 0;
+        m_tx_size = 0;
+    }
+
+    [[nodiscard]] bool in_transaction() const noexcept { return m_tx_id != 0; }
+
+    /// @brief Number of original pages kept by the current transaction (the pages a rollback would restore)
+    [[nodiscard]] size_type journaled_page_count() const noexcept { return m_journal.size(); }
+
+    void reserve(size_type new_capacity)
+    {
+        if (new_capacity <= capacity())
+        {
+            return;
+        }
+
+        const size_type pages_needed = layout::pages_needed(new_capacity);
+        ensure_page_capacity(pages_needed);
+        while (m_page_count < pages_needed)
+        {
+            m_pages[m_page_count++] = allocate_page();
+        }
+    }
+
+    /// @brief Destroy all elements
+    /// @note Private pages are kept as spare capacity, shared pages are released to their other owners.
+    /// Inside a transaction the original pages are journaled instead, which may allocate.
+    void clear() { shrink_to_size(0); }
+
+    void push_back(const T& value) { emplace_back(value); }
+    void push_back(T&& value) { emplace_back(std::move(value)); }
+
+    template <typename... Args> reference emplace_back(Args&&... args)
+    {
+        auto [page_idx, elem_idx] = layout::split(m_size);
+        T* page = nullptr;
+        if (page_idx >= m_page_count)
+        {
+            ensure_page_capacity(page_idx + 1);
+            page = allocate_page();
+            m_pages[m_page_count++] = page;
+        }
+        else
+        {
+            // The tail page may still be shared with a snapshot
+            page = writable_page(page_idx);
+        }
+
+        T* ptr = dod::construct<T>(&page[elem_idx], std::forward<Args>(args)...);
+        ++m_size;
+        return *ptr;
+    }
+
+    void pop_back()
+    {
+        CHUNKED_VEC_ASSERT(m_size > 0 && "Cannot pop from empty cow_chunked_vector");
+        shrink_to_size(m_size - 1);
+    }
+
+    void resize(size_type count)
+    {
+        if (count < m_size)
+        {
+            shrink_to_size(count);
+        }
+        else
+        {
+            grow_to_size(count, [](T* ptr) { dod::construct<T>(ptr); });
+        }
+    }
+
+    void resize(size_type count, const T& value)
+    {
+        if (count < m_size)
+        {
+            shrink_to_size(count);
+        }
+        else
+        {
+            grow_to_size(count, [&value](T* ptr) { dod::construct<T>(ptr, value); });
+        }
+    }
+
+  private:
+    using layout = detail::page_layout<PAGE_SIZE>;
+
+    /// @brief Per-page bookkeeping, stored in front of the page elements
+    struct page_header
+    {
+        std::atomic<size_type> ref_count;
+        // Transaction that created (or claimed) this page; only written while the page is private
+        size_type tx_id;
+    };
+
+    /// @brief An original page kept alive by the current transaction
+    struct journal_entry
+    {
+        size_type page_idx;
+        T* page;
+        size_type live_elements;
+    };
+
+    static constexpr size_type PAGE_ALIGNMENT = safe_alignment_of<T> < alignof(page_header) ? alignof(page_header) : safe_alignment_of<T>;
+    static constexpr size_type PAGE_DATA_OFFSET = ((sizeof(page_header) + PAGE_ALIGNMENT - 1) / PAGE_ALIGNMENT) * PAGE_ALIGNMENT;
+
+    // m_pages[0, m_page_count) are always allocated; pages past the live ones are private spare capacity
+    T** m_pages;
+    size_type m_page_count;
+    size_type m_page_capacity;
+    size_type m_size;
+
+    // Transaction state: the journal owns one reference to every original page it holds
+    chunked_vector<journal_entry, 64> m_journal;
+    size_type m_tx_id;
+    size_type m_tx_size;
+
+    [[nodiscard]] static size_type next_transaction_id() noexcept
+    {
+        static std::atomic<size_type> s_last_tx_id{0};
+        return s_last_tx_id.fetch_add(1, std::memory_order_relaxed) + 1;
+    }
+
+    [[nodiscard]] static CHUNKED_VEC_INLINE page_header* header_of(const T* page) noexcept
+    {
+        return reinterpret_cast<page_header*>(const_cast<char*>(reinterpret_cast<const char*>(page)) - PAGE_DATA_OFFSET);
+    }
+
+    [[nodiscard]] static CHUNKED_VEC_INLINE bool is_page_shared(const T* page) noexcept
+    {
+        // Acquire pairs with the release in release_page() so that reads made by other owners
+        // happen-before our writes into a page we turn out to own exclusively
+        return header_of(page)->ref_count.load(std::memory_order_acquire) > 1;
+    }
+
+    /// @brief True if the page existed before the current transaction and must be journaled before it changes
+    [[nodiscard]] CHUNKED_VEC_INLINE bool is_page_journaled_on_write(const T* page) const noexcept
+    {
+        return m_tx_id != 0 && header_of(page)->tx_id != m_tx_id;
+    }
+
+    [[nodiscard]] T* allocate_page() const
+    {
+        void* memory = CHUNKED_VEC_ALLOC(PAGE_DATA_OFFSET + PAGE_SIZE * sizeof(T), PAGE_ALIGNMENT);
+        auto* header = dod::construct<page_header>(memory);
+        header->ref_count.store(1, std::memory_order_relaxed);
+        header->tx_id = m_tx_id;
+        return reinterpret_cast<T*>(static_cast<char*>(memory) + PAGE_DATA_OFFSET);
+    }
+
+    static void add_page_ref(T* page) noexcept { header_of(page)->ref_count.fetch_add(1, std::memory_order_relaxed); }
+
+    /// @brief Drop one reference; the last owner destroys the live elements and frees the page
+    static void release_page(T* page, size_type live_elements) noexcept
+    {
+        page_header* header = header_of(page);
+        if (header->ref_count.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        {
+            destroy_elements(page, 0, live_elements);
+            dod::destruct(header);
+            CHUNKED_VEC_FREE(header);
+        }
+    }
+
+    static void destroy_elements(T* page, size_type first, size_type last) noexcept
+    {
+        if constexpr (!std::is_trivially_destructible_v<T>)
+        {
+            for (size_type elem_idx = first; elem_idx < last; ++elem_idx)
+            {
+                dod::destruct(&page[elem_idx]);
+            }
+        }
+    }
+
+    /// @brief Give up this container's reference to a page that is being replaced or dropped
+    /// @note Inside a transaction an original page moves into the journal instead of being released
+    void retire_page(size_type page_idx, T* page, size_type live_elements)
+    {
+        if (is_page_journaled_on_write(page))
+        {
+            m_journal.push_back(journal_entry{page_idx, page, live_elements});
+        }
+        else
+        {
+            release_page(page, live_elements);
+        }
+    }
+
+    void release_journal() noexcept
+    {
+        for (const journal_entry& entry : m_journal)
+        {
+            release_page(entry.page, entry.live_elements);
+        }
+        m_journal.clear();
+        m_tx_id = 0;
+        m_tx_size = 0;
+    }
+
+    /// @brief Number of live elements stored in the given page
+    [[nodiscard]] CHUNKED_VEC_INLINE size_type live_elements_in_page(size_type page_idx) const noexcept
+    {
+        const size_type page_start = page_idx * PAGE_SIZE;
+        return m_size > page_start ? std::min(m_size - page_start, PAGE_SIZE) : 0;
+    }
+
+    /// @brief Mutable access path: returns a page that is owned exclusively by this container
+    /// @note Clones the page (copying only its live elements) if it is shared or has to be journaled
+    CHUNKED_VEC_INLINE T* writable_page(size_type page_idx)
+    {
+        CHUNKED_VEC_ASSERT(page_idx < m_page_count && "Page index out of range");
+        T* page = m_pages[page_idx];
+        if (!is_page_shared(page) && !is_page_journaled_on_write(page))
+        {
+            return page;
+        }
+        return clone_page(page_idx);
+    }
+
+    T* clone_page(size_type page_idx)
+    {
+        T* source_page = m_pages[page_idx];
+        const size_type live_elements = live_elements_in_page(page_idx);
+        if (live_elements == 0)
+        {
+            // Spare pages are always private and hold nothing worth keeping - claim it for the transaction
+            header_of(source_page)->tx_id = m_tx_id;
+            return source_page;
+        }
+
+        T* page = clone_prefix(source_page, live_elements);
+        m_pages[page_idx] = page;
+        retire_page(page_idx, source_page, live_elements);
+        return page;
+    }
+
+    void share_pages_from(const cow_chunked_vector& other)
+    {
+        CHUNKED_VEC_ASSERT(m_page_count == 0 && "Pages must be released before sharing");
+        const size_type live_pages = layout::pages_needed(other.m_size);
+        ensure_page_capacity(live_pages);
+        for (size_type page_idx = 0; page_idx < live_pages; ++page_idx)
+        {
+            T* page = other.m_pages[page_idx];
+            add_page_ref(page);
+            m_pages[page_idx] = page;
+        }
+        m_page_count = live_pages;
+        m_size = other.m_size;
+    }
+
+    void release_all_pages() noexcept
+    {
+        release_journal();
+        for (size_type page_idx = 0; page_idx < m_page_count; ++page_idx)
+        {
+            release_page(m_pages[page_idx], live_elements_in_page(page_idx));
+        }
+        if (m_pages)
+        {
+            CHUNKED_VEC_FREE(m_pages);
+        }
+        m_pages = nullptr;
+        m_page_count = 0;
+        m_page_capacity = 0;
+        m_size = 0;
+    }
+
+    void ensure_page_capacity(size_type pages_needed) { detail::grow_page_table(m_pages, m_page_capacity, m_page_count, pages_needed); }
+
+    template <typename ConstructFn> void grow_to_size(size_type new_size, ConstructFn construct_fn)
+    {
+        reserve(new_size);
+
+        size_type current_idx = m_size;
+        while (current_idx < new_size)
+        {
+            auto [page_idx, start_elem_idx] = layout::split(current_idx);
+            size_type elements_to_construct = std::min(new_size - current_idx, PAGE_SIZE - start_elem_idx);
+
+            // Only the first page of the range can be shared (a partially filled tail page)
+            T* page = writable_page(page_idx);
+            for (size_type elem_idx = start_elem_idx; elem_idx < start_elem_idx + elements_to_construct; ++elem_idx)
+            {
+                construct_fn(&page[elem_idx]);
+            }
+
+            current_idx += elements_to_construct;
+            m_size = current_idx;
+        }
+    }
+
+    void shrink_to_size(size_type new_size)
+    {
+        CHUNKED_VEC_ASSERT(new_size <= m_size && "shrink_to_size can only shrink");
+
+        const size_type old_live_pages = layout::pages_needed(m_size);
+        const size_type new_live_pages = layout::pages_needed(new_size);
+
+        // Pages that no longer hold live elements: destroy in place if private, otherwise just drop
+        // our reference (or journal the page) and fill the slot with a spare page from the end of the page table
+        for (size_type page_idx = old_live_pages; page_idx-- > new_live_pages;)
+        {
+            T* page = m_pages[page_idx];
+            const size_type live_elements = live_elements_in_page(page_idx);
+            if (is_page_shared(page) || is_page_journaled_on_write(page))
+            {
+                retire_page(page_idx, page, live_elements);
+                m_pages[page_idx] = m_pages[m_page_count - 1];
+                m_pages[m_page_count - 1] = nullptr;
+                --m_page_count;
+            }
+            else
+            {
+                destroy_elements(page, 0, live_elements);
+            }
+        }
+
+        // Partially truncated tail page
+        if (new_live_pages > 0)
+        {
+            const size_type page_idx = new_live_pages - 1;
+            const size_type first_destroyed = new_size - page_idx * PAGE_SIZE;
+            const size_type live_elements = live_elements_in_page(page_idx);
+            if (first_destroyed < live_elements)
+            {
+                T* page = m_pages[page_idx];
+                if (is_page_shared(page) || is_page_journaled_on_write(page))
+                {
+                    // Clone only the part that survives
+                    T* private_page = clone_prefix(page, first_destroyed);
+                    m_pages[page_idx] = private_page;
+                    retire_page(page_idx, page, live_elements);
+                }
+                else
+                {
+                    destroy_elements(page, first_destroyed, live_elements);
+                }
+            }
+        }
+
+        m_size = new_size;
+    }
+
+    [[nodiscard]] T* clone_prefix(const T* shared_page, size_type count) const
+    {
+        T* page = allocate_page();
+        if constexpr (std::is_trivially_copyable_v<T>)
+        {
+            std::memcpy(page, shared_page, count * sizeof(T));
+        }
+        else
+        {
+            for (size_type elem_idx = 0; elem_idx < count; ++elem_idx)
+            {
+                dod::construct<T>(&page[elem_idx], shared_page[elem_idx]);
+            }
+        }
+        return page;
+    }
+
+  public:
+    /// @brief Forward iterator. The mutable flavour makes every page it enters private.
+    template <typename ValueType> class basic_iterator
+    {
+      public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = std::remove_cv_t<ValueType>;
+        using difference_type = std::ptrdiff_t;
+        using pointer = ValueType*;
+        using reference = ValueType&;
+
+        template <typename> friend class basic_iterator;
+        friend class cow_chunked_vector;
+
+        using container_pointer = std::conditional_t<std::is_const_v<ValueType>, const cow_chunked_vector*, cow_chunked_vector*>;
+
+        basic_iterator() noexcept
+            : m_container(nullptr)
+            , m_index(0)
+            , m_current_page(nullptr)
+            , m_page_element_index(0)
+        {
+        }
+
+        basic_iterator(container_pointer container, size_type index)
+            : m_container(container)
+            , m_index(index)
+            , m_current_page(nullptr)
+            , m_page_element_index(0)
+        {
+            update_page_cache();
+        }
+
+        template <typename U, typename = std::enable_if_t<std::is_const_v<ValueType> && !std::is_const_v<U>>>
+        basic_iterator(const basic_iterator<U>& other)
+            : m_container(other.m_container)
+            , m_index(other.m_index)
+            , m_current_page(other.m_current_page)
+            , m_page_element_index(other.m_page_element_index)
+        {
+        }
+
+        reference operator*() const
+        {
+            CHUNKED_VEC_ASSERT(m_container && m_index < m_container->size() && "Iterator out of range");
+            return m_current_page[m_page_element_index];
+        }
+
+        pointer operator->() const
+        {
+            CHUNKED_VEC_ASSERT(m_container && m_index < m_container->size() && "Iterator out of range");
+            return &m_current_page[m_page_element_index];
+        }
+
+        CHUNKED_VEC_INLINE basic_iterator& operator++()
+        {
+            ++m_index;
+            ++m_page_element_index;
+            if (m_page_element_index >= PAGE_SIZE)
+            {
+                update_page_cache();
+            }
+            return *this;
+        }
+
+        CHUNKED_VEC_INLINE basic_iterator operator++(int)
+        {
+            basic_iterator temp = *this;
+            ++(*this);
+            return temp;
+        }
+
+        bool operator==(const basic_iterator& other) const noexcept { return m_container == other.m_container && m_index == other.m_index; }
+        bool operator!=(const basic_iterator& other) const noexcept { return !(*this == other); }
+
+      private:
+        container_pointer m_container;
+        size_type m_index;
+        ValueType* m_current_page;
+        size_type m_page_element_index;
+
+        void update_page_cache()
+        {
+            if (!m_container || m_index >= m_container->size())
+            {
+                m_current_page = nullptr;
+                m_page_element_index = 0;
+                return;
+            }
+
+            auto [page_idx, elem_idx] = layout::split(m_index);
+            m_page_element_index = elem_idx;
+            if constexpr (std::is_const_v<ValueType>)
+            {
+                m_current_page = m_container->m_pages[page_idx];
+            }
+            else
+            {
+                m_current_page = m_container->writable_page(page_idx);
+            }
+        }
+    };
+};
+
+} // namespace dod
@@ -0,0 +1,547 @@
+#pragma once
+
+#include "chunked_vector.h"
+
+namespace dod
+{
+
+/// @brief A chunked vector with fast positional insert and erase
+/// @details Pages have the same size as in chunked_vector, but every page is a circular buffer
+/// with its own head offset. All pages except the last one are full. Inserting or erasing in the
+/// middle shifts elements only inside the target page (whichever side of the position is shorter)
+/// and then rotates a single element through each following page by moving that page's head, so
+/// positional updates cost O(PAGE_SIZE / 2 + size / PAGE_SIZE) element moves instead of O(size).
+///
+/// Random access stays O(1): one page/element split, one page table load and a wrap-around of
+/// the in-page index.
+///
+/// @note Insert/erase relocate elements, so references and iterators at or after the position
+/// are invalidated (including elements in following pages).
+///
+/// @tparam T The type of elements stored in the vector
+/// @tparam PAGE_SIZE The number of elements per page (default: 1024)
+template <typename T, size_t PAGE_SIZE = 1024> class tiered_vector
+{
+  public:
+    using value_type = T;
+    using reference = T&;
+    using const_reference = const T&;
+    using pointer = T*;
+    using const_pointer = const T*;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+
+    template <typename ValueType> class basic_iterator;
+    using iterator = basic_iterator<T>;
+    using const_iterator = basic_iterator<const T>;
+
+    /// @brief Returns the page size used by this container
+    [[nodiscard]] static constexpr size_t page_size() { return PAGE_SIZE; }
+
+    tiered_vector() noexcept
+        : m_pages(nullptr)
+        , m_page_count(0)
+        , m_page_capacity(0)
+        , m_size(0)
+    {
+    }
+
+    explicit tiered_vector(size_type count)
+        : tiered_vector()
+    {
+        reserve(count);
+        for (size_type i = 0; i < count; ++i)
+        {
+            emplace_back();
+        }
+    }
+
+    tiered_vector(size_type count, const T& value)
+        : tiered_vector()
+    {
+        reserve(count);
+        for (size_type i = 0; i < count; ++i)
+        {
+            push_back(value);
+        }
+    }
+
+    tiered_vector(std::initializer_list<T> init)
+        : tiered_vector()
+    {
+        reserve(init.size());
+        for (const auto& item : init)
+        {
+            push_back(item);
+        }
+    }
+
+    tiered_vector(const tiered_vector& other)
+        : tiered_vector()
+    {
+        copy_from(other);
+    }
+
+    tiered_vector(tiered_vector&& other) noexcept
+        : m_pages(other.m_pages)
+        , m_page_count(other.m_page_count)
+        , m_page_capacity(other.m_page_capacity)
+        , m_size(other.m_size)
+    {
+        other.m_pages = nullptr;
+        other.m_page_count = 0;
+        other.m_page_capacity = 0;
+        other.m_size = 0;
+    }
+
+    ~tiered_vector() { free_pages(); }
+
+    /// @brief Copy assignment - reuses already allocated pages
+    tiered_vector& operator=(const tiered_vector& other)
+    {
+        if (this != &other)
+        {
+            clear();
+            copy_from(other);
+        }
+        return *this;
+    }
+
+    tiered_vector& operator=(tiered_vector&& other) noexcept
+    {
+        if (this != &other)
+        {
+            free_pages();
+
+            m_pages = other.m_pages;
+            m_page_count = other.m_page_count;
+            m_page_capacity = other.m_page_capacity;
+            m_size = other.m_size;
+
+            other.m_pages = nullptr;
+            other.m_page_count = 0;
+            other.m_page_capacity = 0;
+            other.m_size = 0;
+        }
+        return *this;
+    }
+
+    [[nodiscard]] CHUNKED_VEC_INLINE reference operator[](size_type pos)
+    {
+        CHUNKED_VEC_ASSERT(pos < m_size && "Index out of range");
+        auto [page_idx, elem_idx] = layout::split(pos);
+        return *slot(m_pages[page_idx], elem_idx);
+    }
+
+    [[nodiscard]] CHUNKED_VEC_INLINE const_reference operator[](size_type pos) const
+    {
+        CHUNKED_VEC_ASSERT(pos < m_size && "Index out of range");
+        auto [page_idx, elem_idx] = layout::split(pos);
+        return *slot(m_pages[page_idx], elem_idx);
+    }
+
+    [[nodiscard]] CHUNKED_VEC_INLINE reference at(size_type pos)
+    {
+        if (pos >= m_size)
+        {
+            throw std::out_of_range("tiered_vector::at: index out of range");
+        }
+        return (*this)[pos];
+    }
+
+    [[nodiscard]] CHUNKED_VEC_INLINE const_reference at(size_type pos) const
+    {
+        if (pos >= m_size)
+        {
+            throw std::out_of_range("tiered_vector::at: index out of range");
+        }
+        return (*this)[pos];
+    }
+
+    [[nodiscard]] CHUNKED_VEC_INLINE reference front()
+    {
+        CHUNKED_VEC_ASSERT(m_size > 0 && "Cannot access front of empty tiered_vector");
+        return (*this)[0];
+    }
+
+    [[nodiscard]] CHUNKED_VEC_INLINE const_reference front() const
+    {
+        CHUNKED_VEC_ASSERT(m_size > 0 && "Cannot access front of empty tiered_vector");
+        return (*this)[0];
+    }
+
+    [[nodiscard]] CHUNKED_VEC_INLINE reference back()
+    {
+        CHUNKED_VEC_ASSERT(m_size > 0 && "Cannot access back of empty tiered_vector");
+        return (*this)[m_size - 1];
+    }
+
+    [[nodiscard]] CHUNKED_VEC_INLINE const_reference back() const
+    {
+        CHUNKED_VEC_ASSERT(m_size > 0 && "Cannot access back of empty tiered_vector");
+        return (*this)[m_size - 1];
+    }
+
+    [[nodiscard]] CHUNKED_VEC_INLINE iterator begin() noexcept { return iterator(this, 0); }
+    [[nodiscard]] CHUNKED_VEC_INLINE const_iterator begin() const noexcept { return const_iterator(this, 0); }
+    [[nodiscard]] CHUNKED_VEC_INLINE const_iterator cbegin() const noexcept { return const_iterator(this, 0); }
+
+    [[nodiscard]] CHUNKED_VEC_INLINE iterator end() noexcept { return iterator(this, m_size); }
+    [[nodiscard]] CHUNKED_VEC_INLINE const_iterator end() const noexcept { return const_iterator(this, m_size); }
+    [[nodiscard]] CHUNKED_VEC_INLINE const_iterator cend() const noexcept { return const_iterator(this, m_size); }
+
+    [[nodiscard]] CHUNKED_VEC_INLINE bool empty() const noexcept { return m_size == 0; }
+    [[nodiscard]] CHUNKED_VEC_INLINE size_type size() const noexcept { return m_size; }
+    [[nodiscard]] CHUNKED_VEC_INLINE size_type capacity() const noexcept { return m_page_count * PAGE_SIZE; }
+
+    void reserve(size_type new_capacity)
+    {
+        if (new_capacity <= capacity())
+        {
+            return;
+        }
+
+        const size_type pages_needed = layout::pages_needed(new_capacity);
+        ensure_page_capacity(pages_needed);
+        while (m_page_count < pages_needed)
+        {
+            m_pages[m_page_count++] = page_entry{allocate_page(), 0};
+        }
+    }
+
+    /// @brief Destroy all elements, keeping the pages as spare capacity
+    void clear() noexcept
+    {
+        if constexpr (!std::is_trivially_destructible_v<T>)
+        {
+            size_type remaining = m_size;
+            for (size_type page_idx = 0; remaining > 0; ++page_idx)
+            {
+                const size_type count = std::min(remaining, PAGE_SIZE);
+                for (size_type elem_idx = 0; elem_idx < count; ++elem_idx)
+                {
+                    dod::destruct(slot(m_pages[page_idx], elem_idx));
+                }
+                remaining -= count;
+            }
+        }
+        m_size = 0;
+    }
+
+    void push_back(const T& value) { emplace_back(value); }
+    void push_back(T&& value) { emplace_back(std::move(value)); }
+
+    template <typename... Args> reference emplace_back(Args&&... args)
+    {
+        auto [page_idx, elem_idx] = layout::split(m_size);
+        if (page_idx >= m_page_count)
+        {
+            reserve(m_size + 1);
+        }
+
+        T* ptr = dod::construct<T>(slot(m_pages[page_idx], elem_idx), std::forward<Args>(args)...);
+        ++m_size;
+        return *ptr;
+    }
+
+    void pop_back()
+    {
+        CHUNKED_VEC_ASSERT(m_size > 0 && "Cannot pop from empty tiered_vector");
+        if constexpr (!std::is_trivially_destructible_v<T>)
+        {
+            dod::destruct(&back());
+        }
+        --m_size;
+    }
+
+    /// @brief Insert value before position pos
+    /// @note Time complexity: O(PAGE_SIZE / 2 + size / PAGE_SIZE)
+    void insert(size_type pos, const T& value) { emplace(pos, value); }
+    void insert(size_type pos, T&& value) { emplace(pos, std::move(value)); }
+
+    /// @brief Construct an element before position pos
+    /// @return Reference to the new element
+    template <typename... Args> reference emplace(size_type pos, Args&&... args)
+    {
+        CHUNKED_VEC_ASSERT(pos <= m_size && "Insert position out of range");
+        if (pos == m_size)
+        {
+            return emplace_back(std::forward<Args>(args)...);
+        }
+
+        const size_type last_page = layout::split(m_size).first;
+        if (last_page >= m_page_count)
+        {
+            reserve(m_size + 1);
+        }
+
+        // Construct before shifting: args may refer to an element that is about to move
+        alignas(T) unsigned char buffer[sizeof(T)];
+        T* value = dod::construct<T>(buffer, std::forward<Args>(args)...);
+
+        auto [target_page, local_idx] = layout::split(pos);
+
+        // Rotate one element from the back of each full page into the front of the next one
+        for (size_type page_idx = last_page; page_idx > target_page; --page_idx)
+        {
+            page_entry& dst = m_pages[page_idx];
+            page_entry& src = m_pages[page_idx - 1];
+            dst.head = wrap(dst.head + PAGE_SIZE - 1);
+            relocate(dst.data + dst.head, slot(src, PAGE_SIZE - 1));
+        }
+
+        // The target page now has a free slot at its logical end (and therefore before its head)
+        page_entry& target = m_pages[target_page];
+        const size_type target_count = target_page == last_page ? m_size - target_page * PAGE_SIZE : PAGE_SIZE - 1;
+        open_gap(target, local_idx, target_count);
+
+        T* ptr = slot(target, local_idx);
+        relocate(ptr, value);
+        ++m_size;
+        return *ptr;
+    }
+
+    /// @brief Erase the element at position pos
+    /// @note Time complexity: O(PAGE_SIZE / 2 + size / PAGE_SIZE)
+    void erase(size_type pos)
+    {
+        CHUNKED_VEC_ASSERT(pos < m_size && "Erase position out of range");
+        const size_type last_page = layout::split(m_size - 1).first;
+        auto [target_page, local_idx] = layout::split(pos);
+
+        page_entry& target = m_pages[target_page];
+        const size_type target_count = target_page == last_page ? m_size - target_page * PAGE_SIZE : PAGE_SIZE;
+        dod::destruct(slot(target, local_idx));
+        close_gap(target, local_idx, target_count);
+
+        // Rotate the front element of each following page into the back of the previous one
+        for (size_type page_idx = target_page + 1; page_idx <= last_page; ++page_idx)
+        {
+            page_entry& dst = m_pages[page_idx - 1];
+            page_entry& src = m_pages[page_idx];
+            relocate(slot(dst, PAGE_SIZE - 1), src.data + src.head);
+            src.head = wrap(src.head + 1);
+        }
+        --m_size;
+    }
+
+    /// @brief Erase the element at pos
+    /// @return Iterator to the element that followed the erased one
+    iterator erase(const_iterator pos)
+    {
+        CHUNKED_VEC_ASSERT(pos.m_container == this && "Iterator does not belong to this container");
+        const size_type index = pos.m_index;
+        erase(index);
+        return iterator(this, index);
+    }
+
+  private:
+    using layout = detail::page_layout<PAGE_SIZE>;
+
+    /// @brief A page is a circular buffer: logical element i is stored at data[(head + i) % PAGE_SIZE]
+    struct page_entry
+    {
+        T* data;
+        size_type head;
+    };
+
+    // m_pages[0, m_page_count) hold allocated pages; pages before the last live one are always full
+    page_entry* m_pages;
+    size_type m_page_count;
+    size_type m_page_capacity;
+    size_type m_size;
+
+    /// @brief Reduce an in-page index modulo PAGE_SIZE
+    /// @note idx must be below 2 * PAGE_SIZE. Callers add a head and an offset that are each below PAGE_SIZE, so this
+    /// holds by construction and is not checked: clear() and close_gap() are noexcept and reach it.
+    [[nodiscard]] static CHUNKED_VEC_INLINE size_type wrap(size_type idx) noexcept
+    {
+        return idx >= PAGE_SIZE ? idx - PAGE_SIZE : idx;
+    }
+
+    [[nodiscard]] static CHUNKED_VEC_INLINE T* slot(const page_entry& page, size_type elem_idx) noexcept
+    {
+        return page.data + wrap(page.head + elem_idx);
+    }
+
+    /// @brief Move-construct *src into dst and destroy *src
+    static CHUNKED_VEC_INLINE void relocate(T* dst, T* src) noexcept
+    {
+        if constexpr (is_trivially_relocatable_v<T>)
+        {
+            std::memcpy(static_cast<void*>(dst), static_cast<const void*>(src), sizeof(T));
+        }
+        else
+        {
+            dod::construct<T>(dst, std::move(*src));
+            dod::destruct(src);
+        }
+    }
+
+    /// @brief Open an uninitialized slot at logical index local_idx of a page that holds count < PAGE_SIZE elements
+    static void open_gap(page_entry& page, size_type local_idx, size_type count)
+    {
+        CHUNKED_VEC_ASSERT(count < PAGE_SIZE && "Page must have a free slot");
+        if (local_idx < count - local_idx)
+        {
+            // Shift the front part one slot towards the head
+            page.head = wrap(page.head + PAGE_SIZE - 1);
+            for (size_type elem_idx = 0; elem_idx < local_idx; ++elem_idx)
+            {
+                relocate(slot(page, elem_idx), slot(page, elem_idx + 1));
+            }
+        }
+        else
+        {
+            for (size_type elem_idx = count; elem_idx > local_idx; --elem_idx)
+            {
+                relocate(slot(page, elem_idx), slot(page, elem_idx - 1));
+            }
+        }
+    }
+
+    /// @brief Close the (already destroyed) slot at logical index local_idx of a page that held count elements
+    static void close_gap(page_entry& page, size_type local_idx, size_type count) noexcept
+    {
+        if (local_idx < count - 1 - local_idx)
+        {
+            // Shift the front part one slot away from the head
+            for (size_type elem_idx = local_idx; elem_idx > 0; --elem_idx)
+            {
+                relocate(slot(page, elem_idx), slot(page, elem_idx - 1));
+            }
+            page.head = wrap(page.head + 1);
+        }
+        else
+        {
+            for (size_type elem_idx = local_idx; elem_idx + 1 < count; ++elem_idx)
+            {
+                relocate(slot(page, elem_idx), slot(page, elem_idx + 1));
+            }
+        }
+    }
+
+    [[nodiscard]] static T* allocate_page() { return static_cast<T*>(CHUNKED_VEC_ALLOC(PAGE_SIZE * sizeof(T), safe_alignment_of<T>)); }
+
+    void copy_from(const tiered_vector& other)
+    {
+        CHUNKED_VEC_ASSERT(m_size == 0 && "copy_from expects an empty container");
+        reserve(other.m_size);
+
+        // Copies are written linearized (head 0), page by page
+        size_type remaining = other.m_size;
+        for (size_type page_idx = 0; remaining > 0; ++page_idx)
+        {
+            const page_entry& src = other.m_pages[page_idx];
+            page_entry& dst = m_pages[page_idx];
+            dst.head = 0;
+            const size_type count = std::min(remaining, PAGE_SIZE);
+            for (size_type elem_idx = 0; elem_idx < count; ++elem_idx)
+            {
+                dod::construct<T>(dst.data + elem_idx, *slot(src, elem_idx));
+                ++m_size;
+            }
+            remaining -= count;
+        }
+    }
+
+    void free_pages() noexcept
+    {
+        clear();
+        for (size_type page_idx = 0; page_idx < m_page_count; ++page_idx)
+        {
+            CHUNKED_VEC_FREE(m_pages[page_idx].data);
+        }
+        if (m_pages)
+        {
+            CHUNKED_VEC_FREE(m_pages);
+        }
+        m_pages = nullptr;
+        m_page_count = 0;
+        m_page_capacity = 0;
+    }
+
+    void ensure_page_capacity(size_type pages_needed) { detail::grow_page_table(m_pages, m_page_capacity, m_page_count, pages_needed); }
+
+  public:
+    /// @brief Forward iterator that walks the vector page by page
+    template <typename ValueType> class basic_iterator
+    {
+      public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = std::remove_cv_t<ValueType>;
+        using difference_type = std::ptrdiff_t;
+        using pointer = ValueType*;
+        using reference = ValueType&;
+
+        template <typename> friend class basic_iterator;
+        friend class tiered_vector;
+
+        using container_pointer = std::conditional_t<std::is_const_v<ValueType>, const tiered_vector*, tiered_vector*>;
+
+        basic_iterator() noexcept
+            : m_container(nullptr)
+            , m_index(0)
+            , m_page(nullptr)
+            , m_page_element_index(0)
+        {
+        }
+
+        template <typename U, typename = std::enable_if_t<std::is_const_v<ValueType> && !std::is_const_v<U>>>
+        basic_iterator(const basic_iterator<U>& other) noexcept
+            : m_container(other.m_container)
+            , m_index(other.m_index)
+            , m_page(other.m_page)
+            , m_page_element_index(other.m_page_element_index)
+        {
+        }
+
+        reference operator*() const
+        {
+            CHUNKED_VEC_ASSERT(m_container && m_index < m_container->size() && "Iterator out of range");
+            return *slot(*m_page, m_page_element_index);
+        }
+
+        pointer operator->() const { return &**this; }
+
+        CHUNKED_VEC_INLINE basic_iterator& operator++() noexcept
+        {
+            ++m_index;
+            if (++m_page_element_index == PAGE_SIZE)
+            {
+                ++m_page;
+                m_page_element_index = 0;
+            }
+            return *this;
+        }
+
+        CHUNKED_VEC_INLINE basic_iterator operator++(int) noexcept
+        {
+            basic_iterator temp = *this;
+            ++(*this);
+            return temp;
+        }
+
+        bool operator==(const basic_iterator& other) const noexcept { return m_container == other.m_container && m_index == other.m_index; }
+        bool operator!=(const basic_iterator& other) const noexcept { return !(*this == other); }
+
+      private:
+        container_pointer m_container;
+        size_type m_index;
+        const page_entry* m_page;
+        size_type m_page_element_index;
+
+        basic_iterator(container_pointer container, size_type index) noexcept
+            : m_container(container)
+            , m_index(index)
+            , m_page(nullptr)
+            , m_page_element_index(0)
+        {
+            auto [page_idx, elem_idx] = layout::split(index);
+            m_page = container->m_pages + page_idx;
+            m_page_element_index = elem_idx;
+        }
+    };
+};
+
+} // namespace dod
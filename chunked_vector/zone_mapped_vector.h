@@ -0,0 +1,263 @@
+#pragma once
+
+#include "chunked_vector.h"
+
+namespace dod
+{
+
+/// @brief Min/max summary of the elements stored in one page
+template <typename T> struct page_zone
+{
+    T min;
+    T max;
+    size_t count; ///< Number of elements in the page
+    bool valid;   ///< False after mutable access; min/max are stale until the next refreshing scan
+};
+
+/// @brief A chunked_vector that keeps a per-page zone map (min, max, count) for range-scan pruning
+/// @details The zone of the last page is updated incrementally by push_back/emplace_back. Any mutable
+/// access to an element or segment marks the zone of its page as invalid; invalid pages are always
+/// scanned and a non-const scan_where recomputes their zone during the same pass.
+///
+/// scan_where(lo, hi, fn) skips whole pages whose [min, max] does not intersect [lo, hi] and visits
+/// pages that lie entirely inside the range without per-element comparisons, so clustered data
+/// (timestamps, sequence numbers, sorted-ish keys) is filtered at page granularity.
+///
+/// @tparam T Element type (must be copyable and ordered by operator<)
+/// @tparam PAGE_SIZE The number of elements per page (default: 1024)
+template <typename T, size_t PAGE_SIZE = 1024> class zone_mapped_vector
+{
+  public:
+    using value_type = T;
+    using reference = T&;
+    using const_reference = const T&;
+    using size_type = std::size_t;
+    using zone_type = page_zone<T>;
+    using const_iterator = typename chunked_vector<T, PAGE_SIZE>::const_iterator;
+
+    /// @brief Returns the page size used by this container
+    [[nodiscard]] static constexpr size_t page_size() { return PAGE_SIZE; }
+
+    zone_mapped_vector() = default;
+
+    zone_mapped_vector(std::initializer_list<T> init)
+    {
+        reserve(init.size());
+        for (const auto& item : init)
+        {
+            push_back(item);
+        }
+    }
+
+    /// @brief Read-only access to the underlying values
+    [[nodiscard]] CHUNKED_VEC_INLINE const chunked_vector<T, PAGE_SIZE>& values() const noexcept { return m_values; }
+
+    /// @brief Mutable access to an element; invalidates the zone of its page
+    [[nodiscard]] CHUNKED_VEC_INLINE reference operator[](size_type pos)
+    {
+        invalidate_page(layout::split(pos).first);
+        return m_values[pos];
+    }
+
+    [[nodiscard]] CHUNKED_VEC_INLINE const_reference operator[](size_type pos) const { return m_values[pos]; }
+
+    [[nodiscard]] CHUNKED_VEC_INLINE reference at(size_type pos)
+    {
+        if (pos >= size())
+        {
+            throw std::out_of_range("zone_mapped_vector::at: index out of range");
+        }
+        return (*this)[pos];
+    }
+
+    [[nodiscard]] CHUNKED_VEC_INLINE const_reference at(size_type pos) const
+    {
+        if (pos >= size())
+        {
+            throw std::out_of_range("zone_mapped_vector::at: index out of range");
+        }
+        return m_values[pos];
+    }
+
+    [[nodiscard]] CHUNKED_VEC_INLINE const_reference front() const { return m_values.front(); }
+    [[nodiscard]] CHUNKED_VEC_INLINE const_reference back() const { return m_values.back(); }
+
+    /// @brief Read-only iteration (mutable iteration would bypass zone invalidation)
+    [[nodiscard]] CHUNKED_VEC_INLINE const_iterator begin() const noexcept { return m_values.begin(); }
+    [[nodiscard]] CHUNKED_VEC_INLINE const_iterator end() const noexcept { return m_values.end(); }
+    [[nodiscard]] CHUNKED_VEC_INLINE const_iterator cbegin() const noexcept { return m_values.cbegin(); }
+    [[nodiscard]] CHUNKED_VEC_INLINE const_iterator cend() const noexcept { return m_values.cend(); }
+
+    [[nodiscard]] CHUNKED_VEC_INLINE bool empty() const noexcept { return m_values.empty(); }
+    [[nodiscard]] CHUNKED_VEC_INLINE size_type size() const noexcept { return m_values.size(); }
+    [[nodiscard]] CHUNKED_VEC_INLINE size_type capacity() const noexcept { return m_values.capacity(); }
+
+    [[nodiscard]] CHUNKED_VEC_INLINE size_type segment_count() const noexcept { return m_zones.size(); }
+
+    /// @brief Mutable access to the elements of one page; invalidates the zone of that page
+    [[nodiscard]] CHUNKED_VEC_INLINE page_segment<T> segment(size_type segment_idx)
+    {
+        invalidate_page(segment_idx);
+        return m_values.segment(segment_idx);
+    }
+
+    [[nodiscard]] CHUNKED_VEC_INLINE page_segment<const T> segment(size_type segment_idx) const { return m_values.segment(segment_idx); }
+
+    /// @brief Zone summary of page segment_idx
+    [[nodiscard]] CHUNKED_VEC_INLINE const zone_type& zone(size_type segment_idx) const { return m_zones[segment_idx]; }
+
+    void reserve(size_type new_capacity)
+    {
+        m_values.reserve(new_capacity);
+        m_zones.reserve(layout::pages_needed(new_capacity));
+    }
+
+    void clear() noexcept
+    {
+        m_values.clear();
+        m_zones.clear();
+    }
+
+    void push_back(const T& value) { emplace_back(value); }
+    void push_back(T&& value) { emplace_back(std::move(value)); }
+
+    template <typename... Args> reference emplace_back(Args&&... args)
+    {
+        const bool starts_page = layout::split(m_values.size()).second == 0;
+        T& value = m_values.emplace_back(std::forward<Args>(args)...);
+        if (starts_page)
+        {
+            m_zones.push_back(zone_type{value, value, 1, true});
+        }
+        else
+        {
+            zone_type& zone = m_zones.back();
+            ++zone.count;
+            if (zone.valid)
+            {
+                if (value < zone.min)
+                {
+                    zone.min = value;
+                }
+                if (zone.max < value)
+                {
+                    zone.max = value;
+                }
+            }
+        }
+        return value;
+    }
+
+    void pop_back()
+    {
+        CHUNKED_VEC_ASSERT(!empty() && "Cannot pop from empty zone_mapped_vector");
+        zone_type& zone = m_zones.back();
+        const T& value = m_values.back();
+        // Removing an extreme value makes the bounds loose; mark the zone for recomputation
+        if (zone.valid && !(zone.min < value && value < zone.max))
+        {
+            zone.valid = false;
+        }
+        m_values.pop_back();
+        if (--zone.count == 0)
+        {
+            m_zones.pop_back();
+        }
+    }
+
+    /// @brief Call fn(index, value) for every element with lo <= value <= hi, in index order
+    /// @details Pages whose zone lies outside [lo, hi] are skipped. Invalid zones are recomputed
+    /// in the same pass that scans their page.
+    template <typename Fn> void scan_where(const T& lo, const T& hi, Fn&& fn)
+    {
+        const size_type segments = m_zones.size();
+        for (size_type segment_idx = 0; segment_idx < segments; ++segment_idx)
+        {
+            zone_type& zone = m_zones[segment_idx];
+            if (zone.valid)
+            {
+                scan_page(segment_idx, zone, lo, hi, fn);
+                continue;
+            }
+
+            const page_segment<const T> page = std::as_const(m_values).segment(segment_idx);
+            const size_type page_start = segment_idx * PAGE_SIZE;
+            T min = page[0];
+            T max = page[0];
+            for (size_type elem_idx = 0; elem_idx < page.size; ++elem_idx)
+            {
+                const T& value = page[elem_idx];
+                if (value < min)
+                {
+                    min = value;
+                }
+                if (max < value)
+                {
+                    max = value;
+                }
+                if (!(value < lo) && !(hi < value))
+                {
+                    fn(page_start + elem_idx, value);
+                }
+            }
+            zone.min = std::move(min);
+            zone.max = std::move(max);
+            zone.valid = true;
+        }
+    }
+
+    /// @brief Read-only scan; pages with an invalid zone are scanned element by element
+    template <typename Fn> void scan_where(const T& lo, const T& hi, Fn&& fn) const
+    {
+        const size_type segments = m_zones.size();
+        for (size_type segment_idx = 0; segment_idx < segments; ++segment_idx)
+        {
+            scan_page(segment_idx, m_zones[segment_idx], lo, hi, fn);
+        }
+    }
+
+  private:
+    using layout = detail::page_layout<PAGE_SIZE>;
+
+    chunked_vector<T, PAGE_SIZE> m_values;
+    chunked_vector<zone_type, 256> m_zones;
+
+    CHUNKED_VEC_INLINE void invalidate_page(size_type segment_idx)
+    {
+        CHUNKED_VEC_ASSERT(segment_idx < m_zones.size() && "Segment index out of range");
+        m_zones[segment_idx].valid = false;
+    }
+
+    template <typename Fn> void scan_page(size_type segment_idx, const zone_type& zone, const T& lo, const T& hi, Fn& fn) const
+    {
+        const page_segment<const T> page = m_values.segment(segment_idx);
+        const size_type page_start = segment_idx * PAGE_SIZE;
+        if (zone.valid)
+        {
+            if (zone.max < lo || hi < zone.min)
+            {
+                return;
+            }
+            if (!(zone.min < lo) && !(hi < zone.max))
+            {
+                // The whole page matches
+                for (size_type elem_idx = 0; elem_idx < page.size; ++elem_idx)
+                {
+                    fn(page_start + elem_idx, page[elem_idx]);
+                }
+                return;
+            }
+        }
+
+        for (size_type elem_idx = 0; elem_idx < page.size; ++elem_idx)
+        {
+            const T& value = page[elem_idx];
+            if (!(value < lo) && !(hi < value))
+            {
+                fn(page_start + elem_idx, value);
+            }
+        }
+    }
+};
+
+} // namespace dod
@@ -449,6 +449,58 @@ TEST_F(ChunkedVectorTest, ForwardIteratorComparisons)
     EXPECT_FALSE(it1 != it4);
 }
 
+TEST_F(ChunkedVectorTest, IteratorCrossesPagesAndReachesEnd)
+{
+    static_assert(noexcept(std::declval<chunked_vector<int, 8>&>().begin()) && noexcept(std::declval<chunked_vector<int, 8>&>().end()));
+    static_assert(noexcept(std::declval<const chunked_vector<int, 8>&>().cbegin()) &&
+                  noexcept(std::declval<const chunked_vector<int, 8>&>().cend()));
+
+    // Partial last page, exactly full pages, full pages with a spare reserved page, empty with reserved pages
+    for (size_t count : {0u, 1u, 7u, 8u, 16u, 19u})
+    {
+        SCOPED_TRACE(count);
+        chunked_vector<int, 8> vec;
+        for (size_t i = 0; i < count; ++i)
+        {
+            vec.push_back(static_cast<int>(i));
+        }
+        for (size_t reserved : {count, count + 8})
+        {
+            vec.reserve(reserved);
+            size_t visited = 0;
+            for (auto it = vec.begin(); it != vec.end(); ++it)
+            {
+                EXPECT_EQ(vec.index_of(it), visited);
+                EXPECT_EQ(*it, static_cast<int>(visited));
+                ++visited;
+            }
+            EXPECT_EQ(visited, count);
+            EXPECT_EQ(vec.index_of(vec.end()), count);
+            EXPECT_EQ(vec.index_of(vec.cbegin()), 0u);
+        }
+    }
+}
+
+TEST_F(ChunkedVectorTest, IteratorSurvivesPageTableGrowth)
+{
+    chunked_vector<int, 4> vec;
+    vec.push_back(0);
+    auto it = vec.cbegin();
+
+    // Enough pages to reallocate the page table several times
+    for (int i = 1; i < 1000; ++i)
+    {
+        vec.push_back(i);
+    }
+
+    int expected = 0;
+    for (; it != vec.cend(); ++it)
+    {
+        EXPECT_EQ(*it, expected++);
+    }
+    EXPECT_EQ(expected, 1000);
+}
+
 // ============================================================================
 // Capacity Tests
 // ============================================================================
@@ -716,6 +768,88 @@ TEST_F(ChunkedVectorTest, PageBoundaryOperations)
     }
 }
 
+template <size_t PAGE_SIZE> void check_page_split()
+{
+    using layout = detail::page_layout<PAGE_SIZE>;
+    std::mt19937_64 rng(PAGE_SIZE);
+    std::vector<size_t> positions = {0, 1, PAGE_SIZE - 1, PAGE_SIZE, PAGE_SIZE + 1, PAGE_SIZE * 1000 - 1, (size_t(1) << 32) + 7,
+                                     (size_t(1) << 63) - 1, ((size_t(1) << 63) / PAGE_SIZE) * PAGE_SIZE - 1};
+    for (int i = 0; i < 10000; ++i)
+    {
+        positions.push_back(static_cast<size_t>(rng() >> 1));
+        positions.push_back(static_cast<size_t>(rng() % (PAGE_SIZE * 100000)));
+    }
+    for (size_t pos : positions)
+    {
+        const auto [page_idx, elem_idx] = layout::split(pos);
+        ASSERT_EQ(page_idx, pos / PAGE_SIZE) << "pos " << pos;
+        ASSERT_EQ(elem_idx, pos % PAGE_SIZE) << "pos " << pos;
+    }
+}
+
+TEST_F(ChunkedVectorTest, PageSplitMatchesDivision)
+{
+    check_page_split<3>();
+    check_page_split<100>();
+    check_page_split<1000>();
+    check_page_split<1024>();
+    check_page_split<1365>();
+    check_page_split<(size_t(1) << 31) + 1>();
+}
+
+TEST_F(ChunkedVectorTest, NonPowerOfTwoPageSize)
+{
+    chunked_vector<int, 1365> vec;
+    for (int i = 0; i < 5000; ++i)
+    {
+        vec.push_back(i);
+    }
+    for (int i = 0; i < 5000; ++i)
+    {
+        ASSERT_EQ(vec[i], i);
+    }
+    EXPECT_EQ(vec.segment_count(), 4u);
+    EXPECT_EQ(vec.segment(3).size, 5000u - 3 * 1365);
+}
+
+TEST_F(ChunkedVectorTest, ByteBudgetedPageSize)
+{
+    struct Record48
+    {
+        char bytes[48];
+    };
+    struct Record56
+    {
+        char bytes[56];
+    };
+    struct Huge
+    {
+        char bytes[100000];
+    };
+
+    // Power-of-two element sizes fill the budget exactly
+    static_assert(page_size_for_bytes<uint8_t>(64 * 1024) == 64 * 1024);
+    static_assert(page_size_for_bytes<uint64_t>(2 * 1024 * 1024) == 256 * 1024);
+    // 1024 records would fill only 75% of 64 KB, so the exact fit wins
+    static_assert(page_size_for_bytes<Record48>(64 * 1024) == 1365);
+    // 1024 records fill 87.5%, close enough to keep power-of-two indexing
+    static_assert(page_size_for_bytes<Record56>(64 * 1024) == 1024);
+    static_assert(page_size_for_bytes<Huge>(64 * 1024) == 1);
+
+    chunked_vector_bytes<int, 4096> vec;
+    EXPECT_EQ(vec.page_size(), 1024u);
+    for (int i = 0; i < 3000; ++i)
+    {
+        vec.push_back(i);
+    }
+    EXPECT_EQ(vec.segment_count(), 3u);
+    EXPECT_EQ(vec[2999], 2999);
+
+    chunked_vector_bytes<Record48> records(2000);
+    EXPECT_EQ(records.page_size(), 1365u);
+    EXPECT_EQ(records.segment_count(), 2u);
+}
+
 // ============================================================================
 // Custom Type Tests
 // ============================================================================
@@ -2964,4 +3098,1159 @@ TEST_F(PageByPageOptimizationTest, IteratorComparisonScenarios)
     auto it4(it1);
     EXPECT_TRUE(it1 == it4);
     EXPECT_FALSE(it1 != it4);
-}
\ No newline at end of file
+}
+
+// ============================================================================
+// Trivially Relocatable Element Tests
+// ============================================================================
+
+// Non-trivial type explicitly marked as trivially relocatable: the container must shift it
+// with memmove, so no move constructor calls are expected
+struct RelocatableObject
+{
+    int value;
+    static int move_calls;
+    static int destructor_calls;
+
+    explicit RelocatableObject(int v)
+        : value(v)
+    {
+    }
+    RelocatableObject(const RelocatableObject& other) = default;
+    RelocatableObject(RelocatableObject&& other) noexcept
+        : value(other.value)
+    {
+        ++move_calls;
+    }
+    ~RelocatableObject() { ++destructor_calls; }
+};
+
+int RelocatableObject::move_calls = 0;
+int RelocatableObject::destructor_calls = 0;
+
+template <> struct dod::is_trivially_relocatable<RelocatableObject> : std::true_type
+{
+};
+
+class TriviallyRelocatableTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        RelocatableObject::move_calls = 0;
+        RelocatableObject::destructor_calls = 0;
+    }
+    void TearDown() override {}
+};
+
+TEST_F(TriviallyRelocatableTest, TraitDefaults)
+{
+    EXPECT_TRUE(dod::is_trivially_relocatable_v<int>);
+    EXPECT_TRUE(dod::is_trivially_relocatable_v<LargeObject>);
+    EXPECT_TRUE(dod::is_trivially_relocatable_v<std::unique_ptr<int>>);
+    EXPECT_TRUE(dod::is_trivially_relocatable_v<std::unique_ptr<int[]>>);
+    EXPECT_TRUE(dod::is_trivially_relocatable_v<RelocatableObject>);
+    EXPECT_FALSE(dod::is_trivially_relocatable_v<TestObject>);
+    EXPECT_FALSE(dod::is_trivially_relocatable_v<std::string>);
+}
+
+TEST_F(TriviallyRelocatableTest, EraseSingleAcrossPages)
+{
+    constexpr size_t PAGE_SIZE = 4;
+    chunked_vector<RelocatableObject, PAGE_SIZE> vec;
+    for (int i = 0; i < 11; ++i)
+    {
+        vec.emplace_back(i);
+    }
+
+    auto result_it = vec.erase(advance_iterator(vec.begin(), 2));
+    EXPECT_EQ(result_it->value, 3);
+    EXPECT_EQ(vec.size(), 10);
+    EXPECT_EQ(RelocatableObject::move_calls, 0);
+    EXPECT_EQ(RelocatableObject::destructor_calls, 1);
+
+    int expected[] = {0, 1, 3, 4, 5, 6, 7, 8, 9, 10};
+    for (size_t i = 0; i < vec.size(); ++i)
+    {
+        EXPECT_EQ(vec[i].value, expected[i]);
+    }
+}
+
+TEST_F(TriviallyRelocatableTest, EraseRangeAcrossPages)
+{
+    constexpr size_t PAGE_SIZE = 4;
+    chunked_vector<RelocatableObject, PAGE_SIZE> vec;
+    for (int i = 0; i < 15; ++i)
+    {
+        vec.emplace_back(i);
+    }
+
+    // Erase [3, 9) - source and destination segments straddle different page offsets
+    auto result_it = vec.erase(advance_iterator(vec.begin(), 3), advance_iterator(vec.begin(), 9));
+    EXPECT_EQ(result_it->value, 9);
+    EXPECT_EQ(vec.size(), 9);
+    EXPECT_EQ(RelocatableObject::move_calls, 0);
+    EXPECT_EQ(RelocatableObject::destructor_calls, 6);
+
+    int expected[] = {0, 1, 2, 9, 10, 11, 12, 13, 14};
+    for (size_t i = 0; i < vec.size(); ++i)
+    {
+        EXPECT_EQ(vec[i].value, expected[i]);
+    }
+
+    vec.clear();
+    EXPECT_EQ(RelocatableObject::destructor_calls, 15);
+}
+
+TEST_F(TriviallyRelocatableTest, EraseUnsortedRelocatesLastElement)
+{
+    constexpr size_t PAGE_SIZE = 4;
+    chunked_vector<RelocatableObject, PAGE_SIZE> vec;
+    for (int i = 0; i < 9; ++i)
+    {
+        vec.emplace_back(i);
+    }
+
+    auto result_it = vec.erase_unsorted(advance_iterator(vec.begin(), 1));
+    EXPECT_EQ(result_it->value, 8);
+    EXPECT_EQ(vec.size(), 8);
+    EXPECT_EQ(RelocatableObject::move_calls, 0);
+    EXPECT_EQ(RelocatableObject::destructor_calls, 1);
+    EXPECT_EQ(vec[0].value, 0);
+    EXPECT_EQ(vec[1].value, 8);
+    EXPECT_EQ(vec[7].value, 7);
+}
+
+TEST_F(TriviallyRelocatableTest, UniquePtrErase)
+{
+    constexpr size_t PAGE_SIZE = 8;
+    chunked_vector<std::unique_ptr<int>, PAGE_SIZE> vec;
+    for (int i = 0; i < 40; ++i)
+    {
+        vec.push_back(std::make_unique<int>(i));
+    }
+
+    vec.erase(vec.begin());
+    vec.erase(advance_iterator(vec.begin(), 5), advance_iterator(vec.begin(), 20));
+    auto it = vec.erase_unsorted(advance_iterator(vec.begin(), 2));
+    EXPECT_EQ(**it, 39);
+
+    std::vector<int> expected = {1, 2, 39, 4, 5};
+    for (int i = 21; i < 39; ++i)
+    {
+        expected.push_back(i);
+    }
+
+    ASSERT_EQ(vec.size(), expected.size());
+    for (size_t i = 0; i < vec.size(); ++i)
+    {
+        ASSERT_NE(vec[i], nullptr);
+        EXPECT_EQ(*vec[i], expected[i]);
+    }
+}
+
+// ============================================================================
+// Capacity-Reusing Copy Assignment Tests
+// ============================================================================
+
+TEST_F(PageByPageOptimizationTest, CopyAssignmentReusesLivePrefix)
+{
+    constexpr size_t PAGE_SIZE = 4;
+    chunked_vector<TestObject, PAGE_SIZE> source;
+    chunked_vector<TestObject, PAGE_SIZE> dest;
+    for (int i = 0; i < 10; ++i)
+    {
+        source.emplace_back(i);
+    }
+    for (int i = 0; i < 6; ++i)
+    {
+        dest.emplace_back(-i);
+    }
+
+    TestObject::constructor_calls = 0;
+    TestObject::destructor_calls = 0;
+    TestObject::copy_calls = 0;
+
+    dest = source;
+
+    // 6 elements copy-assigned in place, 4 copy-constructed, nothing destroyed
+    EXPECT_EQ(TestObject::copy_calls, 10);
+    EXPECT_EQ(TestObject::destructor_calls, 0);
+    ASSERT_EQ(dest.size(), 10);
+    for (int i = 0; i < 10; ++i)
+    {
+        EXPECT_EQ(dest[i].value, i);
+    }
+}
+
+TEST_F(PageByPageOptimizationTest, CopyAssignmentDestroysSurplusAndKeepsPages)
+{
+    constexpr size_t PAGE_SIZE = 4;
+    chunked_vector<TestObject, PAGE_SIZE> source;
+    chunked_vector<TestObject, PAGE_SIZE> dest;
+    for (int i = 0; i < 3; ++i)
+    {
+        source.emplace_back(i + 100);
+    }
+    for (int i = 0; i < 13; ++i)
+    {
+        dest.emplace_back(i);
+    }
+    const size_t old_capacity = dest.capacity();
+
+    TestObject::destructor_calls = 0;
+    TestObject::copy_calls = 0;
+
+    dest = source;
+
+    EXPECT_EQ(TestObject::copy_calls, 3);
+    EXPECT_EQ(TestObject::destructor_calls, 10);
+    EXPECT_EQ(dest.capacity(), old_capacity);
+    ASSERT_EQ(dest.size(), 3);
+    EXPECT_EQ(dest[0].value, 100);
+    EXPECT_EQ(dest[2].value, 102);
+}
+
+TEST_F(PageByPageOptimizationTest, AssignWithReleaseExcessPolicy)
+{
+    constexpr size_t PAGE_SIZE = 4;
+    chunked_vector<TestObject, PAGE_SIZE> source;
+    chunked_vector<TestObject, PAGE_SIZE> dest;
+    for (int i = 0; i < 5; ++i)
+    {
+        source.emplace_back(i);
+    }
+    for (int i = 0; i < 20; ++i)
+    {
+        dest.emplace_back(i);
+    }
+    EXPECT_EQ(dest.capacity(), 20);
+
+    dest.assign(source, page_release_policy::release_excess);
+
+    EXPECT_EQ(dest.size(), 5);
+    EXPECT_EQ(dest.capacity(), 8);
+    EXPECT_TRUE(containers_equal(dest, source));
+
+    // Growing again after release must still work
+    dest.assign(chunked_vector<TestObject, PAGE_SIZE>(17, TestObject(7)), page_release_policy::release_excess);
+    EXPECT_EQ(dest.size(), 17);
+    EXPECT_EQ(dest.capacity(), 20);
+    EXPECT_EQ(dest[16].value, 7);
+}
+
+TEST_F(PageByPageOptimizationTest, AssignTrivialTypesWithPolicy)
+{
+    constexpr size_t PAGE_SIZE = 8;
+    chunked_vector<int, PAGE_SIZE> source(10, 3);
+    chunked_vector<int, PAGE_SIZE> dest(50, 1);
+
+    dest.assign(source, page_release_policy::keep);
+    EXPECT_EQ(dest.size(), 10);
+    EXPECT_EQ(dest.capacity(), 56);
+
+    dest.assign(source, page_release_policy::release_excess);
+    EXPECT_EQ(dest.size(), 10);
+    EXPECT_EQ(dest.capacity(), 16);
+    EXPECT_TRUE(containers_equal(dest, source));
+
+    // Self-assignment is a no-op
+    dest.assign(dest, page_release_policy::release_excess);
+    EXPECT_EQ(dest.size(), 10);
+    EXPECT_EQ(dest[9], 3);
+}
+
+// ============================================================================
+// Append / Split Off Tests
+// ============================================================================
+
+TEST_F(PageByPageOptimizationTest, AppendPageAlignedTransfersPages)
+{
+    constexpr size_t PAGE_SIZE = 4;
+    chunked_vector<TestObject, PAGE_SIZE> dst;
+    chunked_vector<TestObject, PAGE_SIZE> src;
+    for (int i = 0; i < 8; ++i)
+    {
+        dst.emplace_back(i);
+    }
+    for (int i = 8; i < 18; ++i)
+    {
+        src.emplace_back(i);
+    }
+    const TestObject* first_src_element = &src[0];
+    const TestObject* last_src_element = &src[9];
+
+    TestObject::copy_calls = 0;
+    TestObject::move_calls = 0;
+
+    dst.append(std::move(src));
+
+    // Pages were spliced by pointer - no element was copied or moved
+    EXPECT_EQ(TestObject::copy_calls, 0);
+    EXPECT_EQ(TestObject::move_calls, 0);
+    EXPECT_EQ(&dst[8], first_src_element);
+    EXPECT_EQ(&dst[17], last_src_element);
+
+    EXPECT_TRUE(src.empty());
+    ASSERT_EQ(dst.size(), 18);
+    for (int i = 0; i < 18; ++i)
+    {
+        EXPECT_EQ(dst[i].value, i);
+    }
+
+    // Both containers remain fully usable
+    dst.emplace_back(18);
+    EXPECT_EQ(dst.back().value, 18);
+    src.emplace_back(100);
+    EXPECT_EQ(src.size(), 1);
+    EXPECT_EQ(src[0].value, 100);
+}
+
+TEST_F(PageByPageOptimizationTest, AppendKeepsSparePages)
+{
+    constexpr size_t PAGE_SIZE = 4;
+    chunked_vector<int, PAGE_SIZE> dst;
+    chunked_vector<int, PAGE_SIZE> src;
+    dst.reserve(20);
+    src.reserve(20);
+    for (int i = 0; i < 4; ++i)
+    {
+        dst.push_back(i);
+    }
+    for (int i = 4; i < 10; ++i)
+    {
+        src.push_back(i);
+    }
+
+    dst.append(std::move(src));
+
+    // dst keeps its 4 spare pages and gains 2 live ones, src keeps its 3 spare pages
+    EXPECT_EQ(dst.size(), 10);
+    EXPECT_EQ(dst.capacity(), 28);
+    EXPECT_EQ(src.size(), 0);
+    EXPECT_EQ(src.capacity(), 12);
+
+    for (int i = 10; i < 28; ++i)
+    {
+        dst.push_back(i);
+    }
+    EXPECT_EQ(dst.capacity(), 28);
+    for (int i = 0; i < 28; ++i)
+    {
+        EXPECT_EQ(dst[i], i);
+    }
+}
+
+TEST_F(PageByPageOptimizationTest, AppendUnalignedRelocatesElements)
+{
+    constexpr size_t PAGE_SIZE = 4;
+    chunked_vector<TestObject, PAGE_SIZE> dst;
+    chunked_vector<TestObject, PAGE_SIZE> src;
+    for (int i = 0; i < 5; ++i)
+    {
+        dst.emplace_back(i);
+    }
+    for (int i = 5; i < 15; ++i)
+    {
+        src.emplace_back(i);
+    }
+
+    TestObject::copy_calls = 0;
+    TestObject::destructor_calls = 0;
+
+    dst.append(std::move(src));
+
+    EXPECT_EQ(TestObject::copy_calls, 0);
+    EXPECT_EQ(TestObject::destructor_calls, 10); // moved-from sources destroyed
+    EXPECT_TRUE(src.empty());
+    ASSERT_EQ(dst.size(), 15);
+    for (int i = 0; i < 15; ++i)
+    {
+        EXPECT_EQ(dst[i].value, i);
+    }
+}
+
+TEST_F(PageByPageOptimizationTest, AppendEdgeCases)
+{
+    constexpr size_t PAGE_SIZE = 4;
+    chunked_vector<int, PAGE_SIZE> dst;
+    chunked_vector<int, PAGE_SIZE> src;
+
+    // Empty into empty
+    dst.append(std::move(src));
+    EXPECT_TRUE(dst.empty());
+
+    // Into empty
+    src = {1, 2, 3};
+    dst.append(std::move(src));
+    EXPECT_EQ(dst.size(), 3);
+    EXPECT_TRUE(src.empty());
+
+    // Empty into non-empty
+    dst.append(std::move(src));
+    EXPECT_EQ(dst.size(), 3);
+    EXPECT_EQ(dst[2], 3);
+}
+
+TEST_F(PageByPageOptimizationTest, SplitOffPageAligned)
+{
+    constexpr size_t PAGE_SIZE = 4;
+    chunked_vector<TestObject, PAGE_SIZE> vec;
+    for (int i = 0; i < 14; ++i)
+    {
+        vec.emplace_back(i);
+    }
+    const TestObject* element_8 = &vec[8];
+
+    TestObject::copy_calls = 0;
+    TestObject::move_calls = 0;
+
+    auto tail = vec.split_off(8);
+
+    EXPECT_EQ(TestObject::copy_calls, 0);
+    EXPECT_EQ(TestObject::move_calls, 0);
+    EXPECT_EQ(&tail[0], element_8);
+    ASSERT_EQ(vec.size(), 8);
+    ASSERT_EQ(tail.size(), 6);
+    for (int i = 0; i < 8; ++i)
+    {
+        EXPECT_EQ(vec[i].value, i);
+    }
+    for (int i = 0; i < 6; ++i)
+    {
+        EXPECT_EQ(tail[i].value, i + 8);
+    }
+
+    // Round trip restores the original sequence
+    vec.append(std::move(tail));
+    ASSERT_EQ(vec.size(), 14);
+    for (int i = 0; i < 14; ++i)
+    {
+        EXPECT_EQ(vec[i].value, i);
+    }
+}
+
+TEST_F(PageByPageOptimizationTest, SplitOffUnaligned)
+{
+    constexpr size_t PAGE_SIZE = 4;
+    chunked_vector<std::unique_ptr<int>, PAGE_SIZE> vec;
+    for (int i = 0; i < 13; ++i)
+    {
+        vec.push_back(std::make_unique<int>(i));
+    }
+
+    auto tail = vec.split_off(3);
+    ASSERT_EQ(vec.size(), 3);
+    ASSERT_EQ(tail.size(), 10);
+    for (int i = 0; i < 3; ++i)
+    {
+        EXPECT_EQ(*vec[i], i);
+    }
+    for (int i = 0; i < 10; ++i)
+    {
+        EXPECT_EQ(*tail[i], i + 3);
+    }
+
+    // Splitting at the end yields an empty container, at the beginning takes everything
+    auto empty_tail = vec.split_off(vec.size());
+    EXPECT_TRUE(empty_tail.empty());
+    auto everything = tail.split_off(0);
+    EXPECT_TRUE(tail.empty());
+    EXPECT_EQ(everything.size(), 10);
+    EXPECT_EQ(*everything[9], 12);
+
+    vec.push_back(std::make_unique<int>(3));
+    EXPECT_EQ(*vec[3], 3);
+}
+
+// ============================================================================
+// Page Segment Tests
+// ============================================================================
+
+TEST_F(PageByPageOptimizationTest, SegmentsCoverEveryPage)
+{
+    constexpr size_t PAGE_SIZE = 4;
+    chunked_vector<int, PAGE_SIZE> vec;
+    EXPECT_EQ(vec.segment_count(), 0);
+
+    vec.reserve(20);
+    for (int i = 0; i < 10; ++i)
+    {
+        vec.push_back(i);
+    }
+    // Reserved but unused pages are not segments
+    ASSERT_EQ(vec.segment_count(), 3);
+
+    int expected = 0;
+    for (size_t segment_idx = 0; segment_idx < vec.segment_count(); ++segment_idx)
+    {
+        auto segment = vec.segment(segment_idx);
+        EXPECT_EQ(segment.size, segment_idx < 2 ? 4u : 2u);
+        EXPECT_EQ(segment.data, &vec[segment_idx * PAGE_SIZE]);
+        for (int value : segment)
+        {
+            EXPECT_EQ(value, expected++);
+        }
+    }
+    EXPECT_EQ(expected, 10);
+
+    vec.segment(1)[2] = 100;
+    EXPECT_EQ(vec[6], 100);
+
+    const auto& cvec = vec;
+    page_segment<const int> last = cvec.segment(2);
+    EXPECT_EQ(last[1], 9);
+}
+
+// ============================================================================
+// Streaming Store Tests
+// ============================================================================
+
+TEST_F(PageByPageOptimizationTest, StreamingHelpersHandleUnalignedEdges)
+{
+    alignas(16) unsigned char source[256];
+    for (size_t i = 0; i < sizeof(source); ++i)
+    {
+        source[i] = static_cast<unsigned char>(i * 7 + 1);
+    }
+
+    for (size_t offset = 0; offset < 16; ++offset)
+    {
+        for (size_t bytes : {0u, 1u, 15u, 16u, 17u, 63u, 64u, 100u, 200u})
+        {
+            alignas(16) unsigned char buffer[256 + 32] = {};
+            detail::stream_copy(buffer + offset, source, bytes);
+            detail::streaming_fence();
+            EXPECT_EQ(std::memcmp(buffer + offset, source, bytes), 0) << "offset " << offset << " bytes " << bytes;
+            EXPECT_EQ(buffer[offset + bytes], 0);
+        }
+    }
+
+    const uint16_t u16 = 0xBEEF;
+    const uint32_t u32 = 0xDEADBEEF;
+    const uint64_t u64 = 0x0123456789ABCDEFull;
+    const std::pair<uint64_t, uint64_t> u128(1, 2);
+    auto check_fill = [](const auto& value, size_t element_offset, size_t count) {
+        using V = std::decay_t<decltype(value)>;
+        alignas(16) V buffer[64 + 2] = {};
+        detail::stream_fill(buffer + element_offset, &value, sizeof(V), count);
+        detail::streaming_fence();
+        for (size_t i = 0; i < count; ++i)
+        {
+            EXPECT_EQ(std::memcmp(&buffer[element_offset + i], &value, sizeof(V)), 0) << "element " << i;
+        }
+        EXPECT_EQ(buffer[element_offset + count], V{});
+    };
+    for (size_t element_offset : {0u, 1u})
+    {
+        for (size_t count : {0u, 1u, 3u, 9u, 33u, 64u})
+        {
+            check_fill(static_cast<unsigned char>(0x5A), element_offset, count);
+            check_fill(u16, element_offset, count);
+            check_fill(u32, element_offset, count);
+            check_fill(u64, element_offset, count);
+            check_fill(u128, element_offset, count);
+        }
+    }
+}
+
+TEST_F(PageByPageOptimizationTest, BulkOperationsAboveStreamingThreshold)
+{
+    // Large enough to take the streaming path with the default threshold; odd size leaves a partial page
+    constexpr size_t count = CHUNKED_VEC_STREAMING_STORE_THRESHOLD / sizeof(uint32_t) + 7;
+    ASSERT_TRUE(detail::use_streaming_stores(count * sizeof(uint32_t)) || !CHUNKED_VEC_HAS_STREAMING_STORES);
+
+    chunked_vector<uint32_t, 1000> filled(count, 0xA5A5A5A5u);
+    chunked_vector<uint32_t, 1000> zeroed(count);
+    for (size_t segment_idx = 0; segment_idx < filled.segment_count(); ++segment_idx)
+    {
+        for (uint32_t value : filled.segment(segment_idx))
+        {
+            ASSERT_EQ(value, 0xA5A5A5A5u);
+        }
+        for (uint32_t value : zeroed.segment(segment_idx))
+        {
+            ASSERT_EQ(value, 0u);
+        }
+    }
+
+    for (size_t i = 0; i < count; i += 4099)
+    {
+        filled[i] = static_cast<uint32_t>(i);
+    }
+    chunked_vector<uint32_t, 1000> copy(filled);
+    ASSERT_EQ(copy.size(), count);
+    for (size_t segment_idx = 0; segment_idx < filled.segment_count(); ++segment_idx)
+    {
+        auto src = filled.segment(segment_idx);
+        auto dst = copy.segment(segment_idx);
+        ASSERT_EQ(std::memcmp(dst.data, src.data, src.size * sizeof(uint32_t)), 0);
+    }
+}
+
+// ============================================================================
+// Gather / Scatter Tests
+// ============================================================================
+
+TEST_F(PageByPageOptimizationTest, GatherMatchesIndexing)
+{
+    constexpr size_t PAGE_SIZE = 16;
+    chunked_vector<int, PAGE_SIZE> vec;
+    for (int i = 0; i < 1000; ++i)
+    {
+        vec.push_back(i * 3);
+    }
+
+    std::mt19937 rng(7);
+    std::vector<uint32_t> indices(500);
+    for (uint32_t& index : indices)
+    {
+        index = static_cast<uint32_t>(rng() % vec.size());
+    }
+    indices[0] = 999;
+    indices[1] = 0;
+
+    for (batch_order order : {batch_order::as_given, batch_order::group_by_page})
+    {
+        std::vector<int> out(indices.size(), -1);
+        vec.gather(indices.data(), indices.size(), out.data(), order);
+        for (size_t i = 0; i < indices.size(); ++i)
+        {
+            EXPECT_EQ(out[i], vec[indices[i]]) << "batch position " << i;
+        }
+    }
+
+    // Empty and single-element batches
+    int single = -1;
+    vec.gather(indices.data(), 0, &single, batch_order::group_by_page);
+    EXPECT_EQ(single, -1);
+    vec.gather(indices.data(), 1, &single, batch_order::group_by_page);
+    EXPECT_EQ(single, 999 * 3);
+}
+
+TEST_F(PageByPageOptimizationTest, ScatterLastDuplicateWins)
+{
+    constexpr size_t PAGE_SIZE = 8;
+    for (batch_order order : {batch_order::as_given, batch_order::group_by_page})
+    {
+        chunked_vector<int, PAGE_SIZE> vec(50, 0);
+        const std::vector<size_t> indices = {49, 3, 20, 3, 0, 20, 41};
+        const std::vector<int> values = {1, 2, 3, 4, 5, 6, 7};
+        vec.scatter(indices.data(), indices.size(), values.data(), order);
+
+        EXPECT_EQ(vec[49], 1);
+        EXPECT_EQ(vec[3], 4);
+        EXPECT_EQ(vec[20], 6);
+        EXPECT_EQ(vec[0], 5);
+        EXPECT_EQ(vec[41], 7);
+        EXPECT_EQ(vec[1], 0);
+    }
+}
+
+TEST_F(PageByPageOptimizationTest, GatherScatterAssignInPlace)
+{
+    chunked_vector<TestObject, 4> vec;
+    for (int i = 0; i < 20; ++i)
+    {
+        vec.emplace_back(i);
+    }
+    const std::vector<uint16_t> indices = {19, 2, 7, 2};
+    std::vector<TestObject> out(indices.size());
+    const std::vector<TestObject> values = {TestObject(100), TestObject(200), TestObject(300), TestObject(400)};
+
+    const int constructed = TestObject::constructor_calls + TestObject::copy_calls + TestObject::move_calls;
+    const int destroyed = TestObject::destructor_calls;
+    vec.gather(indices.data(), indices.size(), out.data(), batch_order::group_by_page);
+    vec.scatter(indices.data(), indices.size(), values.data(), batch_order::group_by_page);
+
+    // One copy assignment per batch entry, no temporaries
+    EXPECT_EQ(TestObject::constructor_calls + TestObject::copy_calls + TestObject::move_calls, constructed + 8);
+    EXPECT_EQ(TestObject::destructor_calls, destroyed);
+    EXPECT_EQ(out[0].value, 19);
+    EXPECT_EQ(out[3].value, 2);
+    EXPECT_EQ(vec[19].value, 100);
+    EXPECT_EQ(vec[2].value, 400);
+    EXPECT_EQ(vec[7].value, 300);
+}
+
+TEST_F(PageByPageOptimizationTest, GatherRejectsOutOfRangeIndexBeforeUsingIt)
+{
+    chunked_vector<int, 16> vec(100, 1);
+    std::vector<uint32_t> indices(64, 5);
+    // Far past the page table, and inside the prefetch window of the first batch position
+    indices[10] = 1u << 20;
+
+    for (batch_order order : {batch_order::as_given, batch_order::group_by_page})
+    {
+        std::vector<int> out(indices.size(), -1);
+        EXPECT_THROW(vec.gather(indices.data(), indices.size(), out.data(), order), test_assertions::AssertionException);
+    }
+}
+
+// ============================================================================
+// Small First Page Tests
+// ============================================================================
+
+TEST_F(PageByPageOptimizationTest, SmallFirstPageDoublesThenPromotes)
+{
+    chunked_vector<int, 64, 4> vec;
+    EXPECT_EQ(vec.capacity(), 0u);
+
+    std::vector<size_t> capacities;
+    for (int i = 0; i < 200; ++i)
+    {
+        vec.push_back(i);
+        if (capacities.empty() || capacities.back() != vec.capacity())
+        {
+            capacities.push_back(vec.capacity());
+        }
+    }
+    EXPECT_EQ(capacities, (std::vector<size_t>{4, 8, 16, 32, 64, 128, 192, 256}));
+    for (int i = 0; i < 200; ++i)
+    {
+        ASSERT_EQ(vec[i], i);
+    }
+    EXPECT_EQ(vec.segment_count(), 4u);
+    EXPECT_EQ(vec.segment(3).size, 200u - 3 * 64);
+}
+
+TEST_F(PageByPageOptimizationTest, SmallFirstPageIteration)
+{
+    // Sizes on both sides of every small capacity, including a completely full small page
+    for (size_t count : {0u, 1u, 3u, 4u, 5u, 8u, 9u, 31u, 32u, 33u, 64u, 100u})
+    {
+        SCOPED_TRACE(count);
+        chunked_vector<int, 64, 4> vec;
+        for (size_t i = 0; i < count; ++i)
+        {
+            vec.push_back(static_cast<int>(i));
+        }
+
+        size_t visited = 0;
+        for (auto it = vec.begin(); it != vec.end(); ++it)
+        {
+            EXPECT_EQ(*it, static_cast<int>(visited));
+            EXPECT_EQ(vec.index_of(it), visited);
+            ++visited;
+        }
+        EXPECT_EQ(visited, count);
+        EXPECT_EQ(vec.index_of(vec.end()), count);
+    }
+}
+
+TEST_F(PageByPageOptimizationTest, SmallFirstPageNonPowerOfTwoPageSize)
+{
+    chunked_vector<int, 100, 8> vec;
+    std::vector<size_t> capacities;
+    for (int i = 0; i < 150; ++i)
+    {
+        vec.push_back(i);
+        if (capacities.empty() || capacities.back() != vec.capacity())
+        {
+            capacities.push_back(vec.capacity());
+        }
+    }
+    EXPECT_EQ(capacities, (std::vector<size_t>{8, 16, 32, 64, 100, 200}));
+    EXPECT_EQ(vec[99], 99);
+    EXPECT_EQ(vec[149], 149);
+}
+
+TEST_F(PageByPageOptimizationTest, SmallFirstPageReserveAndShrink)
+{
+    chunked_vector<int, 64, 4> vec;
+    vec.reserve(10);
+    EXPECT_EQ(vec.capacity(), 16u);
+    vec.reserve(65);
+    EXPECT_EQ(vec.capacity(), 128u);
+
+    for (int i = 0; i < 5; ++i)
+    {
+        vec.push_back(i);
+    }
+    vec.shrink_to_fit();
+    EXPECT_EQ(vec.capacity(), 8u);
+    EXPECT_EQ(vec[4], 4);
+
+    vec.clear();
+    vec.shrink_to_fit();
+    EXPECT_EQ(vec.capacity(), 0u);
+    vec.push_back(7);
+    EXPECT_EQ(vec.capacity(), 4u);
+    EXPECT_EQ(vec[0], 7);
+}
+
+TEST_F(PageByPageOptimizationTest, SmallFirstPageCopyMoveAndResize)
+{
+    chunked_vector<TestObject, 64, 2> vec;
+    for (int i = 0; i < 6; ++i)
+    {
+        vec.emplace_back(i);
+    }
+
+    chunked_vector<TestObject, 64, 2> copy(vec);
+    EXPECT_EQ(copy.capacity(), 8u);
+    EXPECT_EQ(copy[5].value, 5);
+
+    chunked_vector<TestObject, 64, 2> moved(std::move(copy));
+    EXPECT_EQ(moved.capacity(), 8u);
+    EXPECT_EQ(moved[5].value, 5);
+
+    moved.resize(70, TestObject(9));
+    EXPECT_EQ(moved.capacity(), 128u);
+    EXPECT_EQ(moved[5].value, 5);
+    EXPECT_EQ(moved[69].value, 9);
+
+    moved.erase(moved.begin());
+    EXPECT_EQ(moved[0].value, 1);
+    EXPECT_EQ(moved.size(), 69u);
+
+    vec = moved;
+    EXPECT_EQ(vec.size(), 69u);
+    EXPECT_EQ(vec[68].value, 9);
+}
+
+TEST_F(PageByPageOptimizationTest, SmallFirstPageAppendAndSplit)
+{
+    using small_vector = chunked_vector<TestObject, 8, 2>;
+    auto make = [](int first, int count) {
+        small_vector vec;
+        for (int i = 0; i < count; ++i)
+        {
+            vec.emplace_back(first + i);
+        }
+        return vec;
+    };
+
+    {
+        // Empty receiver with a small page, small donor
+        small_vector vec;
+        vec.reserve(1);
+        vec.append(make(0, 3));
+        ASSERT_EQ(vec.size(), 3u);
+        EXPECT_EQ(vec[2].value, 2);
+    }
+    {
+        // Page-aligned seam: whole pages are spliced in, the small donor is relocated
+        small_vector vec = make(0, 8);
+        vec.append(make(8, 3));
+        vec.append(make(11, 13));
+        ASSERT_EQ(vec.size(), 24u);
+        for (int i = 0; i < 24; ++i)
+        {
+            EXPECT_EQ(vec[i].value, i);
+        }
+    }
+    {
+        // Splitting a small first page at 0 relocates instead of handing over the page
+        small_vector vec = make(0, 3);
+        small_vector tail = vec.split_off(0);
+        EXPECT_TRUE(vec.empty());
+        ASSERT_EQ(tail.size(), 3u);
+        EXPECT_EQ(tail[2].value, 2);
+        tail.push_back(TestObject(3));
+        EXPECT_EQ(tail[3].value, 3);
+
+        small_vector big = make(0, 20);
+        small_vector big_tail = big.split_off(8);
+        EXPECT_EQ(big.size(), 8u);
+        ASSERT_EQ(big_tail.size(), 12u);
+        EXPECT_EQ(big_tail[11].value, 19);
+    }
+
+    EXPECT_EQ(TestObject::constructor_calls + TestObject::copy_calls + TestObject::move_calls, TestObject::destructor_calls);
+}
+
+TEST_F(PageByPageOptimizationTest, SmallFirstPageFootprint)
+{
+    chunked_vector<int, 1024, 8> small;
+    for (int i = 0; i < 5; ++i)
+    {
+        small.push_back(i);
+    }
+    // An 8-element first page (32 bytes) instead of a 4 KB page
+    EXPECT_EQ(small.capacity(), 8u);
+
+    chunked_vector<int, 1024> regular;
+    regular.push_back(0);
+    EXPECT_EQ(regular.capacity(), 1024u);
+}
+
+TEST_F(PageByPageOptimizationTest, SmallFirstPagePushBackOwnElement)
+{
+    // Each push_back below fills the small first page, so growing it must not free the argument first
+    chunked_vector<int, 1024, 2> vec;
+    vec.push_back(7);
+    vec.push_back(8);
+    vec.push_back(vec[0]);
+    vec.push_back(vec[2]);
+    vec.emplace_back(vec[1]);
+    ASSERT_EQ(vec.size(), 5u);
+    EXPECT_EQ(vec[2], 7);
+    EXPECT_EQ(vec[3], 7);
+    EXPECT_EQ(vec[4], 8);
+
+    const std::string long_text(64, 'x');
+    chunked_vector<std::string, 1024, 2> strings;
+    strings.push_back(long_text);
+    strings.push_back("second");
+    strings.push_back(strings[0]);
+    strings.resize(9, strings[1]);
+    ASSERT_EQ(strings.size(), 9u);
+    EXPECT_EQ(strings[2], long_text);
+    EXPECT_EQ(strings[8], "second");
+}
+
+// ============================================================================
+// Inline Capacity Tests
+// ============================================================================
+
+template <typename Vector> bool stored_inline(const Vector& vec, size_t index)
+{
+    const char* object = reinterpret_cast<const char*>(&vec);
+    const char* element = reinterpret_cast<const char*>(&vec[index]);
+    return element >= object && element < object + sizeof(Vector);
+}
+
+TEST_F(PageByPageOptimizationTest, InlineCapacityAvoidsHeapUntilExceeded)
+{
+    chunked_vector<int, 64, 64, 8> vec;
+    EXPECT_GT(sizeof(vec), sizeof(chunked_vector<int, 64>) + 8 * sizeof(int));
+    EXPECT_EQ(vec.capacity(), 0u);
+    vec.reserve(5);
+    EXPECT_EQ(vec.capacity(), 8u);
+
+    for (int i = 0; i < 8; ++i)
+    {
+        vec.push_back(i);
+    }
+    EXPECT_EQ(vec.capacity(), 8u);
+    for (int i = 0; i < 8; ++i)
+    {
+        EXPECT_TRUE(stored_inline(vec, i));
+        EXPECT_EQ(vec[i], i);
+    }
+
+    // The ninth element moves the first page to the heap as a full page
+    vec.push_back(8);
+    EXPECT_EQ(vec.capacity(), 64u);
+    EXPECT_FALSE(stored_inline(vec, 0));
+    for (int i = 0; i < 100; ++i)
+    {
+        if (i > 8)
+        {
+            vec.push_back(i);
+        }
+        ASSERT_EQ(vec[i], i);
+    }
+
+    int expected = 0;
+    for (int value : vec)
+    {
+        EXPECT_EQ(value, expected++);
+    }
+    EXPECT_EQ(expected, 100);
+}
+
+TEST_F(PageByPageOptimizationTest, InlineCapacityPushBackOwnElement)
+{
+    // The third element moves the inline page to the heap; the argument is read before the inline elements move
+    const std::string long_text(64, 'y');
+    chunked_vector<std::string, 1024, 1024, 2> vec;
+    vec.emplace_back("first");
+    vec.emplace_back(long_text);
+    vec.emplace_back(vec[1]);
+    ASSERT_EQ(vec.size(), 3u);
+    EXPECT_FALSE(stored_inline(vec, 0));
+    EXPECT_EQ(vec[1], long_text);
+    EXPECT_EQ(vec[2], long_text);
+
+    chunked_vector<std::string, 1024, 1024, 2> resized;
+    resized.emplace_back(long_text);
+    resized.resize(5, resized[0]);
+    ASSERT_EQ(resized.size(), 5u);
+    EXPECT_EQ(resized[4], long_text);
+}
+
+TEST_F(PageByPageOptimizationTest, InlineCapacityThenSmallFirstPage)
+{
+    chunked_vector<int, 64, 4, 6> vec;
+    std::vector<size_t> capacities;
+    for (int i = 0; i < 100; ++i)
+    {
+        vec.push_back(i);
+        if (capacities.empty() || capacities.back() != vec.capacity())
+        {
+            capacities.push_back(vec.capacity());
+        }
+    }
+    EXPECT_EQ(capacities, (std::vector<size_t>{6, 8, 16, 32, 64, 128}));
+    for (int i = 0; i < 100; ++i)
+    {
+        ASSERT_EQ(vec[i], i);
+    }
+}
+
+TEST_F(PageByPageOptimizationTest, InlineCapacityCopyMoveAndSwap)
+{
+    using inline_vector = chunked_vector<TestObject, 16, 16, 4>;
+    {
+        inline_vector vec;
+        for (int i = 0; i < 3; ++i)
+        {
+            vec.emplace_back(i);
+        }
+
+        inline_vector copy(vec);
+        ASSERT_EQ(copy.size(), 3u);
+        EXPECT_TRUE(stored_inline(copy, 0));
+        EXPECT_EQ(copy[2].value, 2);
+
+        inline_vector moved(std::move(copy));
+        EXPECT_TRUE(copy.empty());
+        ASSERT_EQ(moved.size(), 3u);
+        EXPECT_TRUE(stored_inline(moved, 2));
+        EXPECT_EQ(moved[2].value, 2);
+
+        // The moved-from container is usable again
+        copy.emplace_back(42);
+        EXPECT_TRUE(stored_inline(copy, 0));
+        EXPECT_EQ(copy[0].value, 42);
+
+        inline_vector big;
+        for (int i = 0; i < 40; ++i)
+        {
+            big.emplace_back(100 + i);
+        }
+        std::swap(moved, big);
+        ASSERT_EQ(moved.size(), 40u);
+        ASSERT_EQ(big.size(), 3u);
+        EXPECT_EQ(moved[39].value, 139);
+        EXPECT_TRUE(stored_inline(big, 0));
+        EXPECT_EQ(big[1].value, 1);
+
+        inline_vector big_copy(moved);
+        ASSERT_EQ(big_copy.size(), 40u);
+        EXPECT_EQ(big_copy[20].value, 120);
+        moved = std::move(vec);
+        ASSERT_EQ(moved.size(), 3u);
+        EXPECT_TRUE(stored_inline(moved, 0));
+        EXPECT_EQ(moved[0].value, 0);
+    }
+    EXPECT_EQ(TestObject::constructor_calls + TestObject::copy_calls + TestObject::move_calls, TestObject::destructor_calls);
+}
+
+TEST_F(PageByPageOptimizationTest, InlineCapacityShrinkAppendAndSplit)
+{
+    using inline_vector = chunked_vector<TestObject, 8, 8, 4>;
+    {
+        inline_vector vec;
+        for (int i = 0; i < 20; ++i)
+        {
+            vec.emplace_back(i);
+        }
+        vec.resize(3);
+        vec.shrink_to_fit();
+        EXPECT_EQ(vec.capacity(), 4u);
+        EXPECT_TRUE(stored_inline(vec, 0));
+        EXPECT_EQ(vec[2].value, 2);
+
+        inline_vector other;
+        for (int i = 3; i < 12; ++i)
+        {
+            other.emplace_back(i);
+        }
+        vec.append(std::move(other));
+        ASSERT_EQ(vec.size(), 12u);
+        for (int i = 0; i < 12; ++i)
+        {
+            EXPECT_EQ(vec[i].value, i);
+        }
+
+        inline_vector tail = vec.split_off(2);
+        EXPECT_EQ(vec.size(), 2u);
+        ASSERT_EQ(tail.size(), 10u);
+        EXPECT_EQ(tail[9].value, 11);
+
+        inline_vector small_tail = tail.split_off(7);
+        ASSERT_EQ(small_tail.size(), 3u);
+        EXPECT_TRUE(stored_inline(small_tail, 0));
+        EXPECT_EQ(small_tail[2].value, 11);
+    }
+    EXPECT_EQ(TestObject::constructor_calls + TestObject::copy_calls + TestObject::move_calls, TestObject::destructor_calls);
+}
+
+// ============================================================================
+// Size Type Tests
+// ============================================================================
+
+TEST_F(PageByPageOptimizationTest, CompactSizeTypeShrinksContainer)
+{
+    using compact_vector = chunked_vector<int, 1024, 1024, 0, uint32_t>;
+    static_assert(std::is_same_v<compact_vector::size_type, uint32_t>);
+    EXPECT_LT(sizeof(compact_vector), sizeof(chunked_vector<int>));
+
+    // Capped so that every element index fits, rounded down to whole pages
+    compact_vector vec;
+    EXPECT_EQ(vec.max_size(), (std::numeric_limits<uint32_t>::max() / 1024u) * 1024u);
+    using tiny_vector = chunked_vector<uint8_t, 1000, 1000, 0, uint16_t>;
+    EXPECT_EQ(tiny_vector().max_size(), 65000u);
+    EXPECT_GT(chunked_vector<int>().max_size(), size_t(std::numeric_limits<uint32_t>::max()));
+}
+
+TEST_F(PageByPageOptimizationTest, DefaultConfigurationKeepsPlainLayout)
+{
+    // Only a small or inline first page stores its capacity; the default layout is a page table pointer and three sizes
+#if CHUNKED_VEC_ITERATOR_DEBUG_LEVEL > 0
+    constexpr size_t debug_bytes = sizeof(void*);
+#else
+    constexpr size_t debug_bytes = 0;
+#endif
+    static_assert(sizeof(chunked_vector<int>) == sizeof(int**) + 3 * sizeof(size_t) + debug_bytes);
+    static_assert(sizeof(chunked_vector<int, 64>) == sizeof(chunked_vector<int>));
+    static_assert(sizeof(chunked_vector<int, 64, 8>) == sizeof(chunked_vector<int>) + sizeof(size_t));
+}
+
+TEST_F(PageByPageOptimizationTest, CompactSizeTypeOperations)
+{
+    using compact_vector = chunked_vector<TestObject, 100, 100, 0, uint32_t>;
+    compact_vector vec;
+    for (uint32_t i = 0; i < 1000; ++i)
+    {
+        vec.emplace_back(static_cast<int>(i));
+    }
+    ASSERT_EQ(vec.size(), 1000u);
+    EXPECT_EQ(vec[999].value, 999);
+    EXPECT_EQ(vec.segment_count(), 10u);
+
+    uint32_t visited = 0;
+    for (auto it = vec.cbegin(); it != vec.cend(); ++it)
+    {
+        EXPECT_EQ(vec.index_of(it), visited);
+        EXPECT_EQ(it->value, static_cast<int>(visited));
+        ++visited;
+    }
+    EXPECT_EQ(visited, 1000u);
+
+    vec.erase(std::next(vec.begin(), 10));
+    EXPECT_EQ(vec[10].value, 11);
+    EXPECT_EQ(vec.erase_unsorted(vec.begin())->value, 999);
+    EXPECT_EQ(vec[0].value, 999);
+
+    compact_vector tail = vec.split_off(500);
+    EXPECT_EQ(vec.size(), 500u);
+    EXPECT_EQ(tail.size(), 498u);
+    vec.append(std::move(tail));
+    EXPECT_EQ(vec.size(), 998u);
+
+    compact_vector copy(vec);
+    copy.resize(50);
+    copy.shrink_to_fit();
+    EXPECT_EQ(copy.capacity(), 100u);
+    EXPECT_EQ(copy[49].value, vec[49].value);
+
+    const uint32_t indices[] = {0, 250, 997};
+    TestObject out[3];
+    vec.gather(indices, 3, out, batch_order::group_by_page);
+    EXPECT_EQ(out[1].value, vec[250].value);
+    EXPECT_EQ(out[2].value, vec[997].value);
+}
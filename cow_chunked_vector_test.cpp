@@ -0,0 +1,554 @@
+#include "chunked_vector/cow_chunked_vector.h"
+#include "test_common.h"
+#include <gtest/gtest.h>
+#include <thread>
+
+using namespace dod;
+
+class CowChunkedVectorTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        TestObject::constructor_calls = 0;
+        TestObject::destructor_calls = 0;
+        TestObject::copy_calls = 0;
+        TestObject::move_calls = 0;
+    }
+    void TearDown() override {}
+};
+
+// ============================================================================
+// Basic Container Behavior
+// ============================================================================
+
+TEST_F(CowChunkedVectorTest, BasicOperations)
+{
+    cow_chunked_vector<int, 4> vec;
+    EXPECT_TRUE(vec.empty());
+    EXPECT_EQ(vec.capacity(), 0);
+
+    for (int i = 0; i < 10; ++i)
+    {
+        vec.push_back(i);
+    }
+    EXPECT_EQ(vec.size(), 10);
+    EXPECT_EQ(vec.capacity(), 12);
+    EXPECT_EQ(vec.front(), 0);
+    EXPECT_EQ(vec.back(), 9);
+    EXPECT_EQ(vec.at(5), 5);
+    EXPECT_THROW((void)vec.at(10), std::out_of_range);
+
+    vec.pop_back();
+    EXPECT_EQ(vec.size(), 9);
+    EXPECT_EQ(vec.back(), 8);
+
+    vec.resize(14, 7);
+    EXPECT_EQ(vec.size(), 14);
+    EXPECT_EQ(vec[13], 7);
+
+    vec.resize(3);
+    EXPECT_EQ(vec.size(), 3);
+
+    int expected = 0;
+    for (int value : vec)
+    {
+        EXPECT_EQ(value, expected++);
+    }
+
+    vec.clear();
+    EXPECT_TRUE(vec.empty());
+    EXPECT_EQ(vec.capacity(), 16); // private pages are kept
+}
+
+TEST_F(CowChunkedVectorTest, InitializerListAndCountConstructors)
+{
+    cow_chunked_vector<int, 4> list{1, 2, 3, 4, 5};
+    EXPECT_EQ(list.size(), 5);
+    EXPECT_EQ(list[4], 5);
+
+    cow_chunked_vector<int, 4> zeros(6);
+    EXPECT_EQ(zeros.size(), 6);
+    EXPECT_EQ(zeros[5], 0);
+
+    cow_chunked_vector<int, 4> filled(6, 9);
+    EXPECT_EQ(filled[0], 9);
+    EXPECT_EQ(filled[5], 9);
+}
+
+// ============================================================================
+// Snapshot Sharing
+// ============================================================================
+
+TEST_F(CowChunkedVectorTest, SnapshotSharesAllPages)
+{
+    cow_chunked_vector<int, 4> vec;
+    for (int i = 0; i < 16; ++i)
+    {
+        vec.push_back(i);
+    }
+
+    auto snap = vec.snapshot();
+    EXPECT_EQ(snap.size(), 16);
+    EXPECT_EQ(vec.shared_page_count(), 4);
+    EXPECT_EQ(snap.shared_page_count(), 4);
+
+    // Same storage until the first write
+    EXPECT_EQ(&vec.as_const()[5], &snap.as_const()[5]);
+}
+
+TEST_F(CowChunkedVectorTest, FirstWriteClonesOnlyTouchedPage)
+{
+    cow_chunked_vector<int, 4> vec;
+    for (int i = 0; i < 16; ++i)
+    {
+        vec.push_back(i);
+    }
+    auto snap = vec.snapshot();
+
+    vec[5] = 500;
+
+    EXPECT_EQ(vec[5], 500);
+    EXPECT_EQ(snap.as_const()[5], 5);
+    EXPECT_FALSE(vec.is_shared(5));
+    EXPECT_TRUE(vec.is_shared(0));
+    EXPECT_EQ(vec.shared_page_count(), 3);
+    EXPECT_EQ(snap.shared_page_count(), 3);
+
+    // Untouched pages still point to the same memory
+    EXPECT_EQ(&vec.as_const()[0], &snap.as_const()[0]);
+    EXPECT_NE(&vec.as_const()[4], &snap.as_const()[4]);
+
+    // Second write into the same page does not clone again
+    const int* page_element = &vec.as_const()[4];
+    vec[6] = 600;
+    EXPECT_EQ(&vec.as_const()[4], page_element);
+}
+
+TEST_F(CowChunkedVectorTest, SnapshotInvalidatesMutableReferences)
+{
+    cow_chunked_vector<int, 4> vec;
+    for (int i = 0; i < 8; ++i)
+    {
+        vec.push_back(i);
+    }
+    int& stale_ref = vec[1];
+    auto stale_it = vec.begin();
+
+    auto snap = vec.snapshot();
+
+    // References and iterators taken before the snapshot point into the now shared page
+    EXPECT_EQ(&stale_ref, &snap.as_const()[1]);
+    EXPECT_EQ(&*stale_it, &snap.as_const()[0]);
+
+    // Re-acquired ones clone the page first, so writes stay out of the snapshot
+    int& ref = vec[1];
+    EXPECT_NE(&ref, &stale_ref);
+    ref = 100;
+    *vec.begin() = 200;
+    EXPECT_EQ(vec.as_const()[0], 200);
+    EXPECT_EQ(vec.as_const()[1], 100);
+    EXPECT_EQ(snap.as_const()[0], 0);
+    EXPECT_EQ(snap.as_const()[1], 1);
+    EXPECT_EQ(vec.shared_page_count(), 1);
+}
+
+TEST_F(CowChunkedVectorTest, ConstAccessDoesNotClone)
+{
+    cow_chunked_vector<int, 4> vec(12, 1);
+    auto snap = vec.snapshot();
+
+    int sum = 0;
+    for (int value : vec.as_const())
+    {
+        sum += value;
+    }
+    for (auto it = vec.cbegin(); it != vec.cend(); ++it)
+    {
+        sum += *it;
+    }
+    const auto& const_vec = vec;
+    sum += const_vec[3] + const_vec.front() + const_vec.back() + const_vec.at(2);
+
+    EXPECT_EQ(sum, 28);
+    EXPECT_EQ(vec.shared_page_count(), 3);
+}
+
+TEST_F(CowChunkedVectorTest, MutableIterationClonesVisitedPages)
+{
+    cow_chunked_vector<int, 4> vec(12, 1);
+    auto snap = vec.snapshot();
+
+    auto it = vec.begin();
+    for (int i = 0; i < 5; ++i, ++it)
+    {
+        *it = 2;
+    }
+    // Pages 0 and 1 were entered by the mutable iterator
+    EXPECT_EQ(vec.shared_page_count(), 1);
+
+    for (; it != vec.end(); ++it)
+    {
+        *it = 3;
+    }
+    EXPECT_EQ(vec.shared_page_count(), 0);
+    EXPECT_EQ(vec[0], 2);
+    EXPECT_EQ(vec[11], 3);
+
+    for (int value : snap)
+    {
+        EXPECT_EQ(value, 1);
+    }
+}
+
+TEST_F(CowChunkedVectorTest, PushBackIntoSharedTailPage)
+{
+    cow_chunked_vector<int, 4> vec;
+    for (int i = 0; i < 6; ++i)
+    {
+        vec.push_back(i);
+    }
+    auto snap = vec.snapshot();
+
+    vec.push_back(6);
+    vec.push_back(7);
+    vec.push_back(8);
+
+    EXPECT_EQ(snap.size(), 6);
+    EXPECT_EQ(vec.size(), 9);
+    EXPECT_EQ(vec.shared_page_count(), 1);
+
+    // The snapshot can grow independently into its own copy of the tail page
+    snap.push_back(-6);
+    EXPECT_EQ(snap.as_const()[6], -6);
+    EXPECT_EQ(vec[6], 6);
+}
+
+TEST_F(CowChunkedVectorTest, ShrinkSharedPages)
+{
+    cow_chunked_vector<int, 4> vec;
+    for (int i = 0; i < 14; ++i)
+    {
+        vec.push_back(i);
+    }
+    auto snap = vec.snapshot();
+
+    vec.resize(6);
+    EXPECT_EQ(vec.size(), 6);
+    EXPECT_EQ(vec[5], 5);
+    EXPECT_EQ(snap.size(), 14);
+    EXPECT_EQ(snap.as_const()[13], 13);
+
+    vec.pop_back();
+    EXPECT_EQ(vec.size(), 5);
+    EXPECT_EQ(snap.as_const()[5], 5);
+
+    vec.clear();
+    EXPECT_TRUE(vec.empty());
+    for (int i = 0; i < 14; ++i)
+    {
+        EXPECT_EQ(snap.as_const()[i], i);
+    }
+
+    // Growing again after dropping shared pages
+    for (int i = 0; i < 20; ++i)
+    {
+        vec.push_back(i * 2);
+    }
+    EXPECT_EQ(vec[19], 38);
+    EXPECT_EQ(snap.as_const()[13], 13);
+}
+
+TEST_F(CowChunkedVectorTest, SnapshotOutlivesSource)
+{
+    cow_chunked_vector<int, 4> snap;
+    {
+        cow_chunked_vector<int, 4> vec;
+        for (int i = 0; i < 10; ++i)
+        {
+            vec.push_back(i);
+        }
+        snap = vec.snapshot();
+        vec[0] = 100;
+    }
+
+    EXPECT_EQ(snap.size(), 10);
+    EXPECT_EQ(snap.shared_page_count(), 0);
+    for (int i = 0; i < 10; ++i)
+    {
+        EXPECT_EQ(snap.as_const()[i], i);
+    }
+}
+
+TEST_F(CowChunkedVectorTest, CopyAndMoveSemantics)
+{
+    cow_chunked_vector<int, 4> vec{1, 2, 3, 4, 5};
+
+    cow_chunked_vector<int, 4> copy(vec);
+    EXPECT_EQ(copy.shared_page_count(), 2);
+
+    cow_chunked_vector<int, 4> moved(std::move(copy));
+    EXPECT_TRUE(copy.empty());
+    EXPECT_EQ(moved.size(), 5);
+    EXPECT_EQ(vec.shared_page_count(), 2);
+
+    cow_chunked_vector<int, 4> assigned;
+    assigned = moved;
+    EXPECT_EQ(vec.shared_page_count(), 2);
+    assigned = std::move(moved);
+    EXPECT_EQ(assigned[4], 5);
+
+    assigned = assigned;
+    EXPECT_EQ(assigned.size(), 5);
+}
+
+TEST_F(CowChunkedVectorTest, ObjectLifetimesBalanced)
+{
+    {
+        cow_chunked_vector<TestObject, 4> vec;
+        for (int i = 0; i < 10; ++i)
+        {
+            vec.emplace_back(i);
+        }
+
+        auto snap1 = vec.snapshot();
+        EXPECT_EQ(TestObject::copy_calls, 0);
+
+        // Writing through the mutable path clones exactly one page of 4 elements
+        vec[1].value = 10;
+        EXPECT_EQ(TestObject::copy_calls, 4);
+        EXPECT_EQ(snap1.as_const()[1].value, 1);
+
+        auto snap2 = vec.snapshot();
+        vec.pop_back();
+        vec.resize(3);
+        snap1.clear();
+        vec.emplace_back(42);
+        EXPECT_EQ(snap2.as_const()[9].value, 9);
+    }
+
+    // Every object that was constructed (directly, by copy or by move) has been destroyed exactly once
+    EXPECT_EQ(TestObject::constructor_calls + TestObject::copy_calls + TestObject::move_calls, TestObject::destructor_calls);
+}
+
+TEST_F(CowChunkedVectorTest, ConcurrentReadersWithWriter)
+{
+    constexpr int ELEMENT_COUNT = 64 * 64;
+    cow_chunked_vector<int, 64> vec(ELEMENT_COUNT, 1);
+
+    std::vector<std::thread> readers;
+    std::vector<long long> sums(4, 0);
+    for (int reader_idx = 0; reader_idx < 4; ++reader_idx)
+    {
+        readers.emplace_back(
+            [snap = vec.snapshot(), &sums, reader_idx]()
+            {
+                long long sum = 0;
+                for (int pass = 0; pass < 50; ++pass)
+                {
+                    for (int value : snap)
+                    {
+                        sum += value;
+                    }
+                }
+                sums[reader_idx] = sum;
+            });
+    }
+
+    for (int i = 0; i < ELEMENT_COUNT; i += 7)
+    {
+        vec[i] = 2;
+    }
+
+    for (auto& reader : readers)
+    {
+        reader.join();
+    }
+    for (long long sum : sums)
+    {
+        EXPECT_EQ(sum, 50LL * ELEMENT_COUNT);
+    }
+    EXPECT_EQ(vec.shared_page_count(), 0);
+}
+
+// ============================================================================
+// Transactions
+// ============================================================================
+
+TEST_F(CowChunkedVectorTest, RollbackRestoresWrites)
+{
+    cow_chunked_vector<int, 4> vec;
+    for (int i = 0; i < 16; ++i)
+    {
+        vec.push_back(i);
+    }
+    const int* untouched_page = &vec.as_const()[0];
+
+    vec.begin_transaction();
+    EXPECT_TRUE(vec.in_transaction());
+    vec[5] = 500;
+    vec[6] = 600;
+    vec[13] = 1300;
+    EXPECT_EQ(vec.journaled_page_count(), 2);
+    EXPECT_EQ(vec[5], 500);
+
+    vec.rollback();
+    EXPECT_FALSE(vec.in_transaction());
+    EXPECT_EQ(vec.journaled_page_count(), 0);
+    EXPECT_EQ(vec.size(), 16);
+    for (int i = 0; i < 16; ++i)
+    {
+        EXPECT_EQ(vec[i], i);
+    }
+    EXPECT_EQ(&vec.as_const()[0], untouched_page);
+}
+
+TEST_F(CowChunkedVectorTest, CommitKeepsWrites)
+{
+    cow_chunked_vector<int, 4> vec(12, 1);
+
+    vec.begin_transaction();
+    vec[0] = 2;
+    vec.push_back(3);
+    vec.commit();
+    EXPECT_FALSE(vec.in_transaction());
+    EXPECT_EQ(vec.size(), 13);
+    EXPECT_EQ(vec[0], 2);
+    EXPECT_EQ(vec[12], 3);
+
+    // A later write outside of a transaction does not journal anything
+    vec[1] = 4;
+    EXPECT_EQ(vec.journaled_page_count(), 0);
+}
+
+TEST_F(CowChunkedVectorTest, RollbackSizeChanges)
+{
+    cow_chunked_vector<int, 4> vec;
+    for (int i = 0; i < 6; ++i)
+    {
+        vec.push_back(i);
+    }
+
+    // Growth into the partial tail page and into new pages
+    vec.begin_transaction();
+    for (int i = 0; i < 10; ++i)
+    {
+        vec.push_back(100 + i);
+    }
+    EXPECT_EQ(vec.journaled_page_count(), 1);
+    vec.rollback();
+    EXPECT_EQ(vec.size(), 6);
+    EXPECT_EQ(vec.back(), 5);
+
+    // Shrinking whole pages, then growing again over them
+    vec.begin_transaction();
+    vec.resize(1);
+    vec.pop_back();
+    for (int i = 0; i < 9; ++i)
+    {
+        vec.push_back(-i);
+    }
+    vec.rollback();
+    ASSERT_EQ(vec.size(), 6);
+    for (int i = 0; i < 6; ++i)
+    {
+        EXPECT_EQ(vec[i], i);
+    }
+
+    vec.begin_transaction();
+    vec.clear();
+    EXPECT_TRUE(vec.empty());
+    vec.rollback();
+    EXPECT_EQ(vec.size(), 6);
+    EXPECT_EQ(vec[3], 3);
+
+    // The container keeps working normally afterwards
+    vec.push_back(6);
+    EXPECT_EQ(vec.size(), 7);
+    EXPECT_EQ(vec[6], 6);
+}
+
+TEST_F(CowChunkedVectorTest, TransactionsAndSnapshots)
+{
+    cow_chunked_vector<int, 4> vec;
+    for (int i = 0; i < 12; ++i)
+    {
+        vec.push_back(i);
+    }
+    auto before = vec.snapshot();
+
+    vec.begin_transaction();
+    vec[0] = -1;
+    vec.push_back(12);
+    auto during = vec.snapshot();
+    vec[1] = -2; // page 0 is already a transaction copy, shared with "during" now
+    vec.resize(2);
+    EXPECT_EQ(vec.journaled_page_count(), 3);
+
+    vec.rollback();
+    for (int i = 0; i < 12; ++i)
+    {
+        EXPECT_EQ(vec.as_const()[i], i);
+    }
+    EXPECT_EQ(vec.size(), 12);
+
+    // The snapshot taken before the transaction shares the restored pages again
+    EXPECT_EQ(vec.shared_page_count(), 3);
+    EXPECT_EQ(&vec.as_const()[0], &before.as_const()[0]);
+
+    // The snapshot taken during the transaction is unaffected by the rollback
+    EXPECT_EQ(during.size(), 13);
+    EXPECT_EQ(during.as_const()[0], -1);
+    EXPECT_EQ(during.as_const()[1], 1);
+    EXPECT_EQ(during.as_const()[12], 12);
+}
+
+TEST_F(CowChunkedVectorTest, RollbackCostScalesWithTouchedPages)
+{
+    constexpr int ELEMENT_COUNT = 1024 * 64;
+    cow_chunked_vector<int, 64> vec(ELEMENT_COUNT, 7);
+
+    vec.begin_transaction();
+    for (int i = 0; i < ELEMENT_COUNT; i += 64 * 100)
+    {
+        vec[i] = 0;
+    }
+    EXPECT_EQ(vec.journaled_page_count(), 11);
+    vec.rollback();
+
+    EXPECT_EQ(vec[0], 7);
+    EXPECT_EQ(vec[64 * 100], 7);
+}
+
+TEST_F(CowChunkedVectorTest, TransactionObjectLifetimesBalanced)
+{
+    {
+        cow_chunked_vector<TestObject, 4> vec;
+        for (int i = 0; i < 10; ++i)
+        {
+            vec.emplace_back(i);
+        }
+
+        vec.begin_transaction();
+        vec[2].value = 20;
+        vec.resize(5);
+        vec.emplace_back(50);
+        vec.rollback();
+        EXPECT_EQ(vec.size(), 10);
+        EXPECT_EQ(vec[2].value, 2);
+        EXPECT_EQ(vec[9].value, 9);
+
+        vec.begin_transaction();
+        vec[9].value = 90;
+        vec.pop_back();
+        vec.commit();
+        EXPECT_EQ(vec.size(), 9);
+
+        // Destroying a container with a pending transaction commits it
+        vec.begin_transaction();
+        vec[0].value = 100;
+        vec.clear();
+    }
+
+    EXPECT_EQ(TestObject::constructor_calls + TestObject::copy_calls + TestObject::move_calls, TestObject::destructor_calls);
+}
@@ -1,5 +1,20 @@
 #include "ubench.h"
 #include "test_common.h"
+#include "chunked_vector/aggregated_vector.h"
+#include "chunked_vector/arena_chunked_vector.h"
+#include "chunked_vector/chunked_deque.h"
+#include "chunked_vector/chunked_ring_log.h"
+#include "chunked_vector/chunked_search.h"
+#include "chunked_vector/chunked_simd.h"
+#include "chunked_vector/chunked_slot_map.h"
+#include "chunked_vector/chunked_soa_vector.h"
+#include "chunked_vector/chunked_sorted_set.h"
+#include "chunked_vector/tiered_vector.h"
+#include "chunked_vector/zone_mapped_vector.h"
+#include <deque>
+#include <set>
+#include <unordered_map>
+#include "chunked_vector/cow_chunked_vector.h"
 
 // Helper to prevent compiler optimizations
 template<typename T>
@@ -85,6 +100,751 @@ void perf_test_copy_assignment() {
     do_not_optimize(copy);
 }
 
+template<typename Container>
+void perf_test_copy_assignment_reuse() {
+    // Repeated snapshot copies into a container that already holds the previous frame
+    Container original;
+    test_construct_and_fill(original);
+    Container copy;
+    test_copy_assignment(copy, original);
+    for (int frame = 0; frame < 4; ++frame) {
+        test_copy_assignment(copy, original);
+    }
+    do_not_optimize(copy);
+}
+
+template<typename Container>
+void perf_test_snapshot_frames() {
+    // Periodic snapshots for background readers while the writer touches a few scattered elements.
+    // Copy construction is a deep copy for std::vector/chunked_vector and a page-sharing snapshot for cow_chunked_vector.
+    Container original;
+    test_construct_and_fill(original);
+    for (int frame = 0; frame < 4; ++frame) {
+        Container snapshot(original);
+        for (size_t i = 0; i < original.size(); i += original.size() / 16) {
+            original[i] = typename Container::value_type(frame);
+        }
+        do_not_optimize(snapshot);
+    }
+    do_not_optimize(original);
+}
+
+template<typename Container>
+void perf_test_speculative_update_backup() {
+    // Undo support by keeping a full backup copy of the state
+    Container state;
+    test_construct_and_fill(state);
+    for (int frame = 0; frame < 4; ++frame) {
+        Container backup(state);
+        for (size_t i = 0; i < state.size(); i += state.size() / 16) {
+            state[i] = typename Container::value_type(frame);
+        }
+        state = std::move(backup);
+    }
+    do_not_optimize(state);
+}
+
+template<typename Container>
+void perf_test_speculative_update_transaction() {
+    // Undo support through the page journal
+    Container state;
+    test_construct_and_fill(state);
+    for (int frame = 0; frame < 4; ++frame) {
+        state.begin_transaction();
+        for (size_t i = 0; i < state.size(); i += state.size() / 16) {
+            state[i] = typename Container::value_type(frame);
+        }
+        state.rollback();
+    }
+    do_not_optimize(state);
+}
+
+template<typename Queue>
+void perf_test_work_queue() {
+    // FIFO work queue: keep a backlog, then consume from the front while producing at the back
+    Queue queue;
+    for (size_t i = 0; i < SMALL_SIZE * 10; ++i) {
+        queue.push_back(typename Queue::value_type(i));
+    }
+    long long sum = 0;
+    for (size_t i = 0; i < MEDIUM_SIZE; ++i) {
+        sum += queue.front().value;
+        queue.pop_front();
+        queue.push_back(typename Queue::value_type(i));
+    }
+    do_not_optimize(sum);
+}
+
+template<typename Queue>
+void perf_test_deque_random_access() {
+    Queue queue;
+    for (size_t i = 0; i < MEDIUM_SIZE; ++i) {
+        if (i % 2 == 0) {
+            queue.push_back(typename Queue::value_type(i));
+        } else {
+            queue.push_front(typename Queue::value_type(i));
+        }
+    }
+    std::mt19937 rng(42);
+    long long sum = 0;
+    for (size_t i = 0; i < MEDIUM_SIZE; ++i) {
+        sum += queue[rng() % queue.size()].value;
+    }
+    do_not_optimize(sum);
+}
+
+void perf_test_middle_insert_erase_tiered() {
+    // Ordered list maintenance: insert and erase at random positions of a large sequence
+    tiered_vector<TestObject> vec;
+    for (size_t i = 0; i < MEDIUM_SIZE; ++i) {
+        vec.emplace_back(i);
+    }
+    std::mt19937 rng(42);
+    long long sum = 0;
+    for (size_t i = 0; i < SMALL_SIZE; ++i) {
+        vec.emplace(rng() % (vec.size() + 1), i);
+        const size_t pos = rng() % vec.size();
+        sum += vec[pos].value;
+        vec.erase(pos);
+    }
+    do_not_optimize(sum);
+}
+
+void perf_test_middle_insert_erase_std() {
+    std::vector<TestObject> vec;
+    for (size_t i = 0; i < MEDIUM_SIZE; ++i) {
+        vec.emplace_back(i);
+    }
+    std::mt19937 rng(42);
+    long long sum = 0;
+    for (size_t i = 0; i < SMALL_SIZE; ++i) {
+        vec.emplace(vec.begin() + static_cast<std::ptrdiff_t>(rng() % (vec.size() + 1)), i);
+        const size_t pos = rng() % vec.size();
+        sum += vec[pos].value;
+        vec.erase(vec.begin() + static_cast<std::ptrdiff_t>(pos));
+    }
+    do_not_optimize(sum);
+}
+
+template<typename Vector>
+void perf_test_tiered_random_access() {
+    Vector vec;
+    for (size_t i = 0; i < MEDIUM_SIZE; ++i) {
+        vec.emplace_back(i);
+    }
+    std::mt19937 rng(42);
+    long long sum = 0;
+    for (size_t i = 0; i < MEDIUM_SIZE; ++i) {
+        sum += vec[rng() % vec.size()].value;
+    }
+    do_not_optimize(sum);
+}
+
+template<typename Set>
+void perf_test_sorted_insert() {
+    // Random-order inserts into a large sorted index, interleaved with lookups
+    Set set;
+    std::mt19937 rng(42);
+    long long found = 0;
+    for (size_t i = 0; i < MEDIUM_SIZE; ++i) {
+        set.insert(static_cast<uint32_t>(rng()));
+        found += set.count(static_cast<uint32_t>(rng()));
+    }
+    do_not_optimize(found);
+}
+
+template<typename Set>
+void perf_test_sorted_bulk_load() {
+    std::vector<uint32_t> keys(LARGE_SIZE);
+    for (size_t i = 0; i < keys.size(); ++i) {
+        keys[i] = static_cast<uint32_t>(i * 2);
+    }
+    Set set;
+    if constexpr (std::is_same_v<Set, std::set<uint32_t>>) {
+        set.insert(keys.begin(), keys.end());
+    } else {
+        set.assign_sorted(keys.data(), keys.data() + keys.size());
+    }
+    do_not_optimize(set.size());
+}
+
+void perf_test_range_filter_zone_map() {
+    // Time-range queries over mostly clustered timestamps
+    zone_mapped_vector<int64_t> timestamps;
+    std::mt19937 rng(42);
+    for (size_t i = 0; i < LARGE_SIZE; ++i) {
+        timestamps.push_back(static_cast<int64_t>(i * 16 + rng() % 64));
+    }
+    long long sum = 0;
+    for (int64_t query = 0; query < 100; ++query) {
+        const int64_t lo = query * 150000;
+        timestamps.scan_where(lo, lo + 20000, [&](size_t index, int64_t) { sum += static_cast<long long>(index); });
+    }
+    do_not_optimize(sum);
+}
+
+void perf_test_range_filter_full_scan() {
+    chunked_vector<int64_t> timestamps;
+    std::mt19937 rng(42);
+    for (size_t i = 0; i < LARGE_SIZE; ++i) {
+        timestamps.push_back(static_cast<int64_t>(i * 16 + rng() % 64));
+    }
+    long long sum = 0;
+    for (int64_t query = 0; query < 100; ++query) {
+        const int64_t lo = query * 150000;
+        const int64_t hi = lo + 20000;
+        for (size_t i = 0; i < timestamps.size(); ++i) {
+            if (timestamps[i] >= lo && timestamps[i] <= hi) {
+                sum += static_cast<long long>(i);
+            }
+        }
+    }
+    do_not_optimize(sum);
+}
+
+void perf_test_range_sum_aggregated() {
+    // Growing series with interleaved range-sum queries over arbitrary windows
+    aggregated_vector<double> series;
+    std::mt19937 rng(42);
+    double sum = 0.0;
+    for (size_t i = 0; i < MEDIUM_SIZE; ++i) {
+        series.push_back(static_cast<double>(i % 100));
+        if (i % 100 == 99) {
+            const size_t first = rng() % series.size();
+            sum += series.query(first, series.size());
+        }
+    }
+    do_not_optimize(sum);
+}
+
+void perf_test_range_sum_scan() {
+    chunked_vector<double> series;
+    std::mt19937 rng(42);
+    double sum = 0.0;
+    for (size_t i = 0; i < MEDIUM_SIZE; ++i) {
+        series.push_back(static_cast<double>(i % 100));
+        if (i % 100 == 99) {
+            const size_t first = rng() % series.size();
+            for (size_t j = first; j < series.size(); ++j) {
+                sum += series[j];
+            }
+        }
+    }
+    do_not_optimize(sum);
+}
+
+chunked_vector<int64_t> make_sorted_keys() {
+    chunked_vector<int64_t> keys;
+    for (size_t i = 0; i < LARGE_SIZE * 4; ++i) {
+        keys.push_back(static_cast<int64_t>(i * 3));
+    }
+    return keys;
+}
+
+void perf_test_sorted_search_indexed() {
+    // Many point lookups into a large sorted vector
+    static const chunked_vector<int64_t> keys = make_sorted_keys();
+    const auto index = build_fence_index(keys);
+    std::mt19937 rng(42);
+    size_t sum = 0;
+    for (size_t i = 0; i < MEDIUM_SIZE; ++i) {
+        sum += dod::lower_bound(keys, index, static_cast<int64_t>(rng() % (LARGE_SIZE * 12)));
+    }
+    do_not_optimize(sum);
+}
+
+void perf_test_sorted_search_pages() {
+    static const chunked_vector<int64_t> keys = make_sorted_keys();
+    std::mt19937 rng(42);
+    size_t sum = 0;
+    for (size_t i = 0; i < MEDIUM_SIZE; ++i) {
+        sum += dod::lower_bound(keys, static_cast<int64_t>(rng() % (LARGE_SIZE * 12)));
+    }
+    do_not_optimize(sum);
+}
+
+void perf_test_sorted_search_manual() {
+    static const chunked_vector<int64_t> keys = make_sorted_keys();
+    std::mt19937 rng(42);
+    size_t sum = 0;
+    for (size_t i = 0; i < MEDIUM_SIZE; ++i) {
+        const int64_t key = static_cast<int64_t>(rng() % (LARGE_SIZE * 12));
+        size_t lo = 0;
+        size_t hi = keys.size();
+        while (lo < hi) {
+            const size_t mid = lo + (hi - lo) / 2;
+            if (keys[mid] < key) {
+                lo = mid + 1;
+            } else {
+                hi = mid;
+            }
+        }
+        sum += lo;
+    }
+    do_not_optimize(sum);
+}
+
+template <typename T> const chunked_vector<T>& simd_input() {
+    static const chunked_vector<T> values = [] {
+        chunked_vector<T> vec;
+        std::mt19937 rng(42);
+        for (size_t i = 0; i < LARGE_SIZE; ++i) {
+            vec.push_back(static_cast<T>(rng() % 200));
+        }
+        return vec;
+    }();
+    return values;
+}
+
+void perf_test_simd_count_loop() {
+    const chunked_vector<float>& values = simd_input<float>();
+    size_t matches = 0;
+    for (int pass = 0; pass < 20; ++pass) {
+        matches += static_cast<size_t>(std::count(values.begin(), values.end(), static_cast<float>(pass)));
+    }
+    do_not_optimize(matches);
+}
+
+void perf_test_simd_count(simd::level lvl) {
+    const chunked_vector<float>& values = simd_input<float>();
+    const simd::level previous = simd::set_level_limit(lvl);
+    size_t matches = 0;
+    for (int pass = 0; pass < 20; ++pass) {
+        matches += simd::count(values, static_cast<float>(pass));
+    }
+    simd::set_level_limit(previous);
+    do_not_optimize(matches);
+}
+
+void perf_test_simd_sum_loop() {
+    const chunked_vector<int32_t>& values = simd_input<int32_t>();
+    int64_t total = 0;
+    for (int pass = 0; pass < 20; ++pass) {
+        for (int32_t value : values) {
+            total += value;
+        }
+    }
+    do_not_optimize(total);
+}
+
+void perf_test_simd_sum(simd::level lvl) {
+    const chunked_vector<int32_t>& values = simd_input<int32_t>();
+    const simd::level previous = simd::set_level_limit(lvl);
+    int64_t total = 0;
+    for (int pass = 0; pass < 20; ++pass) {
+        total += simd::sum(values);
+    }
+    simd::set_level_limit(previous);
+    do_not_optimize(total);
+}
+
+void perf_test_simd_min_element_loop() {
+    const chunked_vector<float>& values = simd_input<float>();
+    size_t index = 0;
+    for (int pass = 0; pass < 20; ++pass) {
+        index += static_cast<size_t>(std::distance(values.begin(), std::min_element(values.begin(), values.end())));
+    }
+    do_not_optimize(index);
+}
+
+void perf_test_simd_min_element(simd::level lvl) {
+    const chunked_vector<float>& values = simd_input<float>();
+    const simd::level previous = simd::set_level_limit(lvl);
+    size_t index = 0;
+    for (int pass = 0; pass < 20; ++pass) {
+        index += simd::min_element(values);
+    }
+    simd::set_level_limit(previous);
+    do_not_optimize(index);
+}
+
+void perf_test_simd_histogram_loop() {
+    const chunked_vector<uint8_t>& values = simd_input<uint8_t>();
+    std::array<uint64_t, 256> bins{};
+    for (int pass = 0; pass < 20; ++pass) {
+        for (uint8_t value : values) {
+            ++bins[value];
+        }
+    }
+    do_not_optimize(bins[0]);
+}
+
+void perf_test_simd_histogram() {
+    const chunked_vector<uint8_t>& values = simd_input<uint8_t>();
+    uint64_t total = 0;
+    for (int pass = 0; pass < 20; ++pass) {
+        total += simd::histogram(values)[0];
+    }
+    do_not_optimize(total);
+}
+
+// 64 MB of uint64_t: above the default streaming store threshold
+constexpr size_t STREAMING_ELEMENTS = 8 * 1024 * 1024;
+
+chunked_vector<uint64_t>& streaming_target() {
+    static chunked_vector<uint64_t> target(STREAMING_ELEMENTS);
+    return target;
+}
+
+void perf_test_streaming_fill(bool streaming) {
+    chunked_vector<uint64_t>& target = streaming_target();
+    if (streaming) {
+        target.clear();
+        target.resize(STREAMING_ELEMENTS, 42);
+    } else {
+        for (size_t i = 0; i < target.segment_count(); ++i) {
+            auto segment = target.segment(i);
+            std::fill(segment.begin(), segment.end(), 42);
+        }
+    }
+    do_not_optimize(target[STREAMING_ELEMENTS / 2]);
+}
+
+void perf_test_streaming_copy(bool streaming) {
+    static const chunked_vector<uint64_t> source(STREAMING_ELEMENTS, 7);
+    chunked_vector<uint64_t>& target = streaming_target();
+    if (streaming) {
+        target = source;
+    } else {
+        for (size_t i = 0; i < source.segment_count(); ++i) {
+            auto segment = source.segment(i);
+            std::memcpy(target.segment(i).data, segment.data, segment.size * sizeof(uint64_t));
+        }
+    }
+    do_not_optimize(target[STREAMING_ELEMENTS / 2]);
+}
+
+void perf_test_cache_pollution(bool streaming) {
+    // Cache-pollution proxy: a 1 MB random pointer chase that fits in L2 is warmed up, a bulk fill runs,
+    // then the chase is repeated. Fills that go through the cache evict it and make the second chase miss.
+    static const std::vector<uint32_t> chase = [] {
+        std::vector<uint32_t> order(256 * 1024);
+        for (uint32_t i = 0; i < order.size(); ++i) {
+            order[i] = i;
+        }
+        std::shuffle(order.begin() + 1, order.end(), std::mt19937(42));
+        std::vector<uint32_t> next(order.size());
+        for (size_t i = 0; i < order.size(); ++i) {
+            next[order[i]] = order[(i + 1) % order.size()];
+        }
+        return next;
+    }();
+    uint32_t node = 0;
+    for (size_t i = 0; i < chase.size(); ++i) {
+        node = chase[node];
+    }
+    perf_test_streaming_fill(streaming);
+    for (size_t i = 0; i < chase.size(); ++i) {
+        node = chase[node];
+    }
+    do_not_optimize(node);
+}
+
+// Feature table lookups: 16M uint64_t (128 MB) read at 1M random positions per batch
+constexpr size_t GATHER_TABLE_SIZE = 16 * 1024 * 1024;
+constexpr size_t GATHER_BATCH_SIZE = 1024 * 1024;
+
+const chunked_vector<uint64_t>& gather_table() {
+    static const chunked_vector<uint64_t> table = [] {
+        chunked_vector<uint64_t> vec;
+        vec.reserve(GATHER_TABLE_SIZE);
+        for (size_t i = 0; i < GATHER_TABLE_SIZE; ++i) {
+            vec.push_back(i * 2654435761u);
+        }
+        return vec;
+    }();
+    return table;
+}
+
+const std::vector<uint32_t>& gather_indices() {
+    static const std::vector<uint32_t> indices = [] {
+        std::vector<uint32_t> batch(GATHER_BATCH_SIZE);
+        std::mt19937 rng(42);
+        for (uint32_t& index : batch) {
+            index = static_cast<uint32_t>(rng() % GATHER_TABLE_SIZE);
+        }
+        return batch;
+    }();
+    return indices;
+}
+
+// Build the shared inputs before timing starts so the first gather benchmark does not pay for them
+const bool gather_inputs_built = (gather_table(), gather_indices(), true);
+
+void perf_test_gather_indexing() {
+    const chunked_vector<uint64_t>& table = gather_table();
+    const std::vector<uint32_t>& indices = gather_indices();
+    static std::vector<uint64_t> out(GATHER_BATCH_SIZE);
+    for (size_t i = 0; i < indices.size(); ++i) {
+        out[i] = table[indices[i]];
+    }
+    do_not_optimize(out[GATHER_BATCH_SIZE / 2]);
+}
+
+void perf_test_gather(batch_order order) {
+    const chunked_vector<uint64_t>& table = gather_table();
+    const std::vector<uint32_t>& indices = gather_indices();
+    static std::vector<uint64_t> out(GATHER_BATCH_SIZE);
+    table.gather(indices.data(), indices.size(), out.data(), order);
+    do_not_optimize(out[GATHER_BATCH_SIZE / 2]);
+}
+
+// 64 MB of TestObject: the scan streams from memory, and every 4 KB page is a new hardware prefetch stream
+const chunked_vector<TestObject>& large_scan_input() {
+    static const chunked_vector<TestObject> values(16 * 1024 * 1024, TestObject(1));
+    return values;
+}
+
+const bool large_scan_input_built = (large_scan_input(), true);
+
+void perf_test_iterator_scan_large() {
+    const chunked_vector<TestObject>& values = large_scan_input();
+    int sum = 0;
+    for (auto it = values.begin(); it != values.end(); ++it) {
+        sum += it->value;
+    }
+    do_not_optimize(sum);
+}
+
+// Random reads from a 256 KB (L2-resident) vector, so the cost of turning an index into (page, offset) dominates
+constexpr size_t PAGE_SPLIT_TABLE_SIZE = 64 * 1024;
+constexpr size_t PAGE_SPLIT_READS = 1024 * 1024;
+
+const std::vector<uint32_t>& page_split_positions() {
+    static const std::vector<uint32_t> positions = [] {
+        std::vector<uint32_t> batch(PAGE_SPLIT_READS);
+        std::mt19937 rng(7);
+        for (uint32_t& pos : batch) {
+            pos = static_cast<uint32_t>(rng() % PAGE_SPLIT_TABLE_SIZE);
+        }
+        return batch;
+    }();
+    return positions;
+}
+
+template<size_t PAGE_SIZE>
+const chunked_vector<uint32_t, PAGE_SIZE>& page_split_table() {
+    static const chunked_vector<uint32_t, PAGE_SIZE> table(PAGE_SPLIT_TABLE_SIZE, 1u);
+    return table;
+}
+
+const bool page_split_inputs_built = (page_split_positions(), page_split_table<1000>(), page_split_table<1024>(),
+                                      page_split_table<1365>(), page_split_table<4096>(), true);
+
+template<size_t PAGE_SIZE>
+void perf_test_random_access_page_size() {
+    const chunked_vector<uint32_t, PAGE_SIZE>& table = page_split_table<PAGE_SIZE>();
+    const std::vector<uint32_t>& positions = page_split_positions();
+    uint32_t sum = 0;
+    for (size_t i = 0; i < positions.size(); ++i) {
+        sum += table[positions[i]];
+    }
+    do_not_optimize(sum);
+}
+
+// Page byte budget sweep: fill 4 MB with push_back, scan it, then do 64K random reads
+template<size_t SIZE>
+struct sweep_record {
+    unsigned char bytes[SIZE];
+};
+
+const std::vector<uint32_t>& page_bytes_positions() {
+    static const std::vector<uint32_t> positions = [] {
+        std::vector<uint32_t> batch(64 * 1024);
+        std::mt19937 rng(11);
+        for (uint32_t& pos : batch) {
+            pos = rng();
+        }
+        return batch;
+    }();
+    return positions;
+}
+
+const bool page_bytes_positions_built = (page_bytes_positions(), true);
+
+template<size_t RECORD_SIZE, size_t PAGE_BYTES>
+void perf_test_page_bytes() {
+    using record = sweep_record<RECORD_SIZE>;
+    constexpr size_t count = 4 * 1024 * 1024 / RECORD_SIZE;
+    chunked_vector_bytes<record, PAGE_BYTES> vec;
+    const record value{};
+    for (size_t i = 0; i < count; ++i) {
+        vec.push_back(value);
+    }
+    size_t sum = 0;
+    for (const record& r : vec) {
+        sum += r.bytes[0];
+    }
+    for (uint32_t pos : page_bytes_positions()) {
+        sum += vec[pos % count].bytes[RECORD_SIZE - 1];
+    }
+    do_not_optimize(sum);
+}
+
+// Short-lived small vectors: build, read back and destroy many vectors of a few elements each
+template<typename Vector>
+void perf_test_small_vectors() {
+    int sum = 0;
+    for (size_t i = 0; i < MEDIUM_SIZE; ++i) {
+        Vector vec;
+        const int count = static_cast<int>(i % 13);
+        for (int j = 0; j < count; ++j) {
+            vec.push_back(j);
+        }
+        for (int value : vec) {
+            sum += value;
+        }
+    }
+    do_not_optimize(sum);
+}
+
+// Random reads over 256K small pages, where the page table itself (2 MB of pointers) no longer fits in L2
+constexpr size_t PAGE_TABLE_PAGE_SIZE = 16;
+constexpr size_t PAGE_TABLE_ELEMENTS = 256 * 1024 * PAGE_TABLE_PAGE_SIZE;
+
+const std::vector<uint32_t>& page_table_positions() {
+    static const std::vector<uint32_t> positions = [] {
+        std::vector<uint32_t> batch(1024 * 1024);
+        std::mt19937 rng(13);
+        for (uint32_t& pos : batch) {
+            pos = static_cast<uint32_t>(rng() % PAGE_TABLE_ELEMENTS);
+        }
+        return batch;
+    }();
+    return positions;
+}
+
+template<typename Vector>
+const Vector& page_table_input() {
+    static const Vector values = [] {
+        Vector vec;
+        for (size_t i = 0; i < PAGE_TABLE_ELEMENTS; ++i) {
+            vec.push_back(static_cast<uint32_t>(i));
+        }
+        return vec;
+    }();
+    return values;
+}
+
+const bool page_table_inputs_built = (page_table_positions(), page_table_input<chunked_vector<uint32_t, PAGE_TABLE_PAGE_SIZE>>(),
+                                      page_table_input<arena_chunked_vector<uint32_t, PAGE_TABLE_PAGE_SIZE>>(), true);
+
+template<typename Vector>
+void perf_test_page_table_random_access() {
+    const Vector& values = page_table_input<Vector>();
+    uint32_t sum = 0;
+    for (uint32_t pos : page_table_positions()) {
+        sum += values[pos];
+    }
+    do_not_optimize(sum);
+}
+
+void perf_test_event_log_ring() {
+    // Append-forever log that keeps the most recent entries and looks up recent sequence numbers
+    chunked_ring_log<TestObject> log(MEDIUM_SIZE / 10);
+    long long sum = 0;
+    for (size_t i = 0; i < MEDIUM_SIZE; ++i) {
+        const uint64_t seq = log.emplace_back(i);
+        sum += log[seq - (seq - log.first_sequence()) / 2].value;
+    }
+    do_not_optimize(sum);
+}
+
+void perf_test_event_log_deque() {
+    std::deque<TestObject> log;
+    uint64_t first_seq = 0;
+    long long sum = 0;
+    for (size_t i = 0; i < MEDIUM_SIZE; ++i) {
+        log.emplace_back(i);
+        if (log.size() > MEDIUM_SIZE / 10) {
+            log.pop_front();
+            ++first_seq;
+        }
+        const uint64_t seq = first_seq + log.size() - 1;
+        sum += log[static_cast<size_t>(seq - (seq - first_seq) / 2 - first_seq)].value;
+    }
+    do_not_optimize(sum);
+}
+
+void perf_test_handle_churn_slot_map() {
+    // Entities are created and destroyed through stable handles, then all live ones are visited
+    chunked_slot_map<TestObject> entities;
+    std::vector<chunked_slot_map<TestObject>::handle> handles;
+    handles.reserve(MEDIUM_SIZE);
+    for (size_t i = 0; i < MEDIUM_SIZE; ++i) {
+        handles.push_back(entities.emplace(i));
+    }
+    for (size_t i = 0; i < MEDIUM_SIZE; i += 3) {
+        entities.erase(handles[i]);
+    }
+    for (size_t i = 0; i < MEDIUM_SIZE; i += 3) {
+        handles[i] = entities.emplace(i);
+    }
+    long long sum = 0;
+    for (const TestObject& entity : entities) {
+        sum += entity.value;
+    }
+    do_not_optimize(sum);
+}
+
+void perf_test_handle_churn_unordered_map() {
+    std::unordered_map<uint64_t, TestObject> entities;
+    std::vector<uint64_t> handles;
+    handles.reserve(MEDIUM_SIZE);
+    uint64_t next_id = 0;
+    for (size_t i = 0; i < MEDIUM_SIZE; ++i) {
+        handles.push_back(next_id);
+        entities.emplace(next_id++, TestObject(i));
+    }
+    for (size_t i = 0; i < MEDIUM_SIZE; i += 3) {
+        entities.erase(handles[i]);
+    }
+    for (size_t i = 0; i < MEDIUM_SIZE; i += 3) {
+        handles[i] = next_id;
+        entities.emplace(next_id++, TestObject(i));
+    }
+    long long sum = 0;
+    for (const auto& entity : entities) {
+        sum += entity.second.value;
+    }
+    do_not_optimize(sum);
+}
+
+struct Particle {
+    float position[3];
+    float velocity[3];
+    float mass;
+    int id;
+};
+
+void perf_test_update_positions_aos() {
+    // A pass that reads two fields still streams the whole struct through the cache
+    chunked_vector<Particle> particles;
+    particles.resize(MEDIUM_SIZE, Particle{{0.0f, 0.0f, 0.0f}, {1.0f, 2.0f, 3.0f}, 1.0f, 0});
+    for (int pass = 0; pass < 4; ++pass) {
+        for (Particle& particle : particles) {
+            particle.position[0] += particle.velocity[0] * 0.016f;
+        }
+    }
+    do_not_optimize(particles);
+}
+
+void perf_test_update_positions_soa() {
+    // Columns: pos_x, pos_y, pos_z, vel_x, vel_y, vel_z, mass, id - only pos_x and vel_x are touched
+    chunked_soa_vector<float, float, float, float, float, float, float, int> particles;
+    particles.resize(MEDIUM_SIZE, {0.0f, 0.0f, 0.0f, 1.0f, 2.0f, 3.0f, 1.0f, 0});
+    for (int pass = 0; pass < 4; ++pass) {
+        for (size_t segment_idx = 0; segment_idx < particles.segment_count(); ++segment_idx) {
+            auto pos_x = particles.segment<0>(segment_idx);
+            auto vel_x = particles.segment<3>(segment_idx);
+            for (size_t i = 0; i < pos_x.size; ++i) {
+                pos_x.data[i] += vel_x.data[i] * 0.016f;
+            }
+        }
+    }
+    do_not_optimize(particles);
+}
+
 template<typename Container>
 void perf_test_resize_grow() {
     Container vec;
@@ -134,6 +894,51 @@ void perf_test_page_boundary_access() {
     do_not_optimize(vec);
 }
 
+template<typename Container>
+void fill_unique_ptrs(Container& vec, size_t size) {
+    for (size_t i = 0; i < size; ++i) {
+        vec.push_back(std::make_unique<int>(static_cast<int>(i)));
+    }
+}
+
+template<typename Container>
+void perf_test_erase_front_unique_ptr() {
+    Container vec;
+    fill_unique_ptrs(vec, MEDIUM_SIZE);
+    // Each erase shifts the whole tail
+    for (int i = 0; i < 100; ++i) {
+        vec.erase(vec.begin());
+    }
+    do_not_optimize(vec);
+}
+
+template<typename Container>
+void perf_test_erase_range_unique_ptr() {
+    Container vec;
+    fill_unique_ptrs(vec, MEDIUM_SIZE);
+    auto first = vec.begin();
+    for (size_t i = 0; i < SMALL_SIZE; ++i) {
+        ++first;
+    }
+    auto last = first;
+    for (size_t i = 0; i < SMALL_SIZE; ++i) {
+        ++last;
+    }
+    vec.erase(first, last);
+    do_not_optimize(vec);
+}
+
+template<typename Container>
+void perf_test_erase_unsorted_unique_ptr() {
+    Container vec;
+    fill_unique_ptrs(vec, MEDIUM_SIZE);
+    for (size_t i = 0; i < SMALL_SIZE; ++i) {
+        auto it = vec.erase_unsorted(vec.begin());
+        do_not_optimize(it);
+    }
+    do_not_optimize(vec);
+}
+
 // =============================================================================
 // Benchmark Instantiations
 // =============================================================================
@@ -327,6 +1132,34 @@ UBENCH(copy_assignment_testobject, chunked_vector) {
     perf_test_copy_assignment<chunked_vector<TestObject>>();
 }
 
+UBENCH(copy_assignment_reuse_testobject, std_vector) {
+    perf_test_copy_assignment_reuse<std::vector<TestObject>>();
+}
+
+UBENCH(copy_assignment_reuse_testobject, chunked_vector) {
+    perf_test_copy_assignment_reuse<chunked_vector<TestObject>>();
+}
+
+UBENCH(snapshot_frames_testobject, std_vector) {
+    perf_test_snapshot_frames<std::vector<TestObject>>();
+}
+
+UBENCH(snapshot_frames_testobject, chunked_vector) {
+    perf_test_snapshot_frames<chunked_vector<TestObject>>();
+}
+
+UBENCH(snapshot_frames_testobject, cow_chunked_vector) {
+    perf_test_snapshot_frames<cow_chunked_vector<TestObject>>();
+}
+
+UBENCH(speculative_update_testobject, chunked_vector_backup) {
+    perf_test_speculative_update_backup<chunked_vector<TestObject>>();
+}
+
+UBENCH(speculative_update_testobject, cow_chunked_vector_rollback) {
+    perf_test_speculative_update_transaction<cow_chunked_vector<TestObject>>();
+}
+
 // Copy Performance Tests - float
 UBENCH(copy_constructor_float, std_vector) {
     perf_test_copy_constructor<std::vector<float>>();
@@ -457,4 +1290,328 @@ UBENCH(page_boundary_access_float, chunked_vector) {
     perf_test_page_boundary_access<chunked_vector<float>>();
 }
 
+// Erase Performance Tests - std::unique_ptr (trivially relocatable)
+UBENCH(erase_front_unique_ptr, std_vector) {
+    perf_test_erase_front_unique_ptr<std::vector<std::unique_ptr<int>>>();
+}
+
+UBENCH(erase_front_unique_ptr, chunked_vector) {
+    perf_test_erase_front_unique_ptr<chunked_vector<std::unique_ptr<int>>>();
+}
+
+UBENCH(erase_range_unique_ptr, std_vector) {
+    perf_test_erase_range_unique_ptr<std::vector<std::unique_ptr<int>>>();
+}
+
+UBENCH(erase_range_unique_ptr, chunked_vector) {
+    perf_test_erase_range_unique_ptr<chunked_vector<std::unique_ptr<int>>>();
+}
+
+UBENCH(erase_unsorted_unique_ptr, chunked_vector) {
+    perf_test_erase_unsorted_unique_ptr<chunked_vector<std::unique_ptr<int>>>();
+}
+
+// Deque Tests - TestObject
+UBENCH(work_queue_testobject, std_deque) {
+    perf_test_work_queue<std::deque<TestObject>>();
+}
+
+UBENCH(work_queue_testobject, chunked_deque) {
+    perf_test_work_queue<chunked_deque<TestObject>>();
+}
+
+UBENCH(deque_random_access_testobject, std_deque) {
+    perf_test_deque_random_access<std::deque<TestObject>>();
+}
+
+UBENCH(deque_random_access_testobject, chunked_deque) {
+    perf_test_deque_random_access<chunked_deque<TestObject>>();
+}
+
+// Middle Insert/Erase Tests - TestObject
+UBENCH(middle_insert_erase_testobject, std_vector) {
+    perf_test_middle_insert_erase_std();
+}
+
+UBENCH(middle_insert_erase_testobject, tiered_vector) {
+    perf_test_middle_insert_erase_tiered();
+}
+
+UBENCH(tiered_random_access_testobject, chunked_vector) {
+    perf_test_tiered_random_access<chunked_vector<TestObject>>();
+}
+
+UBENCH(tiered_random_access_testobject, tiered_vector) {
+    perf_test_tiered_random_access<tiered_vector<TestObject>>();
+}
+
+// Sorted Set Tests - uint32_t
+UBENCH(sorted_insert_uint32, std_set) {
+    perf_test_sorted_insert<std::set<uint32_t>>();
+}
+
+UBENCH(sorted_insert_uint32, chunked_sorted_set) {
+    perf_test_sorted_insert<chunked_sorted_set<uint32_t>>();
+}
+
+UBENCH(sorted_bulk_load_uint32, std_set) {
+    perf_test_sorted_bulk_load<std::set<uint32_t>>();
+}
+
+UBENCH(sorted_bulk_load_uint32, chunked_sorted_set) {
+    perf_test_sorted_bulk_load<chunked_sorted_set<uint32_t>>();
+}
+
+// Range Filter Tests - int64_t timestamps
+UBENCH(range_filter_int64, chunked_vector_full_scan) {
+    perf_test_range_filter_full_scan();
+}
+
+UBENCH(range_filter_int64, zone_mapped_vector) {
+    perf_test_range_filter_zone_map();
+}
+
+// Range Aggregate Tests - double
+UBENCH(range_sum_double, chunked_vector_scan) {
+    perf_test_range_sum_scan();
+}
+
+UBENCH(range_sum_double, aggregated_vector) {
+    perf_test_range_sum_aggregated();
+}
+
+// Sorted Search Tests - int64_t
+UBENCH(sorted_search_int64, manual_binary_search) {
+    perf_test_sorted_search_manual();
+}
+
+UBENCH(sorted_search_int64, page_lower_bound) {
+    perf_test_sorted_search_pages();
+}
+
+UBENCH(sorted_search_int64, fence_index_lower_bound) {
+    perf_test_sorted_search_indexed();
+}
+
+// SIMD Kernel Tests
+UBENCH(simd_count_float, std_count) {
+    perf_test_simd_count_loop();
+}
+
+UBENCH(simd_count_float, scalar) {
+    perf_test_simd_count(simd::level::scalar);
+}
+
+UBENCH(simd_count_float, sse2) {
+    perf_test_simd_count(simd::level::sse2);
+}
+
+UBENCH(simd_count_float, avx2) {
+    perf_test_simd_count(simd::level::avx2);
+}
+
+UBENCH(simd_count_float, avx512) {
+    perf_test_simd_count(simd::level::avx512);
+}
+
+UBENCH(simd_sum_int32, range_for) {
+    perf_test_simd_sum_loop();
+}
+
+UBENCH(simd_sum_int32, scalar) {
+    perf_test_simd_sum(simd::level::scalar);
+}
+
+UBENCH(simd_sum_int32, sse2) {
+    perf_test_simd_sum(simd::level::sse2);
+}
+
+UBENCH(simd_sum_int32, avx2) {
+    perf_test_simd_sum(simd::level::avx2);
+}
+
+UBENCH(simd_sum_int32, avx512) {
+    perf_test_simd_sum(simd::level::avx512);
+}
+
+UBENCH(simd_min_element_float, std_min_element) {
+    perf_test_simd_min_element_loop();
+}
+
+UBENCH(simd_min_element_float, scalar) {
+    perf_test_simd_min_element(simd::level::scalar);
+}
+
+UBENCH(simd_min_element_float, sse2) {
+    perf_test_simd_min_element(simd::level::sse2);
+}
+
+UBENCH(simd_min_element_float, avx2) {
+    perf_test_simd_min_element(simd::level::avx2);
+}
+
+UBENCH(simd_min_element_float, avx512) {
+    perf_test_simd_min_element(simd::level::avx512);
+}
+
+UBENCH(simd_histogram_uint8, range_for) {
+    perf_test_simd_histogram_loop();
+}
+
+UBENCH(simd_histogram_uint8, split_counters) {
+    perf_test_simd_histogram();
+}
+
+// Streaming Store Tests - uint64_t, 64 MB
+UBENCH(streaming_fill_uint64, regular_stores) {
+    perf_test_streaming_fill(false);
+}
+
+UBENCH(streaming_fill_uint64, streaming_stores) {
+    perf_test_streaming_fill(true);
+}
+
+UBENCH(streaming_copy_uint64, regular_stores) {
+    perf_test_streaming_copy(false);
+}
+
+UBENCH(streaming_copy_uint64, streaming_stores) {
+    perf_test_streaming_copy(true);
+}
+
+UBENCH(cache_pollution_proxy, regular_fill) {
+    perf_test_cache_pollution(false);
+}
+
+UBENCH(cache_pollution_proxy, streaming_fill) {
+    perf_test_cache_pollution(true);
+}
+
+// Batched Gather Tests - uint64_t
+UBENCH(gather_uint64, operator_index) {
+    perf_test_gather_indexing();
+}
+
+UBENCH(gather_uint64, gather_as_given) {
+    perf_test_gather(batch_order::as_given);
+}
+
+UBENCH(gather_uint64, gather_group_by_page) {
+    perf_test_gather(batch_order::group_by_page);
+}
+
+// Large Sequential Iteration Tests - TestObject (compare with performance_test_iterator_prefetch)
+UBENCH(sequential_iteration_large_testobject, chunked_vector) {
+    perf_test_iterator_scan_large();
+}
+
+// Random Access by Page Size Tests - uint32_t (non-power-of-two sizes divide by a reciprocal)
+UBENCH(random_access_page_size, page_1000) {
+    perf_test_random_access_page_size<1000>();
+}
+
+UBENCH(random_access_page_size, page_1024) {
+    perf_test_random_access_page_size<1024>();
+}
+
+UBENCH(random_access_page_size, page_1365) {
+    perf_test_random_access_page_size<1365>();
+}
+
+UBENCH(random_access_page_size, page_4096) {
+    perf_test_random_access_page_size<4096>();
+}
+
+// Page Byte Budget Sweep - 1-byte records (chunked_vector_bytes)
+UBENCH(page_bytes_record_1, page_4kb) {
+    perf_test_page_bytes<1, 4 * 1024>();
+}
+
+UBENCH(page_bytes_record_1, page_64kb) {
+    perf_test_page_bytes<1, 64 * 1024>();
+}
+
+UBENCH(page_bytes_record_1, page_2mb) {
+    perf_test_page_bytes<1, 2 * 1024 * 1024>();
+}
+
+// Page Byte Budget Sweep - 48-byte records (chunked_vector_bytes)
+UBENCH(page_bytes_record_48, page_4kb) {
+    perf_test_page_bytes<48, 4 * 1024>();
+}
+
+UBENCH(page_bytes_record_48, page_64kb) {
+    perf_test_page_bytes<48, 64 * 1024>();
+}
+
+UBENCH(page_bytes_record_48, page_2mb) {
+    perf_test_page_bytes<48, 2 * 1024 * 1024>();
+}
+
+// Page Byte Budget Sweep - 256-byte records (chunked_vector_bytes)
+UBENCH(page_bytes_record_256, page_4kb) {
+    perf_test_page_bytes<256, 4 * 1024>();
+}
+
+UBENCH(page_bytes_record_256, page_64kb) {
+    perf_test_page_bytes<256, 64 * 1024>();
+}
+
+UBENCH(page_bytes_record_256, page_2mb) {
+    perf_test_page_bytes<256, 2 * 1024 * 1024>();
+}
+
+// Short-Lived Small Vector Tests - int (0 to 12 elements each)
+UBENCH(short_lived_small_vectors, std_vector) {
+    perf_test_small_vectors<std::vector<int>>();
+}
+
+UBENCH(short_lived_small_vectors, chunked_vector) {
+    perf_test_small_vectors<chunked_vector<int>>();
+}
+
+UBENCH(short_lived_small_vectors, chunked_vector_small_first_page) {
+    perf_test_small_vectors<chunked_vector<int, 1024, 4>>();
+}
+
+UBENCH(short_lived_small_vectors, chunked_vector_inline_16) {
+    perf_test_small_vectors<chunked_vector<int, 1024, 1024, 16>>();
+}
+
+// Random Access with a Large Page Table - uint32_t, 256K pages of 16 elements
+UBENCH(page_table_random_access, chunked_vector_pointers) {
+    perf_test_page_table_random_access<chunked_vector<uint32_t, PAGE_TABLE_PAGE_SIZE>>();
+}
+
+UBENCH(page_table_random_access, arena_chunked_vector_numbers) {
+    perf_test_page_table_random_access<arena_chunked_vector<uint32_t, PAGE_TABLE_PAGE_SIZE>>();
+}
+
+// Bounded Event Log Tests - TestObject
+UBENCH(event_log_testobject, std_deque) {
+    perf_test_event_log_deque();
+}
+
+UBENCH(event_log_testobject, chunked_ring_log) {
+    perf_test_event_log_ring();
+}
+
+// Handle Churn Tests - TestObject
+UBENCH(handle_churn_testobject, std_unordered_map) {
+    perf_test_handle_churn_unordered_map();
+}
+
+UBENCH(handle_churn_testobject, chunked_slot_map) {
+    perf_test_handle_churn_slot_map();
+}
+
+// Structure-of-Arrays Pass Tests - Particle fields
+UBENCH(update_positions, chunked_vector_aos) {
+    perf_test_update_positions_aos();
+}
+
+UBENCH(update_positions, chunked_soa_vector) {
+    perf_test_update_positions_soa();
+}
+
 UBENCH_MAIN(); 
\ No newline at end of file
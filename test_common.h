@@ -20,10 +20,10 @@ constexpr size_t LARGE_SIZE = 1000000;
 // Custom test object with non-trivial constructor/destructor for fair comparison
 struct TestObject {
     int value;
-    static int constructor_calls;
-    static int destructor_calls;
-    static int copy_calls;
-    static int move_calls;
+    inline static int constructor_calls = 0;
+    inline static int destructor_calls = 0;
+    inline static int copy_calls = 0;
+    inline static int move_calls = 0;
 
     TestObject() : value(0) {
         ++constructor_calls;
@@ -110,12 +110,6 @@ struct TestObject {
     int get_value() const { return value; }
 };
 
-// Static member definitions
-int TestObject::constructor_calls = 0;
-int TestObject::destructor_calls = 0;
-int TestObject::copy_calls = 0;
-int TestObject::move_calls = 0;
-
 // =============================================================================
 // Template Test Functions
 // =============================================================================
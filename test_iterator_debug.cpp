@@ -1044,6 +1044,37 @@ TEST_F(ChunkedVectorIteratorDebugTest, ConstIteratorConversionAdoption)
     EXPECT_THROW(*const_it, test_assertions::AssertionException);
 }
 
+TEST_F(ChunkedVectorIteratorDebugTest, InvalidationAfterAppendAndSplitOff)
+{
+    chunked_vector<int, 4> vec;
+    chunked_vector<int, 4> other;
+    for (int i = 0; i < 8; ++i) {
+        vec.push_back(i);
+        other.push_back(i + 8);
+    }
+
+    auto it_kept = vec.begin();
+    std::advance(it_kept, 5);
+    auto it_other = other.begin();
+
+    vec.append(std::move(other));
+
+    // Iterators into the destination stay valid, iterators into the source do not
+    EXPECT_EQ(*it_kept, 5);
+    EXPECT_THROW(*it_other, test_assertions::AssertionException);
+
+    auto it_front = vec.begin();
+    auto it_split = vec.begin();
+    std::advance(it_split, 10);
+
+    auto tail = vec.split_off(4);
+
+    EXPECT_EQ(*it_front, 0);
+    EXPECT_THROW(*it_kept, test_assertions::AssertionException);
+    EXPECT_THROW(*it_split, test_assertions::AssertionException);
+    EXPECT_EQ(tail.size(), 12u);
+}
+
 #else // CHUNKED_VEC_ITERATOR_DEBUG_LEVEL == 0
 
 // =============================================================================
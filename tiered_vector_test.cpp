@@ -0,0 +1,258 @@
+#include "chunked_vector/tiered_vector.h"
+#include "test_common.h"
+#include <gtest/gtest.h>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace dod;
+
+class TieredVectorTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        TestObject::constructor_calls = 0;
+        TestObject::destructor_calls = 0;
+        TestObject::copy_calls = 0;
+        TestObject::move_calls = 0;
+    }
+    void TearDown() override {}
+};
+
+template <typename Container, typename Reference> void expect_same(const Container& actual, const Reference& expected)
+{
+    ASSERT_EQ(actual.size(), expected.size());
+    for (size_t i = 0; i < expected.size(); ++i)
+    {
+        EXPECT_EQ(actual[i], expected[i]) << "at index " << i;
+    }
+}
+
+// ============================================================================
+// Basic Operations
+// ============================================================================
+
+TEST_F(TieredVectorTest, PushBackAndAccess)
+{
+    tiered_vector<int, 4> vec;
+    EXPECT_TRUE(vec.empty());
+
+    for (int i = 0; i < 10; ++i)
+    {
+        vec.push_back(i);
+    }
+    ASSERT_EQ(vec.size(), 10);
+    EXPECT_EQ(vec.capacity(), 12);
+    EXPECT_EQ(vec.front(), 0);
+    EXPECT_EQ(vec.back(), 9);
+    for (int i = 0; i < 10; ++i)
+    {
+        EXPECT_EQ(vec[i], i);
+    }
+    EXPECT_EQ(vec.at(9), 9);
+    EXPECT_THROW((void)vec.at(10), std::out_of_range);
+
+    vec.pop_back();
+    EXPECT_EQ(vec.size(), 9);
+    EXPECT_EQ(vec.back(), 8);
+
+    vec.clear();
+    EXPECT_TRUE(vec.empty());
+    EXPECT_EQ(vec.capacity(), 12);
+}
+
+TEST_F(TieredVectorTest, InsertAtEveryPosition)
+{
+    for (int pos = 0; pos <= 13; ++pos)
+    {
+        tiered_vector<int, 4> vec;
+        std::vector<int> expected;
+        for (int i = 0; i < 13; ++i)
+        {
+            vec.push_back(i);
+            expected.push_back(i);
+        }
+
+        vec.insert(pos, 100);
+        expected.insert(expected.begin() + pos, 100);
+        expect_same(vec, expected);
+    }
+}
+
+TEST_F(TieredVectorTest, EraseAtEveryPosition)
+{
+    for (int pos = 0; pos < 13; ++pos)
+    {
+        tiered_vector<int, 4> vec;
+        std::vector<int> expected;
+        for (int i = 0; i < 13; ++i)
+        {
+            vec.push_back(i);
+            expected.push_back(i);
+        }
+
+        vec.erase(pos);
+        expected.erase(expected.begin() + pos);
+        expect_same(vec, expected);
+    }
+}
+
+TEST_F(TieredVectorTest, InsertIntoFullLastPageAddsPage)
+{
+    tiered_vector<int, 4> vec{0, 1, 2, 3, 4, 5, 6, 7};
+    EXPECT_EQ(vec.capacity(), 8);
+
+    vec.insert(1, 42);
+    EXPECT_EQ(vec.capacity(), 12);
+    expect_same(vec, std::vector<int>{0, 42, 1, 2, 3, 4, 5, 6, 7});
+
+    vec.push_back(8);
+    EXPECT_EQ(vec.back(), 8);
+}
+
+TEST_F(TieredVectorTest, EmplaceFromOwnElement)
+{
+    tiered_vector<std::string, 4> vec{"a", "b", "c", "d", "e", "f"};
+    vec.emplace(0, vec[5]);
+    vec.insert(3, vec[0]);
+    expect_same(vec, std::vector<std::string>{"f", "a", "b", "f", "c", "d", "e", "f"});
+}
+
+// ============================================================================
+// Randomized Comparison
+// ============================================================================
+
+TEST_F(TieredVectorTest, RandomInsertEraseMatchesStdVector)
+{
+    tiered_vector<int, 8> vec;
+    std::vector<int> expected;
+    std::mt19937 rng(1234);
+
+    for (int step = 0; step < 5000; ++step)
+    {
+        const unsigned op = rng() % 5;
+        if (op < 3 || expected.empty())
+        {
+            const size_t pos = rng() % (expected.size() + 1);
+            vec.insert(pos, step);
+            expected.insert(expected.begin() + static_cast<std::ptrdiff_t>(pos), step);
+        }
+        else
+        {
+            const size_t pos = rng() % expected.size();
+            vec.erase(pos);
+            expected.erase(expected.begin() + static_cast<std::ptrdiff_t>(pos));
+        }
+    }
+    expect_same(vec, expected);
+
+    std::vector<int> iterated(vec.begin(), vec.end());
+    EXPECT_EQ(iterated, expected);
+}
+
+TEST_F(TieredVectorTest, RandomInsertEraseNonTrivial)
+{
+    tiered_vector<std::string, 4> vec;
+    std::vector<std::string> expected;
+    std::mt19937 rng(99);
+
+    for (int step = 0; step < 2000; ++step)
+    {
+        if (rng() % 3 != 0 || expected.empty())
+        {
+            const size_t pos = rng() % (expected.size() + 1);
+            const std::string value = "value number " + std::to_string(step);
+            vec.insert(pos, value);
+            expected.insert(expected.begin() + static_cast<std::ptrdiff_t>(pos), value);
+        }
+        else
+        {
+            const size_t pos = rng() % expected.size();
+            vec.erase(pos);
+            expected.erase(expected.begin() + static_cast<std::ptrdiff_t>(pos));
+        }
+    }
+    expect_same(vec, expected);
+}
+
+// ============================================================================
+// Iterators
+// ============================================================================
+
+TEST_F(TieredVectorTest, IteratorsFollowRotatedPages)
+{
+    tiered_vector<int, 4> vec;
+    for (int i = 0; i < 12; ++i)
+    {
+        vec.push_back(i);
+    }
+    // Front inserts/erases rotate every page head
+    vec.insert(0, -1);
+    vec.erase(0);
+    vec.erase(0);
+    vec.insert(0, 0);
+
+    int expected = 0;
+    for (int value : vec)
+    {
+        EXPECT_EQ(value, expected++);
+    }
+    EXPECT_EQ(expected, 12);
+
+    const auto& cvec = vec;
+    tiered_vector<int, 4>::const_iterator it = vec.begin();
+    EXPECT_TRUE(it == cvec.cbegin());
+    EXPECT_EQ(*it, 0);
+
+    auto next = vec.erase(cvec.begin());
+    EXPECT_EQ(*next, 1);
+    EXPECT_EQ(vec.size(), 11);
+}
+
+// ============================================================================
+// Copy and Move
+// ============================================================================
+
+TEST_F(TieredVectorTest, CopyAndMove)
+{
+    tiered_vector<std::string, 4> vec;
+    for (int i = 0; i < 9; ++i)
+    {
+        vec.insert(0, std::to_string(i));
+    }
+
+    tiered_vector<std::string, 4> copy(vec);
+    expect_same(copy, vec);
+
+    tiered_vector<std::string, 4> moved(std::move(copy));
+    EXPECT_TRUE(copy.empty());
+    EXPECT_EQ(moved[0], "8");
+    EXPECT_EQ(moved[8], "0");
+
+    tiered_vector<std::string, 4> assigned{"old"};
+    assigned = vec;
+    expect_same(assigned, vec);
+    assigned = std::move(moved);
+    EXPECT_EQ(assigned.front(), "8");
+    EXPECT_EQ(assigned.size(), 9);
+}
+
+TEST_F(TieredVectorTest, ObjectLifetimesBalanced)
+{
+    {
+        tiered_vector<TestObject, 4> vec;
+        for (int i = 0; i < 20; ++i)
+        {
+            vec.emplace(static_cast<size_t>(i / 2), i);
+        }
+        for (int i = 0; i < 7; ++i)
+        {
+            vec.erase(static_cast<size_t>(i));
+        }
+        vec.pop_back();
+        auto copy = vec;
+        copy.clear();
+    }
+    EXPECT_EQ(TestObject::constructor_calls + TestObject::copy_calls + TestObject::move_calls, TestObject::destructor_calls);
+}
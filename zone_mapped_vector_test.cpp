@@ -0,0 +1,170 @@
+#include "chunked_vector/zone_mapped_vector.h"
+#include "test_common.h"
+#include <gtest/gtest.h>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace dod;
+
+class ZoneMappedVectorTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override {}
+    void TearDown() override {}
+};
+
+template <typename Vector, typename T> std::vector<size_t> matching_indices(Vector& vec, const T& lo, const T& hi)
+{
+    std::vector<size_t> indices;
+    vec.scan_where(lo, hi, [&](size_t index, const T& value) {
+        EXPECT_FALSE(value < lo);
+        EXPECT_FALSE(hi < value);
+        indices.push_back(index);
+    });
+    return indices;
+}
+
+template <typename Vector, typename T> std::vector<size_t> brute_force_indices(const Vector& vec, const T& lo, const T& hi)
+{
+    std::vector<size_t> indices;
+    for (size_t i = 0; i < vec.size(); ++i)
+    {
+        if (!(vec[i] < lo) && !(hi < vec[i]))
+        {
+            indices.push_back(i);
+        }
+    }
+    return indices;
+}
+
+// ============================================================================
+// Zone Maintenance
+// ============================================================================
+
+TEST_F(ZoneMappedVectorTest, PushBackMaintainsZones)
+{
+    zone_mapped_vector<int64_t, 4> vec{5, 3, 9, 7, 20, 21, 19};
+    ASSERT_EQ(vec.segment_count(), 2);
+
+    EXPECT_TRUE(vec.zone(0).valid);
+    EXPECT_EQ(vec.zone(0).min, 3);
+    EXPECT_EQ(vec.zone(0).max, 9);
+    EXPECT_EQ(vec.zone(0).count, 4);
+
+    EXPECT_EQ(vec.zone(1).min, 19);
+    EXPECT_EQ(vec.zone(1).max, 21);
+    EXPECT_EQ(vec.zone(1).count, 3);
+
+    vec.push_back(30);
+    EXPECT_EQ(vec.zone(1).max, 30);
+    vec.push_back(1);
+    ASSERT_EQ(vec.segment_count(), 3);
+    EXPECT_EQ(vec.zone(2).min, 1);
+    EXPECT_EQ(vec.zone(2).count, 1);
+}
+
+TEST_F(ZoneMappedVectorTest, PopBackShrinksZones)
+{
+    zone_mapped_vector<int, 4> vec{1, 2, 3, 4, 10, 11};
+    vec.pop_back();
+    EXPECT_EQ(vec.zone(1).count, 1);
+    // The popped value was the page maximum
+    EXPECT_FALSE(vec.zone(1).valid);
+
+    vec.pop_back();
+    EXPECT_EQ(vec.segment_count(), 1);
+
+    vec.push_back(8);
+    vec.push_back(6);
+    vec.push_back(7);
+    vec.pop_back();
+    EXPECT_TRUE(vec.zone(1).valid);
+    EXPECT_EQ(vec.zone(1).max, 8);
+}
+
+TEST_F(ZoneMappedVectorTest, MutableAccessInvalidatesPage)
+{
+    zone_mapped_vector<int, 4> vec{0, 1, 2, 3, 4, 5, 6, 7};
+    EXPECT_EQ(std::as_const(vec)[5], 5);
+    EXPECT_TRUE(vec.zone(1).valid);
+
+    vec[5] = 100;
+    EXPECT_TRUE(vec.zone(0).valid);
+    EXPECT_FALSE(vec.zone(1).valid);
+
+    // The refreshing scan finds the new value and recomputes the zone
+    EXPECT_EQ(matching_indices(vec, 50, 150), std::vector<size_t>{5});
+    EXPECT_TRUE(vec.zone(1).valid);
+    EXPECT_EQ(vec.zone(1).max, 100);
+
+    vec.segment(0)[0] = -5;
+    EXPECT_FALSE(vec.zone(0).valid);
+    vec.at(1) = -6;
+    EXPECT_THROW((void)vec.at(8), std::out_of_range);
+
+    // A const scan does not refresh zones but still sees every match
+    const auto& cvec = vec;
+    EXPECT_EQ(matching_indices(cvec, -10, -1), (std::vector<size_t>{0, 1}));
+    EXPECT_FALSE(vec.zone(0).valid);
+}
+
+// ============================================================================
+// Scanning
+// ============================================================================
+
+TEST_F(ZoneMappedVectorTest, ScanSkipsAndFullyMatchesPages)
+{
+    zone_mapped_vector<int64_t, 8> vec;
+    for (int64_t ts = 0; ts < 64; ++ts)
+    {
+        vec.push_back(ts * 10);
+    }
+
+    // Only pages intersecting [95, 245] are visited: 10..24 -> values 100..240
+    std::vector<size_t> expected;
+    for (size_t i = 10; i <= 24; ++i)
+    {
+        expected.push_back(i);
+    }
+    EXPECT_EQ(matching_indices(vec, int64_t(95), int64_t(245)), expected);
+    EXPECT_TRUE(matching_indices(vec, int64_t(1000), int64_t(2000)).empty());
+    EXPECT_EQ(matching_indices(vec, int64_t(0), int64_t(630)).size(), 64);
+}
+
+TEST_F(ZoneMappedVectorTest, RandomDataMatchesBruteForce)
+{
+    zone_mapped_vector<int, 16> vec;
+    std::mt19937 rng(5);
+    for (int i = 0; i < 1000; ++i)
+    {
+        // Mostly clustered with some noise
+        vec.push_back(i + static_cast<int>(rng() % 50));
+    }
+    for (int i = 0; i < 50; ++i)
+    {
+        vec[rng() % vec.size()] = static_cast<int>(rng() % 1200);
+    }
+
+    for (int query = 0; query < 50; ++query)
+    {
+        const int lo = static_cast<int>(rng() % 1100);
+        const int hi = lo + static_cast<int>(rng() % 100);
+        EXPECT_EQ(matching_indices(std::as_const(vec), lo, hi), brute_force_indices(vec, lo, hi));
+        EXPECT_EQ(matching_indices(vec, lo, hi), brute_force_indices(vec, lo, hi));
+    }
+    for (size_t segment_idx = 0; segment_idx < vec.segment_count(); ++segment_idx)
+    {
+        EXPECT_TRUE(vec.zone(segment_idx).valid);
+    }
+}
+
+TEST_F(ZoneMappedVectorTest, NonTrivialValues)
+{
+    zone_mapped_vector<std::string, 2> vec{"apple", "banana", "cherry", "date", "elder"};
+    EXPECT_EQ(vec.zone(1).min, "cherry");
+    EXPECT_EQ(matching_indices(vec, std::string("b"), std::string("d")), (std::vector<size_t>{1, 2}));
+    vec.clear();
+    EXPECT_TRUE(vec.empty());
+    EXPECT_EQ(vec.segment_count(), 0);
+}